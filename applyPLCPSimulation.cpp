@@ -16,6 +16,14 @@
 #include "encryptedAppx.h"        // The class containing the functions which does the Chebyshev approximation with different assumptions     
 #include "secretShare.h" 		  // The class containing the functions which does the secret sharing  
 #include "applyPLCPSimulation.h"  // The class containing the crypto application functions for each targeted equation
+#include "tiledMRP.h"             // The class containing the multi-ciphertext tiled MRP layout
+#include "diagonalPacking.h"      // The class containing the diagonal (Halevi-Shoup) packing format
+#include "arenaPLCP.h"            // The class containing the reusable Ciphertext and Plaintext buffers of the online loop
+#include "sessionPLCP.h"          // The class containing the reusable cleartext buffers of the online loop
+#include "constantsPLCP.h"        // The class containing the registry of the encoded constants of the online loop
+#include "extractionPLCP.h"       // The class containing the lean result extraction of the online loop
+#include "resultsWriterPLCP.h"    // The class containing the asynchronous structured results writer of the online loop
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
 
 /* Import the important selected C libraries*/
 #include <iostream>
@@ -33,25 +41,23 @@
 #include <time.h>
 #include <unistd.h>
 
-/* Define the constant */
-#define numRandBits 20
-
 /* Call main namespaces */
 using namespace std;
 using namespace seal;
 
 /*
-	The function for performing the cyberphysical system's sensor measurement functionality   
+	The function for obtaining the noisy sensor measurement (with the one time attack) into the session buffers and handing it to the encoding and encryption step of a layout
+	Note: numEntries is the largest encoded vector of the layout, so that the session covers the buffers of the step
 */
-void sense_Encrypt_y(struct simulationMatrixData *smd, struct simulationMatrixMRP *smrp, int numiter, Ciphertext *yy_CP, Ciphertext *yyAS_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr){
+void sense_y_PLCP(struct simulationMatrixData *smd, int numiter, size_t numEntries, function<void(double **, struct sessionPLCP *)> encryptStep){
 
-	// Create the respective sensor data 	
-	double ** ySensorData = (double **) calloc(smd->n, sizeof(double *));
-	for(int i = 0; i < smrp->n; i++)
-		ySensorData[i] = (double *) calloc(1, sizeof(double));	
+	// Take the respective sensor data buffers from the session 	
+	struct sessionPLCP localSession;
+	struct sessionPLCP * session = acquireSessionPLCP(&localSession, smd->n, smd->m, numEntries);
+	double ** ySensorData = session->ySensorData;
 	
 	// Obtain the sensor measurement data 
-	for(int i = 0; i < smrp->n; i++)
+	for(int i = 0; i < smd->n; i++)
 		ySensorData[i][0] = smd->xx[i][0] + smd->yNoise[numiter][i];
 
 	// Anomaly attack detection generation through the sensor measurement 
@@ -60,16 +66,62 @@ void sense_Encrypt_y(struct simulationMatrixData *smd, struct simulationMatrixMR
 		ySensorData[4][0] = ySensorData[4][0] + 4;	
 	}
 		
-	// Define the proper y vectors to be encoded and encrypted 
-	vector<double> * ySensorDataRep = new std::vector<double>(smrp->N * smrp->n); // 2nd equation (Estimation)  
-	vector<double> * ySensorDataZer = new std::vector<double>(smrp->N * smrp->n); // 2nd equation (Estimation)
+	// Encode and encrypt the y vectors in the layout
+	encryptStep(ySensorData, session);
+
+	// Release the session (only a local session is freed)
+	releaseSessionPLCP(session, &localSession);
+}
+
+/*
+	The function for performing the cyberphysical system's sensor measurement functionality   
+*/
+void sense_Encrypt_y(struct simulationMatrixData *smd, struct simulationMatrixMRP *smrp, int numiter, Ciphertext *yy_CP, Ciphertext *yyAS_CP, parms_id_type yyParmsId, parms_id_type yyASParmsId, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr){
+	sense_y_PLCP(smd, numiter, (size_t) smrp->N * smrp->n, [&](double ** ySensorData, struct sessionPLCP *session){
+		encrypt_y_MRP(ySensorData, session, smrp, yy_CP, yyAS_CP, yyParmsId, yyASParmsId, scale, encryptorPtr, encoderPtr);
+	});
+}
+
+/*
+	The function for performing the cyberphysical system's sensor measurement functionality with a streamed (live) y vector
+	Note: The plant is not simulated, thus, neither the recorded noise nor the one time attack is applied
+*/
+void sense_Encrypt_y_Stream(double *yStream, struct simulationMatrixMRP *smrp, Ciphertext *yy_CP, Ciphertext *yyAS_CP, parms_id_type yyParmsId, parms_id_type yyASParmsId, double scale, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr){
+
+	// Take the respective sensor data buffers from the session and copy the streamed y vector
+	struct sessionPLCP localSession;
+	struct sessionPLCP * session = acquireSessionPLCP(&localSession, smrp->n, smrp->m, (size_t) smrp->N * smrp->n);
+	double ** ySensorData = session->ySensorData;
+	for(int i = 0; i < smrp->n; i++)
+		ySensorData[i][0] = yStream[i];
+
+	// Encode and encrypt the y vectors
+	encrypt_y_MRP(ySensorData, session, smrp, yy_CP, yyAS_CP, yyParmsId, yyASParmsId, scale, encryptorPtr, encoderPtr);
+
+	// Release the session (only a local session is freed)
+	releaseSessionPLCP(session, &localSession);
+}
+
+/*
+	The function for encoding and encrypting a sensor measurement in MRP (i.e., repeated for Ly and at the row segment starts for the residues)
+*/
+void encrypt_y_MRP(double ** ySensorData, struct sessionPLCP *session, struct simulationMatrixMRP *smrp, Ciphertext *yy_CP, Ciphertext *yyAS_CP, parms_id_type yyParmsId, parms_id_type yyASParmsId, double scale, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr){
+
+	// Define the proper y vectors to be encoded and encrypted (the session vectors keep their capacity, so resizing does not allocate) 
+	vector<double> * ySensorDataRep = session->ySensorDataRep; // 2nd equation (Estimation)  
+	vector<double> * ySensorDataZer = session->ySensorDataZer; // 6th equation (Residues)
+	ySensorDataRep->resize(smrp->N * smrp->n);
+	ySensorDataZer->resize(smrp->N * smrp->n);
 	genRepXVecMRP_RPL_v0(ySensorDataRep, ySensorData, smrp->n, smrp->n, smrp->N, "Sensor-Measurement-Y-Rep", false);
 	genYVecAddOperMRP_RPL_v0(ySensorDataZer, ySensorData, smrp->n, smrp->n, smrp->N, "Sensor-Measurement-Y-Add", false);
+	// The residues carry sqrt(alpha) of the Eq8 range transformation when it is folded (the client scales its own measurement)
+	if(smrp->isRangeFolded)
+		for(int i = 0; i < smrp->n; i++)
+			ySensorDataZer->at((size_t) i * smrp->N) *= smrp->residueScale;
 	
-	// Encode and encrypt the y vectors
-	encryptXVectorMatRowPacking(ySensorDataRep, scale, yy_CP, encryptorPtr, encoderPtr);
-	encryptXVectorMatRowPacking(ySensorDataZer, scale, yyAS_CP, encryptorPtr, encoderPtr);
-
+	// Encode and encrypt the y vectors at the levels where the server first consumes them (parms_id_zero: the top of the modulus chain)
+	encryptXVectorAtLevelMatRowPacking(ySensorDataRep, scale, yyParmsId, yy_CP, encryptorPtr, encoderPtr);
+	encryptXVectorAtLevelMatRowPacking(ySensorDataZer, scale, yyASParmsId, yyAS_CP, encryptorPtr, encoderPtr);
 }
 
 /*
@@ -84,23 +136,35 @@ void applyEquation_2_PLCP(Ciphertext * secEqRes_CP, struct simulationMatrixMRP *
 		Equation 2 -> x̂e[k] = Γx̂e[k − 1] (1st part) + Ly[k] (2nd part) + xΓ (3rd part) 
 	*/
 	
-	// 1st part of the estimation equation 
-	Ciphertext _2nd_eq_1p;
-	Ciphertext *_2nd_eq_1p_Pt = &_2nd_eq_1p; 	 	
-	plnCprAxMult_mrp(_2nd_eq_1p_Pt, xexe_CP, GAMMA_PL, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);
+	// Take the temporaries from the arena (released on return)
+	struct arenaMarkPLCP mark = markArenaPLCP();
+
+	// 1st part of the estimation equation (the products are summed before a single rescale)
+	Ciphertext _2nd_eq_1p, _2nd_eq_lazySum;
+	Ciphertext *_2nd_eq_1p_Pt 	   = acquireCiphertextArena(&_2nd_eq_1p); 	 	
+	Ciphertext *_2nd_eq_lazySum_Pt = acquireCiphertextArena(&_2nd_eq_lazySum);
+	bool isLazySumEmpty = true;
+	plnCprAxMultLazy_mrp(_2nd_eq_1p_Pt, xexe_CP, GAMMA_PL, scale, contextPtr, evaluatorPtr);
+	accumulateLazySumPLCP(_2nd_eq_lazySum_Pt, _2nd_eq_1p_Pt, &isLazySumEmpty, scale, contextPtr, evaluatorPtr);
 	
 	// 2nd part of the estimation equation
+	plnCprAxMultLazy_mrp(_2nd_eq_1p_Pt, yy_CP, LL_PL, scale, contextPtr, evaluatorPtr);
+	accumulateLazySumPLCP(_2nd_eq_lazySum_Pt, _2nd_eq_1p_Pt, &isLazySumEmpty, scale, contextPtr, evaluatorPtr);
 	Ciphertext _2nd_eq_2p;
-	Ciphertext *_2nd_eq_2p_Pt = &_2nd_eq_2p; 
-	plnCprAxMult_mrp(_2nd_eq_2p_Pt, yy_CP, LL_PL, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);
+	Ciphertext *_2nd_eq_2p_Pt = acquireCiphertextArena(&_2nd_eq_2p); 
+	finalizeLazySumPLCP(_2nd_eq_2p_Pt, _2nd_eq_lazySum_Pt, evaluatorPtr, relin_keysPtr);
 
 	// 3rd part		
 	Ciphertext _2nd_eq_3p;
-	Ciphertext *_2nd_eq_3p_Pt = &_2nd_eq_3p; 
-	addThreeVector(_2nd_eq_3p_Pt, _2nd_eq_1p_Pt, _2nd_eq_2p_Pt, xGxG_CP, scale, contextPtr, evaluatorPtr, relin_keysPtr); // Do encrypted final addition
+	Ciphertext *_2nd_eq_3p_Pt = acquireCiphertextArena(&_2nd_eq_3p); 
+	Ciphertext *xGxG_Level_CP = levelCipherConstantPLCP(xGxG_CP, _2nd_eq_2p_Pt); // The registered constant is taken at the level of the sum
+	addSubtractTwoVector(_2nd_eq_3p_Pt, _2nd_eq_2p_Pt, xGxG_Level_CP, scale, contextPtr, evaluatorPtr, true); // Do encrypted final addition
 	
-	// Do rotation and addition
-	rotateVector(secEqRes_CP, _2nd_eq_3p_Pt, scale, smrp->N, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr);
+	// Do rotation and addition (the key switches run over the primes of the lowest level serving the refresh)
+	if(smrp->isRotationLevelPlanned)
+		modSwitchToChainIndexPLCP(_2nd_eq_3p_Pt, smrp->rotFloorEq2, contextPtr, evaluatorPtr);
+	rotateVector(secEqRes_CP, _2nd_eq_3p_Pt, scale, smrp->rotLenEq2, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr);
+	releaseArenaPLCP(mark);
 }
 
 /*
@@ -114,24 +178,35 @@ void applyEquation_3_PLCP(Ciphertext * thirdEqRes_CP, struct simulationMatrixMRP
 		Equation 3 -> u[k]  = KG*x̂e[k−1] (1st part) + KL * y[k] (2nd part) + KXUΓ (3rd part) 
 	*/
 	
-	// 1st part
-	Ciphertext _3rd_eq_1p;
-	Ciphertext *_3rd_eq_1p_Pt = &_3rd_eq_1p;
-	plnCprAxMult_mrp(_3rd_eq_1p_Pt, xexe_CP, KGKG_PL, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);	
+	// Take the temporaries from the arena (released on return)
+	struct arenaMarkPLCP mark = markArenaPLCP();
+
+	// 1st part (the products are summed before a single rescale)
+	Ciphertext _3rd_eq_1p, _3rd_eq_lazySum;
+	Ciphertext *_3rd_eq_1p_Pt 	   = acquireCiphertextArena(&_3rd_eq_1p);
+	Ciphertext *_3rd_eq_lazySum_Pt = acquireCiphertextArena(&_3rd_eq_lazySum);
+	bool isLazySumEmpty = true;
+	plnCprAxMultLazy_mrp(_3rd_eq_1p_Pt, xexe_CP, KGKG_PL, scale, contextPtr, evaluatorPtr);	
+	accumulateLazySumPLCP(_3rd_eq_lazySum_Pt, _3rd_eq_1p_Pt, &isLazySumEmpty, scale, contextPtr, evaluatorPtr);
 
 	// 2nd part 
+	plnCprAxMultLazy_mrp(_3rd_eq_1p_Pt, yy_CP, KLKL_PL, scale, contextPtr, evaluatorPtr);
+	accumulateLazySumPLCP(_3rd_eq_lazySum_Pt, _3rd_eq_1p_Pt, &isLazySumEmpty, scale, contextPtr, evaluatorPtr);
 	Ciphertext _3rd_eq_2p;
-	Ciphertext *_3rd_eq_2p_Pt = &_3rd_eq_2p;
-	plnCprAxMult_mrp(_3rd_eq_2p_Pt, yy_CP, KLKL_PL, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);
+	Ciphertext *_3rd_eq_2p_Pt = acquireCiphertextArena(&_3rd_eq_2p);
+	finalizeLazySumPLCP(_3rd_eq_2p_Pt, _3rd_eq_lazySum_Pt, evaluatorPtr, relin_keysPtr);
 
 	// 3rd part
 	Ciphertext _3rd_eq_3p;
-	Ciphertext *_3rd_eq_3p_Pt = &_3rd_eq_3p;
-	addThreeVector(_3rd_eq_3p_Pt, _3rd_eq_1p_Pt, _3rd_eq_2p_Pt, KxugKxug_CP, scale, contextPtr, evaluatorPtr, relin_keysPtr); // Do encrypted final addition
-	
-	// Do rotation and addition
-	rotateVector(thirdEqRes_CP, _3rd_eq_3p_Pt, scale, smrp->N, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr);
+	Ciphertext *_3rd_eq_3p_Pt = acquireCiphertextArena(&_3rd_eq_3p);
+	Ciphertext *KxugKxug_Level_CP = levelCipherConstantPLCP(KxugKxug_CP, _3rd_eq_2p_Pt); // The registered constant is taken at the level of the sum
+	addSubtractTwoVector(_3rd_eq_3p_Pt, _3rd_eq_2p_Pt, KxugKxug_Level_CP, scale, contextPtr, evaluatorPtr, true); // Do encrypted final addition
 	
+	// Do rotation and addition (the key switches run over the primes of the lowest level holding the decrypted u)
+	if(smrp->isRotationLevelPlanned)
+		modSwitchToChainIndexPLCP(_3rd_eq_3p_Pt, smrp->rotFloorEq3, contextPtr, evaluatorPtr);
+	rotateVector(thirdEqRes_CP, _3rd_eq_3p_Pt, scale, smrp->rotLenEq3, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr);
+	releaseArenaPLCP(mark);
 }
 
 /*
@@ -152,30 +227,121 @@ void applyEquation_3_fiter_PLCP(Ciphertext * thirdEqRes_CP, struct simulationMat
 /*
 	The function for performing the cyberphysical system's prediction functionality   
 */
-void applyEquation_4_5_PLCP(Ciphertext * fourthfifthEqRes_CP, struct simulationMatrixMRP *smrp, Plaintext *ACL_PL, Plaintext *BB_PL, Ciphertext * uGuG_CP, Ciphertext * xexe_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr){	
+void applyEquation_4_5_PLCP(Ciphertext * fourthfifthEqRes_CP, struct simulationMatrixMRP *smrp, Plaintext *ACL_PL, Ciphertext * BuGLazy_CP, Ciphertext * xexe_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr){	
 	/* 	
 		Aim		: Generated for the 4-5th Equation (i.e., The Prediction Computation)  
 		Equation 4-5 -> x̂p[k] = Acl*x̂e[k − 1] + B*uΓ    
 		Equation 4-5 -> x̂p[k] = Acl*x̂e[k − 1] (1st part) + B*uΓ (2nd part) 
 	*/
 
-	// 1st part 
-	Ciphertext _4_5th_eq_1p;
-	Ciphertext *_4_5th_eq_1p_Pt = &_4_5th_eq_1p;
-	plnCprAxMult_mrp(_4_5th_eq_1p_Pt, xexe_CP, ACL_PL, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);	
+	// Take the temporaries from the arena (released on return)
+	struct arenaMarkPLCP mark = markArenaPLCP();
 
-	// 2nd part
-	Ciphertext _4_5th_eq_2p;
-	Ciphertext *_4_5th_eq_2p_Pt = &_4_5th_eq_2p;
-	plnCprAxMult_mrp(_4_5th_eq_2p_Pt, uGuG_CP, BB_PL, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);
+	// 1st part 
+	Ciphertext _4_5th_eq_1p, _4_5th_eq_lazySum;
+	Ciphertext *_4_5th_eq_1p_Pt 	 = acquireCiphertextArena(&_4_5th_eq_1p);
+	Ciphertext *_4_5th_eq_lazySum_Pt = acquireCiphertextArena(&_4_5th_eq_lazySum);
+	bool isLazySumEmpty = true;
+	plnCprAxMultLazy_mrp(_4_5th_eq_1p_Pt, xexe_CP, ACL_PL, scale, contextPtr, evaluatorPtr);	
+	accumulateLazySumPLCP(_4_5th_eq_lazySum_Pt, _4_5th_eq_1p_Pt, &isLazySumEmpty, scale, contextPtr, evaluatorPtr);
+
+	// 2nd part: B*uΓ is iteration-invariant, thus, its unrescaled product is precomputed once (see precomputeEquation_4_5_PLCP)
+	Ciphertext *BuGLazy_Level_CP = levelCipherConstantPLCP(BuGLazy_CP, _4_5th_eq_lazySum_Pt);
+	accumulateLazySumPLCP(_4_5th_eq_lazySum_Pt, BuGLazy_Level_CP, &isLazySumEmpty, scale, contextPtr, evaluatorPtr);
 	
-	// 3rd part 
+	// 3rd part: Rescale the sum of the products once
 	Ciphertext _4_5th_eq_3p;
-	Ciphertext *_4_5th_eq_3p_Pt = &_4_5th_eq_3p;
-	addSubtractTwoVector(_4_5th_eq_3p_Pt, _4_5th_eq_1p_Pt, _4_5th_eq_2p_Pt, scale, 	contextPtr,	evaluatorPtr, true);
+	Ciphertext *_4_5th_eq_3p_Pt = acquireCiphertextArena(&_4_5th_eq_3p);
+	finalizeLazySumPLCP(_4_5th_eq_3p_Pt, _4_5th_eq_lazySum_Pt, evaluatorPtr, relin_keysPtr);
+
+	// Do rotation and addition (the key switches run over the primes of the lowest level serving the residues and the CUSUM stage)
+	if(smrp->isRotationLevelPlanned)
+		modSwitchToChainIndexPLCP(_4_5th_eq_3p_Pt, smrp->rotFloorEq4_5, contextPtr, evaluatorPtr);
+	rotateVector(fourthfifthEqRes_CP, _4_5th_eq_3p_Pt, scale, smrp->rotLenEq4_5, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr);
+	releaseArenaPLCP(mark);
+}
 
-	// Do rotation and addition
-	rotateVector(fourthfifthEqRes_CP, _4_5th_eq_3p_Pt, scale, smrp->N, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr);	
+/*
+	The function for adding the products of the columns at the row segment starts with the rotations of a vector into a lazy sum (the entry k reaches i * N)
+*/
+static void accumulateRotatedColumnsPLCP(Ciphertext *lazySumPtr, bool *isLazySumEmpty, Ciphertext *vecPtr, vector<Plaintext> *colsPtr, Ciphertext *rotatedPtr, Ciphertext *termPtr, Plaintext *columnCopyPtr, 
+	double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, GaloisKeys *gal_keysPtr){
+	for(size_t k = 0; k < colsPtr->size(); k++){
+		// Bring the entry k of each row segment to i * N
+		if(k == 0)
+			*rotatedPtr = *vecPtr;
+		else
+			evaluatorPtr->rotate_vector(*vecPtr, (int) k, *gal_keysPtr, *rotatedPtr);
+		// Copy the column unless it is registered, since the chain adjustment mod-switches it in place
+		Plaintext *columnPtr = &colsPtr->at(k);
+		if(!isRegisteredConstantPLCP(columnPtr)){
+			*columnCopyPtr = *columnPtr;
+			columnPtr 	   = columnCopyPtr;
+		}
+		plnCprAxMultLazy_mrp(termPtr, rotatedPtr, columnPtr, scale, contextPtr, evaluatorPtr);
+		accumulateLazySumPLCP(lazySumPtr, termPtr, isLazySumEmpty, scale, contextPtr, evaluatorPtr);
+	}
+}
+
+/*
+	The function for performing the cyberphysical system's prediction functionality with the columns of A - LC and B (the folded range transformation)
+	Note: The rotate-and-sum leaves the partial sums of the rows in the other slots, which the alpha multiplication of Eq8 used to zero.
+		  Instead, x^e and uΓ are rotated by k (the entry k reaches i * N) and multiplied with the column k kept at the row segment starts,
+		  thus, the sum is zero outside i * N at the same level (n + m - 2 rotations instead of log2(rotLenEq4_5)).
+*/
+void applyEquation_4_5_Folded_PLCP(Ciphertext * fourthfifthEqRes_CP, struct simulationMatrixMRP *smrp, vector<Plaintext> *ACLCols_PL, Ciphertext * BuGLazy_CP, Ciphertext * xexe_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr){
+	/* 	
+		Aim		: Generated for the 4-5th Equation (i.e., The Prediction Computation)  
+		Equation 4-5 -> x̂p[k] = sqrt(alpha) * (Acl*x̂e[k − 1] + B*uΓ) = Σ_k Acl(:, k) * x̂e(k) + Σ_k B(:, k) * uΓ(k) (with the scaled columns)
+	*/
+
+	// Take the temporaries from the arena (released on return)
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	Ciphertext rotated_Local, term_Local, lazySum_Local;
+	Ciphertext *rotatedPtr = acquireCiphertextArena(&rotated_Local);
+	Ciphertext *termPtr    = acquireCiphertextArena(&term_Local);
+	Ciphertext *lazySumPtr = acquireCiphertextArena(&lazySum_Local);
+	Plaintext column_Local;
+	Plaintext *columnCopyPtr = acquirePlaintextArena(&column_Local);
+
+	// 1st part: Acl*x̂e[k − 1] (the n products are summed before a single rescale)
+	bool isLazySumEmpty = true;
+	accumulateRotatedColumnsPLCP(lazySumPtr, &isLazySumEmpty, xexe_CP, ACLCols_PL, rotatedPtr, termPtr, columnCopyPtr, scale, contextPtr, evaluatorPtr, gal_keysPtr);
+
+	// 2nd part: B*uΓ is iteration-invariant, thus, its m unrescaled products are precomputed once (see precomputeEquation_4_5_PLCP)
+	Ciphertext *BuGLazy_Level_CP = levelCipherConstantPLCP(BuGLazy_CP, lazySumPtr);
+	accumulateLazySumPLCP(lazySumPtr, BuGLazy_Level_CP, &isLazySumEmpty, scale, contextPtr, evaluatorPtr);
+	finalizeLazySumPLCP(fourthfifthEqRes_CP, lazySumPtr, evaluatorPtr, relin_keysPtr);
+	releaseArenaPLCP(mark);
+}
+
+/*
+	The function for precomputing the iteration-invariant B*uΓ of the prediction (uΓ is encrypted once and never updated)
+	Note: The product is kept unrescaled at the scale of scale * scale, so that it is a term of the lazy sum of Eq4-5 at the level of x^e
+*/
+void precomputeEquation_4_5_PLCP(Ciphertext * BuGLazy_CP, struct simulationMatrixMRP *smrp, Plaintext *BB_PL, vector<Plaintext> *BBCols_PL, Ciphertext * uGuG_CP, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, GaloisKeys *gal_keysPtr){
+
+	// Take the temporaries from the arena (released on return)
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	Ciphertext uGuG_Local, rotated_Local, term_Local;
+	Ciphertext *uGuGCopyPtr = acquireCiphertextArena(&uGuG_Local);
+	Ciphertext *rotatedPtr  = acquireCiphertextArena(&rotated_Local);
+	Ciphertext *termPtr 	= acquireCiphertextArena(&term_Local);
+	Plaintext column_Local;
+	Plaintext *columnCopyPtr = acquirePlaintextArena(&column_Local);
+
+	// The copies of uΓ and B are adjusted instead of the originals
+	*uGuGCopyPtr = *uGuG_CP;
+	if(smrp->isRangeFolded){
+		// Σ_k B(:, k) * uΓ(k) with the scaled columns at the row segment starts
+		bool isLazySumEmpty = true;
+		accumulateRotatedColumnsPLCP(BuGLazy_CP, &isLazySumEmpty, uGuGCopyPtr, BBCols_PL, rotatedPtr, termPtr, columnCopyPtr, scale, contextPtr, evaluatorPtr, gal_keysPtr);
+	}else{
+		// B*uΓ in MRP (the rotate-and-sum of Eq4-5 covers it together with Acl*x̂e[k − 1])
+		*columnCopyPtr = *BB_PL;
+		plnCprAxMultLazy_mrp(BuGLazy_CP, uGuGCopyPtr, columnCopyPtr, scale, contextPtr, evaluatorPtr);
+	}
+	releaseArenaPLCP(mark);
 }
 
 /*
@@ -187,13 +353,17 @@ void applyEquation_6_PLCP(Ciphertext * sixthEqRes_CP, struct simulationMatrixMRP
 		Equation 6 ->  (y[k] - x̂p[k])^2      
 	*/
 
+	// Take the temporaries from the arena (released on return)
+	struct arenaMarkPLCP mark = markArenaPLCP();
+
 	// 1st part
 	Ciphertext _6th_eq_1p;
-	Ciphertext *_6th_eq_1p_Pt = &_6th_eq_1p;
+	Ciphertext *_6th_eq_1p_Pt = acquireCiphertextArena(&_6th_eq_1p);
 	addSubtractTwoVector(_6th_eq_1p_Pt, yyAS_CP, fourthfifthEqRes_CP, scale, contextPtr, evaluatorPtr, false);
 
 	// 2nd part
-	vectorSquaringRowPacking(sixthEqRes_CP, _6th_eq_1p_Pt, scale, contextPtr, evaluatorPtr, relin_keysPtr);	
+	vectorSquaringRowPacking(sixthEqRes_CP, _6th_eq_1p_Pt, scale, contextPtr, evaluatorPtr, relin_keysPtr);
+	releaseArenaPLCP(mark);
 }
 
 /*
@@ -206,13 +376,17 @@ void applyEquation_6_fiter_PLCP(Ciphertext * sixthEqRes_CP, struct simulationMat
 		Equation 6 ->  (y[k] - x̂p[k])^2      
 	*/
 
+	// Take the temporaries from the arena (released on return)
+	struct arenaMarkPLCP mark = markArenaPLCP();
+
 	// 1st part
 	Ciphertext _6th_eq_1p;
-	Ciphertext *_6th_eq_1p_Pt = &_6th_eq_1p;
+	Ciphertext *_6th_eq_1p_Pt = acquireCiphertextArena(&_6th_eq_1p);
 	addSubtractPLCPVector(_6th_eq_1p_Pt, yyAS_CP, xpxp_PL, scale, contextPtr, evaluatorPtr, false);
 
 	// 2nd part
-	vectorSquaringRowPacking(sixthEqRes_CP, _6th_eq_1p_Pt, scale, contextPtr, evaluatorPtr, relin_keysPtr);	
+	vectorSquaringRowPacking(sixthEqRes_CP, _6th_eq_1p_Pt, scale, contextPtr, evaluatorPtr, relin_keysPtr);
+	releaseArenaPLCP(mark);
 }
 
 /*
@@ -236,9 +410,43 @@ void applyEquation_CUSUM_PLCP(Ciphertext * eigthEqRes_CP, Ciphertext * ninthEqRe
 
 	// ======================================================================================== 
 	// =============== The 1st part of the CUSUM Computation-EQUATION-8 ======================= 
+	// Take the temporaries from the arena (released on return)
+	struct arenaMarkPLCP mark = markArenaPLCP();
+
 	// ========================================================================================   
+	// The folded range transformation: the residues arrive as alpha8 * r, s is kept as alpha9 * s, v and tau carry the betas (see foldCUSUMRangeTransformMRP)
+	if(smrp->isRangeFolded){
+		// 1st part: Convert alpha9 * s into alpha8 * s (the fresh s is off the critical path of the residues) and add it to alpha8 * r 
+		Ciphertext _8th_eq_conv;
+		Ciphertext *_8th_eq_conv_Pt = acquireCiphertextArena(&_8th_eq_conv);
+		plnCprAxMult_mrp(_8th_eq_conv_Pt, ss_CP, alpha_Eq8_PL, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);
+		Ciphertext _8th_eq_1p;
+		Ciphertext *_8th_eq_1p_Pt = acquireCiphertextArena(&_8th_eq_1p);
+		addSubtractTwoVector(_8th_eq_1p_Pt, sixthEqRes_CP, _8th_eq_conv_Pt, scale, contextPtr, evaluatorPtr, true);
+		// 2nd part: Subtract alpha8 * v + beta8 (i.e., the input of the polynomial is in [-1, 1] without a multiplication)
+		Ciphertext _8th_eq_2p;
+		Ciphertext * _8th_eq_2p_Pt = acquireCiphertextArena(&_8th_eq_2p);
+		addSubtractPLCPVector(_8th_eq_2p_Pt, _8th_eq_1p_Pt, vv_PL, scale, contextPtr, evaluatorPtr, false);
+		// 3rd part: Apply Chebyshev Polynomial Appx. (the coefficients produce alpha9 * s̄)
+		makeChebyshevPolynAppxPLCP(smrp, eigthEqRes_CP, _8th_eq_2p_Pt,  vectorOnePtr_PL,  firstPowerSeriesTermEq8Ptr_PL,  powSerCoeffArr_Eq8_PL, smrp->chebDegEq8, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, decryptorPtr);
+
+		// Equation 9: Subtract alpha9 * tau + beta9 from alpha9 * s and apply Chebyshev Polynomial Appx.
+		Ciphertext _9th_eq_1p;
+		Ciphertext *_9th_eq_1p_Pt = acquireCiphertextArena(&_9th_eq_1p);
+		addSubtractPLCPVector(_9th_eq_1p_Pt, ss_CP, TAU_PL, scale, contextPtr, evaluatorPtr, false);
+		Plaintext PL_vecOne_n;
+		Plaintext *vecOne_n_PL = vectorOnePtr_PL;
+		if(!isRegisteredConstantPLCP(vectorOnePtr_PL)){
+			vecOne_n_PL = acquirePlaintextArena(&PL_vecOne_n);
+			makePlaintextMatRowPacking(smrp->One_MRP, scale, vecOne_n_PL, encoderPtr);
+		}
+		makeChebyshevPolynAppxPLCP(smrp, ninthEqRes_CP, _9th_eq_1p_Pt,  vecOne_n_PL,  firstPowerSeriesTermEq9Ptr_PL,  powSerCoeffArr_Eq9_PL, smrp->chebDegEq9, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, decryptorPtr);
+		releaseArenaPLCP(mark);
+		return;
+	}
+
 	Ciphertext _8th_eq_1p;
-	Ciphertext *_8th_eq_1p_Pt = &_8th_eq_1p;
+	Ciphertext *_8th_eq_1p_Pt = acquireCiphertextArena(&_8th_eq_1p);
 	if(isFirstIter)
 		addSubtractPLCPVector(_8th_eq_1p_Pt, sixthEqRes_CP, ss_PL, scale, contextPtr, evaluatorPtr, true);	
 	else 
@@ -246,25 +454,30 @@ void applyEquation_CUSUM_PLCP(Ciphertext * eigthEqRes_CP, Ciphertext * ninthEqRe
 	
 	// 2nd part 
 	Ciphertext _8th_eq_2p;
-	Ciphertext * _8th_eq_2p_Pt = &_8th_eq_2p;
+	Ciphertext * _8th_eq_2p_Pt = acquireCiphertextArena(&_8th_eq_2p);
 	addSubtractPLCPVector(_8th_eq_2p_Pt, _8th_eq_1p_Pt, vv_PL, scale, contextPtr, evaluatorPtr, false);	
 		
 	// Record the RELU Input	
-	// extractExpRes(_8th_eq_2p_Pt, smrp, smd, numiter, smd->n, scale, contextPtr, decryptorPtr, encoderPtr, "sBar");
+	// extractExpRes(_8th_eq_2p_Pt, smrp, smd, numiter, smd->n, scale, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, "sBar");
 
 	// APPLY CHEBYSHEV APPROXIMATION FOR THE MAXIMUM COMPUTATION   
 	// 3rd part-1: Multiply with Alpha
 	// printf("\n\n===Plaintext-Encrypted or Encrypted max(r[k](i) + s[k](i) - v(i), 0)-1st-Part-Range Transformation-8theq-3rdpart-Beginning===\n\n");
 	Ciphertext _8th_eq_3p_1;	
-	Ciphertext * _8th_eq_3p_1_Pt = &_8th_eq_3p_1;
+	Ciphertext * _8th_eq_3p_1_Pt = acquireCiphertextArena(&_8th_eq_3p_1);
 	plnCprAxMult_mrp(_8th_eq_3p_1_Pt, _8th_eq_2p_Pt, alpha_Eq8_PL, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);
-	// 3rd part-2: Subtract beta + 1
-	// printf("\n\n===Plaintext-Encrypted or Encrypted max(r[k](i) + s[k](i) - v(i), 0)-2nd-Part-Range Transformation-8theq-3rdpart-Beginning===\n\n");
-	Ciphertext _8th_eq_3p_2;	
-	Ciphertext * _8th_eq_3p_2_Pt = &_8th_eq_3p_2;
-	addSubtractPLCPVector(_8th_eq_3p_2_Pt, _8th_eq_3p_1_Pt, beta_Eq8_PL, scale, contextPtr, evaluatorPtr, false);
-	// 3rd part-3: Apply Chebyshev Polynomial Appx.  
-	makeChebyshevPolynAppxPLCP(smrp, eigthEqRes_CP, _8th_eq_3p_2_Pt,  vectorOnePtr_PL,  firstPowerSeriesTermEq8Ptr_PL,  powSerCoeffArr_Eq8_PL, smrp->chebDegEq8, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, decryptorPtr);
+	if(smrp->appxBackendEq8 == CUSUM_APPX_COMPOSITE_SIGN){
+		// 3rd part-2: Apply the composite sign based max approximation (alpha is 1 / B, see assignCUSUMAppxBackendMRP)
+		makeCompositeMaxAppxPLCP(eigthEqRes_CP, _8th_eq_3p_1_Pt, smrp->signBoundEq8, smrp->signStagesEq8, smrp->numSignStagesEq8, scale, contextPtr, evaluatorPtr, encoderPtr, relin_keysPtr);
+	}else{
+		// 3rd part-2: Subtract beta + 1
+		// printf("\n\n===Plaintext-Encrypted or Encrypted max(r[k](i) + s[k](i) - v(i), 0)-2nd-Part-Range Transformation-8theq-3rdpart-Beginning===\n\n");
+		Ciphertext _8th_eq_3p_2;	
+		Ciphertext * _8th_eq_3p_2_Pt = acquireCiphertextArena(&_8th_eq_3p_2);
+		addSubtractPLCPVector(_8th_eq_3p_2_Pt, _8th_eq_3p_1_Pt, beta_Eq8_PL, scale, contextPtr, evaluatorPtr, false);
+		// 3rd part-3: Apply Chebyshev Polynomial Appx.  
+		makeChebyshevPolynAppxPLCP(smrp, eigthEqRes_CP, _8th_eq_3p_2_Pt,  vectorOnePtr_PL,  firstPowerSeriesTermEq8Ptr_PL,  powSerCoeffArr_Eq8_PL, smrp->chebDegEq8, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, decryptorPtr);
+	}
 
 
 	// ======================================================================================== 
@@ -273,25 +486,34 @@ void applyEquation_CUSUM_PLCP(Ciphertext * eigthEqRes_CP, Ciphertext * ninthEqRe
 
 	// 1st part
 	Ciphertext _9th_eq_1p;
-	Ciphertext *_9th_eq_1p_Pt = &_9th_eq_1p;
+	Ciphertext *_9th_eq_1p_Pt = acquireCiphertextArena(&_9th_eq_1p);
 	addSubtractPLCPVector(_9th_eq_1p_Pt, ss_CP, TAU_PL, scale, contextPtr, evaluatorPtr, false);	
 
 	// APPLY CHEBYSHEV APPROXIMATION FOR THE MAXIMUM COMPUTATION   
 	// 2nd part-1: Multiply with Alpha
 	Ciphertext _9th_eq_2p_1;	
-	Ciphertext * _9th_eq_2p_1_Pt = &_9th_eq_2p_1;
+	Ciphertext * _9th_eq_2p_1_Pt = acquireCiphertextArena(&_9th_eq_2p_1);
 	plnCprAxMult_mrp(_9th_eq_2p_1_Pt, _9th_eq_1p_Pt, alpha_Eq9_PL, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);
+	if(smrp->appxBackendEq9 == CUSUM_APPX_COMPOSITE_SIGN){
+		// 2nd part-2: Apply the composite sign based indicator approximation (alpha is 1 / B, see assignCUSUMAppxBackendMRP)
+		makeCompositeIndAppxPLCP(ninthEqRes_CP, _9th_eq_2p_1_Pt, smrp->signStagesEq9, smrp->numSignStagesEq9, scale, contextPtr, evaluatorPtr, encoderPtr, relin_keysPtr);
+		releaseArenaPLCP(mark);
+		return;
+	}
 	// 2nd part-2: Subtract beta + 1 
 	Ciphertext _9th_eq_2p_2;	
-	Ciphertext * _9th_eq_2p_2_Pt = &_9th_eq_2p_2;
+	Ciphertext * _9th_eq_2p_2_Pt = acquireCiphertextArena(&_9th_eq_2p_2);
 	addSubtractPLCPVector(_9th_eq_2p_2_Pt, _9th_eq_2p_1_Pt, beta_Eq9_PL, scale, contextPtr, evaluatorPtr, false);
-	// Prepare vector one for the 9th equation Chebyshev   
+	// Prepare vector one for the 9th equation Chebyshev (a registered ones vector is not adjusted by the 8th equation, thus, it is reused)   
 	Plaintext PL_vecOne_n;
-	Plaintext *vecOne_n_PL;
-	vecOne_n_PL = & PL_vecOne_n;
-	makePlaintextMatRowPacking(smrp->One_MRP, scale, vecOne_n_PL, encoderPtr);
+	Plaintext *vecOne_n_PL = vectorOnePtr_PL;
+	if(!isRegisteredConstantPLCP(vectorOnePtr_PL)){
+		vecOne_n_PL = acquirePlaintextArena(&PL_vecOne_n);
+		makePlaintextMatRowPacking(smrp->One_MRP, scale, vecOne_n_PL, encoderPtr);
+	}
 	// 2nd part-3: Apply Chebyshev Polynomial Appx.	 
-	makeChebyshevPolynAppxPLCP(smrp, ninthEqRes_CP, _9th_eq_2p_2_Pt,  vecOne_n_PL,  firstPowerSeriesTermEq9Ptr_PL,  powSerCoeffArr_Eq9_PL, smrp->chebDegEq9, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, decryptorPtr);	
+	makeChebyshevPolynAppxPLCP(smrp, ninthEqRes_CP, _9th_eq_2p_2_Pt,  vecOne_n_PL,  firstPowerSeriesTermEq9Ptr_PL,  powSerCoeffArr_Eq9_PL, smrp->chebDegEq9, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, decryptorPtr);
+	releaseArenaPLCP(mark);
 }
 
 /*
@@ -304,46 +526,74 @@ void applyEquation_10_PLCP(Ciphertext * tenthEqRes_CP, struct simulationMatrixMR
 		Equation 10 ->  s[k + 1] = s̄[k + 1] ⊙ (1 − alarm [k])
 		Equation 10 ->  s[k + 1] = s̄[k + 1] (2nd part) ⊙ (1 − alarm [k]) (1st part) 
 		Note	: Special secret sharing which zeroes out the indices where alarm = 1 is done 
+				  (or the product is computed under encryption with the homomorphic reset, see below)
 	*/ 
 
-	// 1st part: Decryption and Rounding of alarm[k]   
-	Plaintext plain_alarm;	
-	vector<double> alarmRes;
-	// Decrypt the ciphertext to the plaintext 
-	decryptorPtr->decrypt(*ninthEqRes_CP, plain_alarm);
-	// Decode the plaintext to the not-encrpted result
-	encoderPtr->decode(plain_alarm, alarmRes);
-	for (size_t i = 0; i < smrp->n; i++){	
-		for(size_t j = 0; j < smrp->N; j++){
-			double roundedAlarmValue = round(alarmRes[i * smrp->N + j]); 	
-			if(roundedAlarmValue > 0.4)
-				alarmRes[i * smrp->N + j] = 1;	
-			else 
-				alarmRes[i * smrp->N + j] = 0;			
+	// Homomorphic reset: s[k + 1] = s̄[k + 1] ⊙ (vecOne − alarm[k]) without decrypting the alarm (one level, the approximate alarm is not rounded)
+	if(smrp->isResetHomomorphic){
+		struct arenaMarkPLCP mark = markArenaPLCP();
+		Ciphertext notAlarm_Local, sumBar_Local;
+		Ciphertext *notAlarmPtr = acquireCiphertextArena(&notAlarm_Local);
+		Ciphertext *sumBarPtr 	= acquireCiphertextArena(&sumBar_Local);
+		// 1st part: 1 − alarm[k] at the row segment starts (the ones vector is copied, so that it is not mod-switched in place)
+		*notAlarmPtr = *vectorOnePtr_CP;
+		addSubtractTwoVector(notAlarmPtr, notAlarmPtr, ninthEqRes_CP, scale, contextPtr, evaluatorPtr, false);
+		// The other slots of the row segments are not masked by the folded range transformation, thus, s̄ is masked to the row segment starts
+		*sumBarPtr = *eigthEqRes_CP;
+		if(smrp->isRangeFolded){
+			// The registered mask is taken at the level of s̄ by the multiplication (see levelConstantPLCP), otherwise it is encoded at that level
+			Plaintext rowStart_Local;
+			Plaintext *rowStartPtr = smrp->rowStartMask_PL;
+			if(rowStartPtr == NULL || !isRegisteredConstantPLCP(rowStartPtr)){
+				rowStartPtr = acquirePlaintextArena(&rowStart_Local);
+				encoderPtr->encode(*smrp->One_MRP, sumBarPtr->parms_id(), scale, *rowStartPtr);
+			}
+			plnCprAxMult_InPlac_mrp(sumBarPtr, rowStartPtr, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);
 		}
+		// 2nd part: s̄[k + 1] ⊙ (1 − alarm[k])
+		matrixVectorMultMatRowPacking(tenthEqRes_CP, sumBarPtr, notAlarmPtr, scale, contextPtr, evaluatorPtr, relin_keysPtr);
+		releaseArenaPLCP(mark);
+		return;
+	}
+
+	// 1st part: Decryption and Rounding of alarm[k] (only the entries at i * N are used)   
+	struct sessionPLCP localSession;
+	struct sessionPLCP * session = acquireSessionPLCP(&localSession, smrp->n, smrp->m, (size_t) smrp->N * smrp->n);
+	struct extractorPLCP *ex 	 = activeExtractorPLCP;
+	double * alarmRow;
+	vector<double> alarmRes;
+	// Send the alarm at the lowest level holding its values
+	Ciphertext alarmDownlink;
+	modSwitchDownlinkPLCP(&alarmDownlink, ninthEqRes_CP, false, scale, contextPtr, evaluatorPtr);
+	if(ex != NULL && ex->N == smrp->N && smrp->n <= ex->numRows){
+		alarmRow = decryptGatherPLCP(ex, &alarmDownlink);
+	}else{
+		Plaintext plain_alarm;	
+		// Decrypt the ciphertext to the plaintext 
+		decryptorPtr->decrypt(alarmDownlink, plain_alarm);
+		// Decode the plaintext to the not-encrpted result and gather the entries at i * N in place
+		encoderPtr->decode(plain_alarm, alarmRes);
+		for (size_t i = 0; i < smrp->n; i++)
+			alarmRes[i] = alarmRes[i * smrp->N];
+		alarmRow = alarmRes.data();
 	}
 
 	// 2nd part: Determination of CUSUM Multiplicator 
-	// Initialize the alarm multiplicator with ones  		 
-	int * CUSUMParamSumMultiplicator = (int *) calloc(smrp->n, sizeof(int));  	
-	for (size_t i = 0; i < smrp->n; i++)
-		CUSUMParamSumMultiplicator[i] = 1;
-	// Update the alarm multiplicator based on the alarm value - Assign zero when alarm = 1
-	for (size_t i = 0; i < smrp->n * smrp->N; i++){
-		int quot = i / smrp->N;  
-		if(i % smrp->N == 0)
-			if(alarmRes[i] == 1)
-				CUSUMParamSumMultiplicator[quot] = 0;
+	// Assign zero to the alarm multiplicator (taken from the session) when the rounded alarm = 1, and one otherwise
+	int * CUSUMParamSumMultiplicator = session->CUSUMParamSumMultiplicator;  	
+	for (size_t i = 0; i < smrp->n; i++){
+		double roundedAlarmValue 	  = round(alarmRow[i]); 	
+		CUSUMParamSumMultiplicator[i] = (roundedAlarmValue > 0.4) ? 0 : 1;
 		// Sanity Check
-		// if(i == smrp->N * 5 || i == smrp->N * 7) // Added for sanity check, to be commented after testing 
-		//	CUSUMParamSumMultiplicator[quot] = 0; // Added for sanity check, to be commented after testing 				
-	} 		
+		// if(i == 5 || i == 7) // Added for sanity check, to be commented after testing 
+		//	CUSUMParamSumMultiplicator[i] = 0; // Added for sanity check, to be commented after testing 				
+	}
 
 	// 3rd part: Special Secret Sharing  
 	// Create Noise vector for the initial addition
 	vector<double> rand_double_add(smrp->n * smrp->N);		
 	for (size_t  i = 0; i < smrp->n * smrp->N; i++){	
-		int randomNumSamplingInterval = pow(2, numRandBits); // Check for different values == // 4194304; // 134217728; // 4194304; // 500; // 4294967296; // == 
+		int randomNumSamplingInterval = pow(2, currentRunConfigPLCP()->numRandBits); // Check for different values == // 4194304; // 134217728; // 4194304; // 500; // 4294967296; // == 
 		double ran = rand() % randomNumSamplingInterval;		
 		rand_double_add[i] = ran;					
 	}
@@ -352,12 +602,13 @@ void applyEquation_10_PLCP(Ciphertext * tenthEqRes_CP, struct simulationMatrixMR
 	for (size_t  i = 0; i < smrp->n * smrp->N; i++){
 		// int quot = i / smrp->N; // Added for sanity check (to be removed after testing) 
 		if(i % smrp->N == 0){
-			if(alarmRes[i] == 1) 
+			if(CUSUMParamSumMultiplicator[i / smrp->N] == 0) 
 				rand_double_sub[i] = 0.0000000000000000;
 			else 			
 				rand_double_sub[i] = rand_double_add[i];
 		}else {
-		 	rand_double_sub[i] = rand_double_add[i];
+			// The other slots of the row segments are zeroed with the folded range transformation (see below), thus, their noise is not subtracted
+		 	rand_double_sub[i] = smrp->isRangeFolded ? 0 : rand_double_add[i];
 		}
 	}
 					
@@ -383,6 +634,8 @@ void applyEquation_10_PLCP(Ciphertext * tenthEqRes_CP, struct simulationMatrixMR
 	// Do initial encrypted addition
 	addSubtractTwoVector(x_Random_Noise_AddedPtr, eigthEqRes_CP, randAddEncPtr, scale, contextPtr, evaluatorPtr, true);
 	
+	// Send the noise added vector at the lowest level holding the masked values
+	modSwitchDownlinkPLCP(x_Random_Noise_AddedPtr, x_Random_Noise_AddedPtr, true, scale, contextPtr, evaluatorPtr);
 	// Decrypt the noise added vector 							 			
 	Plaintext plain_SecretShare_Decrypt_Result;	
 	vector<double> decryptedVec;
@@ -394,6 +647,13 @@ void applyEquation_10_PLCP(Ciphertext * tenthEqRes_CP, struct simulationMatrixMR
 		if(CUSUMParamSumMultiplicator[i] == 0)
 			decryptedVec[i * smrp->N] = 0;
 	}
+	// Zeroing out the other slots of the row segments with the folded range transformation (the alpha multiplication of Eq9 does not mask them anymore)
+	if(smrp->isRangeFolded){
+		for (size_t i = 0; i < decryptedVec.size(); i++){ 
+			if(i % smrp->N != 0 || i >= (size_t) smrp->n * smrp->N)
+				decryptedVec[i] = 0;
+		}
+	}
 
 	// Encrypt the index summed decryption vector of x^e[k-1]
 	Plaintext plainText; 
@@ -409,12 +669,15 @@ void applyEquation_10_PLCP(Ciphertext * tenthEqRes_CP, struct simulationMatrixMR
 	
 	// Assign fresh encrypted vector	
 	*tenthEqRes_CP = x_Random_Noise_Subtracted;	
+
+	// Release the session (only a local session is freed)
+	releaseSessionPLCP(session, &localSession);
 }
 
 /*
 	The function for performing the cyberphysical system's sensor measurement simulation in a naturally noisy environment    
 */
-void applyXVecNoiseAddition(Ciphertext * controlAction_CP, int numIter, struct  simulationMatrixMRP * smrp, struct  simulationMatrixData * smd, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr){
+void applyXVecNoiseAddition(Ciphertext * controlAction_CP, int numIter, struct  simulationMatrixMRP * smrp, struct  simulationMatrixData * smd, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr){
 
 	/*
 		Aim	  : Generated for the updated sensor measurements (i.e., Apply noise addition operation at the end of an online iteration)   
@@ -426,94 +689,169 @@ void applyXVecNoiseAddition(Ciphertext * controlAction_CP, int numIter, struct
 		Last Equation ->  x(:, k+1) = A*x(:, k) (1st part) + B*u(:, k) (2nd part) + F*mvnrnd(zeros(4,1),W)'(3rd part)  
 	*/ 
 
-	// Initialize the pointers (i.e., Axk, u, Bu, AxkBuNoise) 	
-	// Initialize and define the outer double pointers
-	double ** Axk 		 = (double **) calloc(smrp->n, sizeof(double *)); 
-	double ** u 		 = (double **) calloc(smrp->m, sizeof(double *));
-	double ** Bu 		 = (double **) calloc(smrp->n, sizeof(double *));
-	double ** xSpecNoise = (double **) calloc(smrp->n, sizeof(double *));
-	double ** AxkBuNoise = (double **) calloc(smrp->n, sizeof(double *));
-	// Initialize and define the inner single pointers
-	for(int i = 0; i < smrp->n; i++){
-		Axk[i] 		  = (double *) calloc(1, sizeof(double));
-		if(i < smd->m)			 	
-			u[i] = (double *) calloc(1, sizeof(double));
-		Bu[i] 		  = (double *) calloc(1, sizeof(double));
-		xSpecNoise[i] = (double *) calloc(1, sizeof(double));	 		
-		AxkBuNoise[i] = (double *) calloc(1, sizeof(double)); 		
+	// Take the pointers (i.e., Axk, u, Bu, AxkBuNoise) from the session 	
+	struct sessionPLCP localSession;
+	struct sessionPLCP * session = acquireSessionPLCP(&localSession, smrp->n, smrp->m, (size_t) smrp->N * smrp->n);
+	double ** u 		 = session->u;
+
+	// Send the control action at the lowest level holding its values
+	Ciphertext controlDownlink;
+	modSwitchDownlinkPLCP(&controlDownlink, controlAction_CP, false, scale, contextPtr, evaluatorPtr);
+	// Decrypt the control action and obtain cleartext u vector (only the entries at i * N are read)
+	struct extractorPLCP *ex = activeExtractorPLCP;
+	if(ex != NULL && ex->N == smrp->N && smrp->m <= ex->numRows){
+		double * controlRow = decryptGatherPLCP(ex, &controlDownlink);
+		for (size_t i = 0; i < smrp->m; i++)
+			u[i][0] = controlRow[i];
+	}else{
+		Plaintext * pl_cont 		= session->controlAction_PL;	
+		vector<double> * controlRes = session->controlRes;	
+		decryptorPtr->decrypt(controlDownlink, *pl_cont);  
+		encoderPtr->decode(*pl_cont, *controlRes);
+		for (size_t i = 0; i < smrp->m; i++)
+			u[i][0] = controlRes->at(i * smrp->N);
 	}
 
-	// Decrypt the control action and obtain cleartext u vector 
-	Plaintext pl_cont;	
-	vector<double> controlRes;	
-	decryptorPtr->decrypt(*controlAction_CP, pl_cont);  
-	encoderPtr->decode(pl_cont, controlRes);
-	for (size_t i = 0; i < smrp->m; i++){	
-		for(size_t j = 0; j < smrp->N; j++){
-			if(j == 0)
-				u[i][j] = controlRes[i * smrp->N + j];
-		}	
-	}
+	// Advance the simulated plant with the decrypted control action
+	advancePlantStatePLCP(session, smd, numIter);
+
+	// Release the session (only a local session is freed)
+	releaseSessionPLCP(session, &localSession);
+} 
+
+/*
+	The function for advancing the simulated plant, x[k + 1] = A*x[k] + B*u[k] + noise, with the decrypted control action in the session
+	Note: Shared by the layouts, which only differ in the decryption of u into session->u
+*/
+void advancePlantStatePLCP(struct sessionPLCP *session, struct simulationMatrixData * smd, int numIter){
 
 	// 1st part: Multiply A and xk in cleartext
-	matrixMult(Axk, smd->AA, smd->xx, smd->n, smd->n, smd->n, 1); 
+	matrixMult(session->Axk, smd->AA, smd->xx, smd->n, smd->n, smd->n, 1); 
 	// 2nd part: Multiply B and u in cleartext			
-	matrixMult(Bu, smd->BB, u, smd->n, smd->m, smd->m, 1);	
+	matrixMult(session->Bu, smd->BB, session->u, smd->n, smd->m, smd->m, 1);	
 	// 3rd part: Add each and every part of the measurement 
 	// Achieve the xNoise vector w.r.t. number of iterations	
-	for (size_t i = 0; i < smrp->n; i++)
-		xSpecNoise[i][0] = smd->xNoise[numIter][i];
+	for (int i = 0; i < smd->n; i++)
+		session->xSpecNoise[i][0] = smd->xNoise[numIter][i];
 	// Add the the all three terms and assign it simulation data struct
-	matrixAdditionThree(AxkBuNoise, Axk, Bu, xSpecNoise, smd->n, 1);
-	assignXResult(smd, AxkBuNoise, smd->n, 1);
-} 
+	matrixAdditionThree(session->AxkBuNoise, session->Axk, session->Bu, session->xSpecNoise, smd->n, 1);
+	assignXResult(smd, session->AxkBuNoise, smd->n, 1);
+}
 
 /*
 	The function for extracting the experimental results
 */
-void extractExpRes(Ciphertext * res_CP, struct simulationMatrixMRP * smrp, struct simulationMatrixData * smd, int numIter, int numOfRows, double scale, SEALContext *contextPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, char * matname){
+void extractExpRes(Ciphertext * res_CP, struct simulationMatrixMRP * smrp, struct simulationMatrixData * smd, int numIter, int numOfRows, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, const char * matname){
 
 	// Print the number of iterations
-	cout << "Iteration: " << numIter << endl;	
-	cout << "Experimented Result vector name: " << matname << endl;	
+	if(isLoggedPLCP(LOG_LEVEL_VERBOSE)){
+		cout << "Iteration: " << numIter << endl;	
+		cout << "Experimented Result vector name: " << matname << endl;	
+	}
 	
+	// Send the result at the lowest level holding its values
+	Ciphertext resDownlink;
+	modSwitchDownlinkPLCP(&resDownlink, res_CP, false, scale, contextPtr, evaluatorPtr);
+
+	// Decrypt and gather the result with the active extractor (once, into its reused buffers)
+	enum resultTargetPLCP target = resultTargetFromName(matname);
+	struct extractorPLCP *ex = activeExtractorPLCP;
+	if(ex != NULL && ex->N == smrp->N && numOfRows <= ex->numRows){
+		double * Res_Ind = decryptGatherPLCP(ex, &resDownlink);
+		assignExpResTarget(smd, Res_Ind, numIter, numOfRows, target, true);
+		return;
+	}
+
 	// Decrypt the result 
 	Plaintext Res_PL;	
 	vector<double> Res_Vec;
-	decryptorPtr->decrypt(*res_CP, Res_PL);
+	decryptorPtr->decrypt(resDownlink, Res_PL);
 	encoderPtr->decode(Res_PL, Res_Vec);	
 	
-	// Assign the content of the respective matrix to the simulation data struct 	
-	for(int i = 0; i < numOfRows; i++){
-		double i_Ind_Res = Res_Vec[i * smrp->N];			
-		if(strcmp(matname, "xe") == 0)
-			smd->xe_Res[numIter][i] = i_Ind_Res;  	
-		if(strcmp(matname, "u") == 0)
-			smd->u_Res[numIter][i]  = i_Ind_Res;
-		if(strcmp(matname, "xp") == 0)
-			smd->xp_Res[numIter][i] = i_Ind_Res;		
-		if(strcmp(matname, "residue") == 0)
-			smd->residue_Res[numIter][i] = i_Ind_Res;
-		if(strcmp(matname, "sBar") == 0)
-			smd->sBar_Res[numIter][i] = i_Ind_Res; 	  	
-		if(strcmp(matname, "indInp") == 0)
-			smd->indInp_Res[numIter][i] = i_Ind_Res;
-		if(strcmp(matname, "s") == 0)
-			smd->s_Res[numIter][i] = i_Ind_Res; 		  
-		if(strcmp(matname, "x") == 0)
-			smd->x_Res[numIter][i] = i_Ind_Res;		  
-		if(strcmp(matname, "y") == 0)
-			smd->y_Res[numIter][i] = i_Ind_Res;
-		if(strcmp(matname, "alarm") == 0) {
-			double roundedAlarmValue = round(i_Ind_Res); 	
-			if(roundedAlarmValue > 0.4)
-				smd->alarm_Res[numIter][i] = 1;
-			else 
-				smd->alarm_Res[numIter][i] = 0;
-			printf("%f ", smd->alarm_Res[numIter][i]);
+	// Read the entries at i * N and assign them to the simulation data struct
+	double * Res_Ind = (double *) calloc(numOfRows, sizeof(double));
+	for(int i = 0; i < numOfRows; i++)
+		Res_Ind[i] = Res_Vec[i * smrp->N];
+	assignExpResTarget(smd, Res_Ind, numIter, numOfRows, target, true);
+	free(Res_Ind);
+}
+
+/*
+	The function for assigning the extracted (decrypted) experimental results to the simulation data struct
+*/
+void assignExpRes(struct simulationMatrixData * smd, double * Res_Ind, int numIter, int numOfRows, const char * matname){
+
+	// Convert the name once and assign the content of the respective matrix to the simulation data struct
+	assignExpResTarget(smd, Res_Ind, numIter, numOfRows, resultTargetFromName(matname), true);
+}
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Tiled (Multi-Ciphertext) MRP ===
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+
+/*
+	The function for performing the cyberphysical system's sensor measurement functionality in the tiled MRP format  
+*/
+void sense_Encrypt_y_Tiled(struct simulationMatrixData *smd, struct tiledLayoutMRP *tl, int numiter, vector<Ciphertext> *yyColTiles_CP, vector<Ciphertext> *yyASRowTiles_CP, double scale, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr){
+	sense_y_PLCP(smd, numiter, tl->slotCount, [&](double ** ySensorData, struct sessionPLCP *session){
+		// Define the proper y tiles (i.e., replicated column tiles for Ly and row tiles for the residues) in the session tiles, which keep their capacity
+		genTiledRepXVecMRP_RPL(session->yTilesRep, ySensorData, tl);
+		genTiledAddVecMRP_RPL(session->yTilesZer, ySensorData, tl);
+		// Encode and encrypt the y tiles
+		encryptTiledVectorMatRowPacking(session->yTilesRep, scale, yyColTiles_CP, encryptorPtr, encoderPtr);
+		encryptTiledVectorMatRowPacking(session->yTilesZer, scale, yyASRowTiles_CP, encryptorPtr, encoderPtr);
+	});
+}
+
+/*
+	The function for performing the cyberphysical system's sensor measurement simulation in a naturally noisy environment in the tiled MRP format   
+	Note: The control action u is held in the row tiles of the (m x n) layout, each row tile is sent at its lowest level and gathered through the extractor
+*/
+void applyXVecNoiseAdditionTiled(vector<Ciphertext> *controlAction_CP, struct tiledLayoutMRP *tl, int numIter, struct simulationMatrixData * smd, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr){
+
+	// Take the control action buffers from the session 	
+	struct sessionPLCP localSession;
+	struct sessionPLCP * session = acquireSessionPLCP(&localSession, smd->n, smd->m, tl->slotCount);
+	double ** u = session->u;
+
+	// Decrypt the control action row tiles and obtain cleartext u vector (only the entries at i * N are read)
+	struct extractorPLCP *ex = activeExtractorPLCP;
+	Ciphertext controlDownlink;
+	for(int r = 0; r < tl->numRowTiles; r++){
+		int rowOffset  = r * tl->rowsPerTile;
+		int rowsInTile = min(tl->rowsPerTile, tl->numRows - rowOffset);
+		modSwitchDownlinkPLCP(&controlDownlink, &controlAction_CP->at(r), false, scale, contextPtr, evaluatorPtr);
+		if(ex != NULL && ex->N == tl->N && rowsInTile <= ex->numRows){
+			double * controlRow = decryptGatherPLCP(ex, &controlDownlink);
+			for(int i = 0; i < rowsInTile; i++)
+				u[rowOffset + i][0] = controlRow[i];
+		}else{
+			decryptorPtr->decrypt(controlDownlink, *session->controlAction_PL);  
+			encoderPtr->decode(*session->controlAction_PL, *session->controlRes);
+			for(int i = 0; i < rowsInTile; i++)
+				u[rowOffset + i][0] = session->controlRes->at((size_t) i * tl->N);
 		}
-		if(strcmp(matname, "alarm") != 0) 
-			printf("%.11f ", i_Ind_Res);
-	}	
-	printf("\n");		
+	}
+
+	// Advance the simulated plant with the decrypted control action
+	advancePlantStatePLCP(session, smd, numIter);
+
+	// Release the session (only a local session is freed)
+	releaseSessionPLCP(session, &localSession);
+}
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Diagonal Packing ===============
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+
+/*
+	The function for performing the cyberphysical system's sensor measurement functionality in the diagonal packing format
+	Note: A single replicated y ciphertext serves both the matrix-vector multiplications (Ly, KLy) and the residues
+*/
+void sense_Encrypt_y_Diagonal(struct simulationMatrixData *smd, struct diagonalLayoutDGP *dl, int numiter, Ciphertext *yy_CP, double scale, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr){
+	sense_y_PLCP(smd, numiter, dl->slotCount, [&](double ** ySensorData, struct sessionPLCP *session){
+		// Encode and encrypt the replicated y vector (the session vector keeps its capacity)
+		genRepVecDGP_RPL(session->ySensorDataRep, ySensorData, smd->n, dl);
+		encryptXVectorMatRowPacking(session->ySensorDataRep, scale, yy_CP, encryptorPtr, encoderPtr);
+	});
 }
@@ -19,10 +19,14 @@
 #include "encryptedAppx.h"        // The class containing the functions which does the Chebyshev approximation with different assumptions     
 #include "secretShare.h" 		  // The class containing the functions which does the secret sharing  
 #include "applyPLCPSimulation.h"  // The class containing the crypto application functions for each targeted equation
+#include "tiledMRP.h"             // The class containing the multi-ciphertext tiled MRP layout
+#include "diagonalPacking.h"      // The class containing the diagonal (Halevi-Shoup) packing format
+#include "sessionPLCP.h"          // The class containing the reusable cleartext buffers of the online loop
 
 /* Import the important selected C libraries*/
 #include <array>
 #include <cmath>
+#include <functional>
 #include <iostream>
 #include <vector>
 #include <float.h>
@@ -39,8 +43,17 @@
 using namespace std;
 using namespace seal;
 
+/* The function for obtaining the noisy sensor measurement (with the one time attack) into the session buffers and handing it to the encoding and encryption step of a layout */
+void sense_y_PLCP(struct simulationMatrixData *smd, int numiter, size_t numEntries, function<void(double **, struct sessionPLCP *)> encryptStep);
+
 /* The function for performing the cyberphysical system's sensor measurement functionality   */
-void sense_Encrypt_y(struct simulationMatrixData *smd, struct simulationMatrixMRP *smrp, int numiter, Ciphertext *yy_CP, Ciphertext *yyAS_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr);
+void sense_Encrypt_y(struct simulationMatrixData *smd, struct simulationMatrixMRP *smrp, int numiter, Ciphertext *yy_CP, Ciphertext *yyAS_CP, parms_id_type yyParmsId, parms_id_type yyASParmsId, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr);
+
+/* The function for performing the cyberphysical system's sensor measurement functionality with a streamed (live) y vector */
+void sense_Encrypt_y_Stream(double *yStream, struct simulationMatrixMRP *smrp, Ciphertext *yy_CP, Ciphertext *yyAS_CP, parms_id_type yyParmsId, parms_id_type yyASParmsId, double scale, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr);
+
+/* The function for encoding and encrypting a sensor measurement in MRP (i.e., repeated for Ly and at the row segment starts for the residues) at the given levels */
+void encrypt_y_MRP(double ** ySensorData, struct sessionPLCP *session, struct simulationMatrixMRP *smrp, Ciphertext *yy_CP, Ciphertext *yyAS_CP, parms_id_type yyParmsId, parms_id_type yyASParmsId, double scale, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr);
 
 /* The function for performing the cyberphysical system's estimation functionality   */
 void applyEquation_2_PLCP(Ciphertext * secEqRes_CP, struct simulationMatrixMRP *smrp, Plaintext *GAMMA_PL, Plaintext *LL_PL, Ciphertext * xGxG_CP,  Ciphertext * yy_CP, Ciphertext * xexe_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr);
@@ -52,7 +65,13 @@ void applyEquation_3_PLCP(Ciphertext * thirdEqRes_CP, struct simulationMatrixMRP
 void applyEquation_3_fiter_PLCP(Ciphertext * thirdEqRes_CP, struct simulationMatrixMRP *smrp, Plaintext *KxKx_PL, Ciphertext * uGuG_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr);
 
 /* The function for performing the cyberphysical system's prediction functionality   */
-void applyEquation_4_5_PLCP(Ciphertext * fourthfifthEqRes_CP, struct simulationMatrixMRP *smrp, Plaintext *ACL_PL, Plaintext *BB_PL, Ciphertext * uGuG_CP, Ciphertext * xexe_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr);
+void applyEquation_4_5_PLCP(Ciphertext * fourthfifthEqRes_CP, struct simulationMatrixMRP *smrp, Plaintext *ACL_PL, Ciphertext * BuGLazy_CP, Ciphertext * xexe_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr);
+
+/* The function for performing the cyberphysical system's prediction functionality with the columns of A - LC and B (the folded range transformation, see foldCUSUMRangeTransformMRP) */
+void applyEquation_4_5_Folded_PLCP(Ciphertext * fourthfifthEqRes_CP, struct simulationMatrixMRP *smrp, vector<Plaintext> *ACLCols_PL, Ciphertext * BuGLazy_CP, Ciphertext * xexe_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr);
+
+/* The function for precomputing the iteration-invariant B*uΓ of the prediction once (unrescaled, i.e., a term of the lazy sum of Eq4-5) */
+void precomputeEquation_4_5_PLCP(Ciphertext * BuGLazy_CP, struct simulationMatrixMRP *smrp, Plaintext *BB_PL, vector<Plaintext> *BBCols_PL, Ciphertext * uGuG_CP, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, GaloisKeys *gal_keysPtr);
 
 /* The function for performing the cyberphysical system's residues computation functionality */
 void applyEquation_6_PLCP(Ciphertext * sixthEqRes_CP, struct simulationMatrixMRP * smrp, Ciphertext * fourthfifthEqRes_CP, Ciphertext * yyAS_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr);
@@ -75,9 +94,24 @@ void applyEquation_CUSUM_PLCP(Ciphertext * eigthEqRes_CP, Ciphertext * ninthEqRe
 void applyEquation_10_PLCP(Ciphertext * tenthEqRes_CP, struct simulationMatrixMRP * smrp, Ciphertext * eigthEqRes_CP, Ciphertext * ninthEqRes_CP, Ciphertext *vectorOnePtr_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr);
 
 /* The function for performing the cyberphysical system's sensor measurement simulation in a naturally noisy environment */
-void applyXVecNoiseAddition(Ciphertext * controlAction_CP, int numIter, struct  simulationMatrixMRP * smrp, struct  simulationMatrixData * smd, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr);
+void applyXVecNoiseAddition(Ciphertext * controlAction_CP, int numIter, struct  simulationMatrixMRP * smrp, struct  simulationMatrixData * smd, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr);
+
+/* The function for advancing the simulated plant, x[k + 1] = A*x[k] + B*u[k] + noise, with the decrypted control action in the session */
+void advancePlantStatePLCP(struct sessionPLCP *session, struct simulationMatrixData * smd, int numIter);
 
 /* The function for extracting the experimental results */
-void extractExpRes(Ciphertext * res_CP, struct simulationMatrixMRP * smrp, struct simulationMatrixData * smd, int numIter, int numOfRows, double scale, SEALContext *contextPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, char * matname);
+void extractExpRes(Ciphertext * res_CP, struct simulationMatrixMRP * smrp, struct simulationMatrixData * smd, int numIter, int numOfRows, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, const char * matname);
+
+/* The function for assigning the extracted (decrypted) experimental results to the simulation data struct */
+void assignExpRes(struct simulationMatrixData * smd, double * Res_Ind, int numIter, int numOfRows, const char * matname);
+
+/* The function for performing the cyberphysical system's sensor measurement functionality in the tiled MRP format */
+void sense_Encrypt_y_Tiled(struct simulationMatrixData *smd, struct tiledLayoutMRP *tl, int numiter, vector<Ciphertext> *yyColTiles_CP, vector<Ciphertext> *yyASRowTiles_CP, double scale, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr);
+
+/* The function for performing the cyberphysical system's sensor measurement simulation in a naturally noisy environment in the tiled MRP format */
+void applyXVecNoiseAdditionTiled(vector<Ciphertext> *controlAction_CP, struct tiledLayoutMRP *tl, int numIter, struct simulationMatrixData * smd, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr);
+
+/* The function for performing the cyberphysical system's sensor measurement functionality in the diagonal packing format */
+void sense_Encrypt_y_Diagonal(struct simulationMatrixData *smd, struct diagonalLayoutDGP *dl, int numiter, Ciphertext *yy_CP, double scale, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr);
 
 #endif
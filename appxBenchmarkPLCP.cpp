@@ -0,0 +1,235 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for benchmarking the approximation backends of the CUSUM nonlinearities
+						  Each slot of the encrypted input holds a sample of the approximation interval, thus, a single evaluation covers the whole
+						  interval, and the Chebyshev approximation (the configured degree) is compared with the composite sign approximations
+						  (the configured stages and a few common stage lists) on the same input.
+	Note				: The composite sign approximation is exact up to its precision outside a transition band around zero (i.e., |x| < B * eps),
+						  whereas the Chebyshev approximation spreads its error over the interval, so the errors are also reported outside |x| < 1.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "initializationPLCP.h"   // The class containing the functions which convert the prepared matrices to Plaintext and Ciphertext objects.
+#include "encryptedAppx.h"        // The class containing the functions which does the Chebyshev approximation with different assumptions
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
+#include "appxBenchmarkPLCP.h"    // The class containing the benchmark of the approximation backends of the CUSUM nonlinearities
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <exception>
+#include <vector>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/*
+	The function for benchmarking a backend on the inputs x (the exact values are max(x, 0) for Eq8 and Ind(x > 0) for Eq9)
+	Note: The range transformation (i.e., the plaintext multiplication with alpha) is included in the latency and the levels, as in applyEquation_CUSUM_PLCP
+*/
+void benchmarkCUSUMAppxPLCP(struct appxBenchmarkResultPLCP *res, struct simulationMatrixData *smd, vector<double> *inputVec, double lowBound, double upBound,
+	int numReps, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr,
+	RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr){
+
+	// The range transformation of the backend (Chebyshev: [a, b] onto [-1, 1], composite sign: x / B)
+	bool isMax 	 = (res->equation == 8);
+	double bound = max(fabs(lowBound), fabs(upBound));
+	double alpha, beta;
+	int stages[maxSignStages];
+	int numStages = 0;
+	res->isCompleted = false;
+	if(res->backend == CUSUM_APPX_CHEBYSHEV){
+		chebyshevRangeTransformPLCP(lowBound, upBound, &alpha, &beta);
+	}else{
+		alpha 	  = 1 / bound;
+		beta 	  = 0;
+		numStages = parseSignStagesPLCP(res->stages, stages, maxSignStages);
+		if(numStages < 0)
+			return;
+	}
+
+	// Encode the Chebyshev constants (each slot holds a sample, thus, the constants are the same in all slots)
+	int chebDeg = isMax ? smd->chebDegEq8 : smd->chebDegEq9;
+	Plaintext one_PL, firstTerm_PL, alpha_PL;
+	vector<Plaintext> coeffs_PL(chebDeg + 1);
+	if(res->backend == CUSUM_APPX_CHEBYSHEV){
+		encoderPtr->encode(1.0, scale, one_PL);
+		encoderPtr->encode(isMax ? smd->eq8maxAppx_PS_Coeff_D12_y_10_u_2[0][0] : smd->eq9ISubAppx_PS_Coeff_D12_y_10_u_2[0][0], scale, firstTerm_PL);
+		preparePwSrCoeffVec(&coeffs_PL, smd, chebDeg + 1, 1, scale, decryptorPtr, encoderPtr, isMax);
+	}
+	encoderPtr->encode(alpha, scale, alpha_PL);
+
+	// Encrypt the samples
+	Plaintext input_PL;
+	Ciphertext input_CP, output_CP;
+	encoderPtr->encode(*inputVec, scale, input_PL);
+	encryptorPtr->encrypt(input_PL, input_CP);
+	int inputChainIndex = (*contextPtr->get_context_data(input_CP.parms_id())).chain_index();
+
+	// Evaluate the backend (the constants are adjusted in place by the evaluation, thus, each repetition takes fresh copies outside the measurement)
+	double totalTime = 0;
+	try{
+		for(int r = 0; r < numReps; r++){
+			Plaintext oneCopy_PL = one_PL, firstTermCopy_PL = firstTerm_PL, alphaCopy_PL = alpha_PL;
+			vector<Plaintext> coeffsCopy_PL = coeffs_PL;
+			Ciphertext transformed_CP;
+			clock_t st_Appx_Start = clock();
+			evaluatorPtr->multiply_plain(input_CP, alphaCopy_PL, transformed_CP);
+			evaluatorPtr->rescale_to_next_inplace(transformed_CP);
+			if(res->backend == CUSUM_APPX_CHEBYSHEV){
+				Plaintext beta_PL;
+				encoderPtr->encode(beta, transformed_CP.parms_id(), transformed_CP.scale(), beta_PL);
+				evaluatorPtr->sub_plain_inplace(transformed_CP, beta_PL);
+				// The MRP struct is not read by the evaluation
+				makeChebyshevPolynAppxPLCP(NULL, &output_CP, &transformed_CP, &oneCopy_PL, &firstTermCopy_PL, &coeffsCopy_PL, chebDeg, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, decryptorPtr);
+			}else if(isMax){
+				makeCompositeMaxAppxPLCP(&output_CP, &transformed_CP, bound, stages, numStages, scale, contextPtr, evaluatorPtr, encoderPtr, relin_keysPtr);
+			}else{
+				makeCompositeIndAppxPLCP(&output_CP, &transformed_CP, stages, numStages, scale, contextPtr, evaluatorPtr, encoderPtr, relin_keysPtr);
+			}
+			totalTime += (double) (clock() - st_Appx_Start) / CLOCKS_PER_SEC;
+		}
+	}catch(const exception &e){
+		// The depth of the backend exceeds the modulus chain
+		printf("CUSUM Appx. Benchmark: Eq%d %s %s failed (%s)\n", res->equation, (res->backend == CUSUM_APPX_CHEBYSHEV) ? "chebyshev" : "composite", res->stages, e.what());
+		return;
+	}
+	res->isCompleted 	= true;
+	res->evalTime 		= totalTime / numReps;
+	res->levelsConsumed = inputChainIndex - (*contextPtr->get_context_data(output_CP.parms_id())).chain_index();
+
+	// Compare with the exact function
+	Plaintext output_PL;
+	vector<double> outputVec;
+	decryptorPtr->decrypt(output_CP, output_PL);
+	encoderPtr->decode(output_PL, outputVec);
+	double sumSqError 	 = 0;
+	long numAgreements 	 = 0;
+	res->maxError 		 = 0;
+	res->maxErrorOutside = 0;
+	for(size_t i = 0; i < inputVec->size(); i++){
+		double x 	 = inputVec->at(i);
+		double exact = isMax ? max(x, 0.0) : ((x > 0) ? 1.0 : 0.0);
+		double error = fabs(outputVec[i] - exact);
+		sumSqError 	+= error * error;
+		res->maxError = max(res->maxError, error);
+		if(fabs(x) >= 1)
+			res->maxErrorOutside = max(res->maxErrorOutside, error);
+		// The alarm rule of applyEquation_10_PLCP
+		if(((round(outputVec[i]) > 0.4) ? 1.0 : 0.0) == exact)
+			numAgreements++;
+	}
+	res->rmsError 		= sqrt(sumSqError / inputVec->size());
+	res->alarmAgreement = isMax ? -1 : (double) numAgreements / inputVec->size();
+}
+
+/*
+	The function for printing a benchmark result as a CSV line
+*/
+void printAppxBenchmarkResultPLCP(struct appxBenchmarkResultPLCP *res){
+	const char *backendName = (res->backend == CUSUM_APPX_CHEBYSHEV) ? "chebyshev" : "composite";
+	if(!res->isCompleted){
+		printf("%d,%s,%s,-,-,-,-,-,-\n", res->equation, backendName, res->stages);
+		return;
+	}
+	printf("%d,%s,%s,%d,%f,%.3e,%.3e,%.3e,", res->equation, backendName, res->stages, res->levelsConsumed, res->evalTime, res->maxError, res->rmsError, res->maxErrorOutside);
+	if(res->alarmAgreement < 0)
+		printf("-\n");
+	else
+		printf("%f\n", res->alarmAgreement);
+}
+
+/*
+	The function for running the benchmark of the approximation backends with the parameters of the run configuration
+*/
+void example_cusum_appx_benchmark(){
+
+	// Print the introduction banner
+	print_example_banner("Example: CUSUM Approximation Backends (Chebyshev vs. Composite Sign)");
+
+	// Create the CKKS context and the keys with the parameters of the run configuration (i.e., ckks_encoder_modify_matrix_row_packing_functional)
+	struct runConfigPLCP *cfg = currentRunConfigPLCP();
+	EncryptionParameters parms(scheme_type::ckks);
+	size_t poly_modulus_degree = cfg->polyModulusDegree;
+	parms.set_poly_modulus_degree(poly_modulus_degree);
+	vector<int> coeffModulusBitSizes(cfg->numMiddlePrimes + 2, cfg->bitSizeParam);
+	coeffModulusBitSizes.front() = cfg->specialBitSize;
+	coeffModulusBitSizes.back()  = cfg->specialBitSize;
+	parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, coeffModulusBitSizes));
+	SEALContext context(parms);
+	if(!context.parameters_set()){
+		printf("Invalid Encryption Parameters: %d-bit coefficient modulus for the polynomial modulus degree %zu (at most %d bits)\n",
+			cfg->specialBitSize * 2 + cfg->numMiddlePrimes * cfg->bitSizeParam, poly_modulus_degree, CoeffModulus::MaxBitCount(poly_modulus_degree));
+		return;
+	}
+	KeyGenerator keygen(context);
+	SecretKey secret_key = keygen.secret_key();
+	PublicKey public_key;
+	keygen.create_public_key(public_key);
+	RelinKeys relin_keys;
+	keygen.create_relin_keys(relin_keys);
+	GaloisKeys gal_keys; // The approximations do not rotate, thus, the Galois keys are not generated
+	Encryptor encryptor(context, public_key);
+	Evaluator evaluator(context);
+	Decryptor decryptor(context, secret_key);
+	CKKSEncoder encoder(context);
+	double scale = pow(2.0, cfg->bitSizeParam);
+	int numReps  = 3;
+
+	// Read the Chebyshev coefficients of the configured degrees and intervals
+	struct simulationMatrixData * smd = (struct simulationMatrixData *) calloc(1, sizeof(struct simulationMatrixData));
+	create_SimulationMatrixData(smd);
+	assignValMatrixDatabyFileRead(smd, cfg->dataPath);
+	initRemainVec(smd);
+	assignCUSUMChebyshevAppxParams(smd);
+
+	// The candidate stage lists of the composite sign approximation (the configured ones first)
+	const char * commonStages[] = {"g1,f1", "g3,f1", "g3,f3", "g3,g3,f1"};
+	size_t numCommonStages 		= sizeof(commonStages) / sizeof(commonStages[0]);
+
+	// Benchmark the backends on the samples of each interval
+	printf("Equation,Backend,Stages,Levels,Time (s),Max Error,RMS Error,Max Error |x|>=1,Alarm Agreement\n");
+	for(int equation = 8; equation <= 9; equation++){
+		double lowBound 	  = (equation == 8) ? cfg->lowBoundEq8 : cfg->lowBoundEq9;
+		double upBound 		  = (equation == 8) ? cfg->upBoundEq8 : cfg->upBoundEq9;
+		const char *cfgStages = (equation == 8) ? cfg->signStagesEq8 : cfg->signStagesEq9;
+		vector<double> inputVec(encoder.slot_count());
+		for(size_t i = 0; i < inputVec.size(); i++)
+			inputVec[i] = lowBound + (upBound - lowBound) * i / (inputVec.size() - 1);
+
+		// The candidates: the Chebyshev approximation, the configured stages and the common stages
+		struct appxBenchmarkResultPLCP candidates[maxAppxBenchmarkCandidates];
+		int numCandidates = 0;
+		memset(candidates, 0, sizeof(candidates));
+		candidates[numCandidates].equation = equation;
+		candidates[numCandidates++].backend = CUSUM_APPX_CHEBYSHEV;
+		candidates[numCandidates].equation = equation;
+		candidates[numCandidates].backend  = CUSUM_APPX_COMPOSITE_SIGN;
+		snprintf(candidates[numCandidates++].stages, sizeof(candidates[0].stages), "%s", cfgStages);
+		for(size_t s = 0; s < numCommonStages && numCandidates < maxAppxBenchmarkCandidates; s++){
+			if(strcmp(commonStages[s], cfgStages) == 0)
+				continue;
+			candidates[numCandidates].equation = equation;
+			candidates[numCandidates].backend  = CUSUM_APPX_COMPOSITE_SIGN;
+			snprintf(candidates[numCandidates++].stages, sizeof(candidates[0].stages), "%s", commonStages[s]);
+		}
+		for(int c = 0; c < numCandidates; c++){
+			benchmarkCUSUMAppxPLCP(&candidates[c], smd, &inputVec, lowBound, upBound, numReps, scale, &context, &encryptor, &evaluator, &decryptor, &encoder, &relin_keys, &gal_keys);
+			printAppxBenchmarkResultPLCP(&candidates[c]);
+		}
+	}
+
+	// Release the plant data
+	free_SimulationMatrixData(smd);
+	free(smd);
+}
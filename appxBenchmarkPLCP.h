@@ -0,0 +1,55 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for benchmarking the approximation backends of the CUSUM nonlinearities (i.e., appxBenchmarkPLCP.cpp)
+						  The Chebyshev approximations and the composite sign approximations of Eq8 (max) and Eq9 (indicator) are evaluated on
+						  the same encrypted inputs sweeping the approximation intervals, and the latency, the consumed levels, the errors against
+						  the exact functions and the agreement of the rounded alarms are reported per backend.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+#ifndef APPXBENCHMARKPLCP_H
+#define APPXBENCHMARKPLCP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "encryptedAppx.h"        // The class containing the functions which does the Chebyshev approximation with different assumptions
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <vector>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Define the constants */
+#define maxAppxBenchmarkCandidates 8 // Composite sign stage lists benchmarked per equation
+
+/* Main struct for holding the measurements of an approximation backend on an equation */
+struct appxBenchmarkResultPLCP {
+	int equation;           // 8 (max) or 9 (indicator)
+	int backend;            // See cusumAppxBackendPLCP
+	char stages[64];        // The composite sign stages (empty for the Chebyshev backend)
+	bool isCompleted;       // false: the evaluation reached the end of the modulus chain
+	int levelsConsumed;     // Chain index of the input minus the chain index of the output (including the range transformation)
+	double evalTime;        // Mean latency of an evaluation (s)
+	double maxError;        // Largest absolute error against the exact function
+	double rmsError;
+	double maxErrorOutside; // Largest absolute error at |x| >= 1 (i.e., outside the transition band of the sign)
+	double alarmAgreement;  // Fraction of the rounded indicator values equal to the exact indicator (Eq9 only)
+};
+
+/* The function for benchmarking a backend on the inputs x (the exact values are max(x, 0) for Eq8 and Ind(x > 0) for Eq9) */
+void benchmarkCUSUMAppxPLCP(struct appxBenchmarkResultPLCP *res, struct simulationMatrixData *smd, vector<double> *inputVec, double lowBound, double upBound,
+	int numReps, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr,
+	RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr);
+
+/* The function for printing a benchmark result as a CSV line */
+void printAppxBenchmarkResultPLCP(struct appxBenchmarkResultPLCP *res);
+
+#endif
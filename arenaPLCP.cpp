@@ -0,0 +1,173 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the reusable Ciphertext and Plaintext buffers of the online loop
+						  The homomorphic helpers (e.g., rotateVector, the Chebyshev approximation, the equation functions) take their temporaries
+						  from the active arena and release them on return, so a buffer is only allocated when the arena has to grow (i.e., warm-up).
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "arenaPLCP.h"            // The class containing the reusable Ciphertext and Plaintext buffers of the online loop
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <vector>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* The active arena used by the homomorphic helpers */
+struct arenaPLCP *activeArenaPLCP = NULL;
+
+/*
+	The function for allocating a ciphertext with the capacity of a size-3 ciphertext (i.e., the product before the relinearization) at the first level
+*/
+Ciphertext * allocCiphertextArena(SEALContext *contextPtr){
+	return new Ciphertext(*contextPtr, contextPtr->first_parms_id(), 3);
+}
+
+/*
+	The function for allocating a plaintext with the capacity of a plaintext (i.e., in NTT form) at the first level
+*/
+Plaintext * allocPlaintextArena(SEALContext *contextPtr){
+	Plaintext * plain = new Plaintext();
+	auto firstContextData = contextPtr->first_context_data();
+	plain->reserve(firstContextData->parms().poly_modulus_degree() * firstContextData->parms().coeff_modulus().size());
+	return plain;
+}
+
+/*
+	The function for creating an arena with the given number of preallocated ciphertexts, plaintexts and ciphertext vectors
+*/
+void create_ArenaPLCP(struct arenaPLCP *arena, SEALContext *contextPtr, size_t numCiphertexts, size_t numPlaintexts, size_t numCiphertextVecs){
+
+	// Allocate the buffers once
+	arena->contextPtr 	  = contextPtr;
+	arena->ciphertexts 	  = new vector<Ciphertext *>();
+	arena->plaintexts 	  = new vector<Plaintext *>();
+	arena->ciphertextVecs = new vector<vector<Ciphertext> *>();
+	for(size_t i = 0; i < numCiphertexts; i++)
+		arena->ciphertexts->push_back(allocCiphertextArena(contextPtr));
+	for(size_t i = 0; i < numPlaintexts; i++)
+		arena->plaintexts->push_back(allocPlaintextArena(contextPtr));
+	for(size_t i = 0; i < numCiphertextVecs; i++)
+		arena->ciphertextVecs->push_back(new vector<Ciphertext>());
+
+	// Nothing is handed out yet
+	arena->numCiphertextsInUse 	  = 0;
+	arena->numPlaintextsInUse 	  = 0;
+	arena->numCiphertextVecsInUse = 0;
+	arena->numGrowths 			  = 0;
+}
+
+/*
+	The function for freeing the buffers of an arena
+*/
+void free_ArenaPLCP(struct arenaPLCP *arena){
+
+	// Free the buffers and their holders
+	for(size_t i = 0; i < arena->ciphertexts->size(); i++)
+		delete arena->ciphertexts->at(i);
+	for(size_t i = 0; i < arena->plaintexts->size(); i++)
+		delete arena->plaintexts->at(i);
+	for(size_t i = 0; i < arena->ciphertextVecs->size(); i++)
+		delete arena->ciphertextVecs->at(i);
+	delete arena->ciphertexts;
+	delete arena->plaintexts;
+	delete arena->ciphertextVecs;
+}
+
+/*
+	The function for handing out a ciphertext of the active arena (the local fallback is returned if there is no active arena)
+*/
+Ciphertext * acquireCiphertextArena(Ciphertext *localFallback){
+
+	// Use the local temporary if there is no active arena
+	if(activeArenaPLCP == NULL)
+		return localFallback;
+
+	// Grow the arena if all the ciphertexts are handed out
+	if(activeArenaPLCP->numCiphertextsInUse == activeArenaPLCP->ciphertexts->size()){
+		activeArenaPLCP->ciphertexts->push_back(allocCiphertextArena(activeArenaPLCP->contextPtr));
+		activeArenaPLCP->numGrowths++;
+	}
+	return activeArenaPLCP->ciphertexts->at(activeArenaPLCP->numCiphertextsInUse++);
+}
+
+/*
+	The function for handing out a plaintext of the active arena (the local fallback is returned if there is no active arena)
+*/
+Plaintext * acquirePlaintextArena(Plaintext *localFallback){
+
+	// Use the local temporary if there is no active arena
+	if(activeArenaPLCP == NULL)
+		return localFallback;
+
+	// Grow the arena if all the plaintexts are handed out
+	if(activeArenaPLCP->numPlaintextsInUse == activeArenaPLCP->plaintexts->size()){
+		activeArenaPLCP->plaintexts->push_back(allocPlaintextArena(activeArenaPLCP->contextPtr));
+		activeArenaPLCP->numGrowths++;
+	}
+	return activeArenaPLCP->plaintexts->at(activeArenaPLCP->numPlaintextsInUse++);
+}
+
+/*
+	The function for handing out a ciphertext vector of at least the given length of the active arena (the local fallback is returned if there is no active arena)
+	Note: The vector is only extended (never shrunk), so that the ciphertexts it already holds keep their buffers
+*/
+vector<Ciphertext> * acquireCiphertextVecArena(size_t vecLength, vector<Ciphertext> *localFallback){
+
+	// Use the local temporary if there is no active arena
+	if(activeArenaPLCP == NULL){
+		localFallback->resize(vecLength);
+		return localFallback;
+	}
+
+	// Grow the arena if all the ciphertext vectors are handed out
+	if(activeArenaPLCP->numCiphertextVecsInUse == activeArenaPLCP->ciphertextVecs->size()){
+		activeArenaPLCP->ciphertextVecs->push_back(new vector<Ciphertext>());
+		activeArenaPLCP->numGrowths++;
+	}
+	vector<Ciphertext> * ciphertextVec = activeArenaPLCP->ciphertextVecs->at(activeArenaPLCP->numCiphertextVecsInUse++);
+	if(ciphertextVec->size() < vecLength){
+		ciphertextVec->resize(vecLength);
+		activeArenaPLCP->numGrowths++;
+	}
+	return ciphertextVec;
+}
+
+/*
+	The function for marking the state of the active arena
+*/
+struct arenaMarkPLCP markArenaPLCP(){
+	struct arenaMarkPLCP mark = {0, 0, 0};
+	if(activeArenaPLCP != NULL){
+		mark.numCiphertexts    = activeArenaPLCP->numCiphertextsInUse;
+		mark.numPlaintexts 	   = activeArenaPLCP->numPlaintextsInUse;
+		mark.numCiphertextVecs = activeArenaPLCP->numCiphertextVecsInUse;
+	}
+	return mark;
+}
+
+/*
+	The function for releasing the buffers of the active arena handed out after the given mark
+*/
+void releaseArenaPLCP(struct arenaMarkPLCP mark){
+	if(activeArenaPLCP != NULL){
+		activeArenaPLCP->numCiphertextsInUse 	= mark.numCiphertexts;
+		activeArenaPLCP->numPlaintextsInUse 	= mark.numPlaintexts;
+		activeArenaPLCP->numCiphertextVecsInUse = mark.numCiphertextVecs;
+	}
+}
+
+/*
+	The function for printing the usage of an arena
+*/
+void printArenaPLCP(struct arenaPLCP *arena){
+	printf("Arena Ciphertexts-Plaintexts-Ciphertext Vectors-Growths: %zu-%zu-%zu-%zu\n", arena->ciphertexts->size(), arena->plaintexts->size(), arena->ciphertextVecs->size(), arena->numGrowths);
+}
@@ -0,0 +1,72 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the reusable Ciphertext and Plaintext buffers of the online loop (i.e., arenaPLCP.cpp)
+						  The buffers are allocated once (at the first level of the modulus chain) and handed out to the temporaries of the
+						  homomorphic helpers, so that the steady-state iterations reuse the same polynomial buffers instead of allocating new ones.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+#ifndef ARENAPLCP_H
+#define ARENAPLCP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <vector>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Main struct for holding the reusable Ciphertext and Plaintext buffers (handed out and released in the stack order) */
+struct arenaPLCP {
+	vector<Ciphertext *> 		  *ciphertexts;    // Reusable ciphertexts (allocated with the capacity of a size-3 ciphertext at the first level)
+	vector<Plaintext *> 		  *plaintexts;     // Reusable plaintexts (allocated with the capacity of a plaintext at the first level)
+	vector<vector<Ciphertext> *>  *ciphertextVecs; // Reusable ciphertext vectors (e.g., the Chebyshev polynomials)
+	size_t numCiphertextsInUse;                    // Number of the ciphertexts handed out
+	size_t numPlaintextsInUse;                     // Number of the plaintexts handed out
+	size_t numCiphertextVecsInUse;                 // Number of the ciphertext vectors handed out
+	size_t numGrowths;                             // Number of the buffers allocated after the creation (i.e., zero in the steady state)
+	SEALContext *contextPtr;                       // The context used for the buffer capacities
+};
+
+/* Main struct for holding the state of an arena to be restored (i.e., the buffers handed out after the mark are released together) */
+struct arenaMarkPLCP {
+	size_t numCiphertexts;
+	size_t numPlaintexts;
+	size_t numCiphertextVecs;
+};
+
+/* The active arena used by the homomorphic helpers (NULL: the helpers use their own local temporaries) */
+extern struct arenaPLCP *activeArenaPLCP;
+
+/* The function for creating an arena with the given number of preallocated ciphertexts, plaintexts and ciphertext vectors */
+void create_ArenaPLCP(struct arenaPLCP *arena, SEALContext *contextPtr, size_t numCiphertexts, size_t numPlaintexts, size_t numCiphertextVecs);
+
+/* The function for freeing the buffers of an arena */
+void free_ArenaPLCP(struct arenaPLCP *arena);
+
+/* The function for handing out a ciphertext of the active arena (the local fallback is returned if there is no active arena) */
+Ciphertext * acquireCiphertextArena(Ciphertext *localFallback);
+
+/* The function for handing out a plaintext of the active arena (the local fallback is returned if there is no active arena) */
+Plaintext * acquirePlaintextArena(Plaintext *localFallback);
+
+/* The function for handing out a ciphertext vector of at least the given length of the active arena (the local fallback is returned if there is no active arena) */
+vector<Ciphertext> * acquireCiphertextVecArena(size_t vecLength, vector<Ciphertext> *localFallback);
+
+/* The function for marking the state of the active arena */
+struct arenaMarkPLCP markArenaPLCP();
+
+/* The function for releasing the buffers of the active arena handed out after the given mark */
+void releaseArenaPLCP(struct arenaMarkPLCP mark);
+
+/* The function for printing the usage of an arena */
+void printArenaPLCP(struct arenaPLCP *arena);
+
+#endif
@@ -0,0 +1,334 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the encrypted state checkpoints of the online loop
+						  The online loop only copies the state into the snapshot (i.e., a few ciphertext copies), whereas the compressed serialization
+						  and the file writing run on the writer thread. The state file is written under a temporary name, synced to the disk and renamed
+						  afterwards (followed by the sync of the directory), so a crash or a power loss while writing keeps the previous checkpoint intact.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "checkpointPLCP.h"       // The class containing the encrypted state checkpoints of the online loop
+
+/* Import the important selected C libraries*/
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Define the constants */
+#define checkpointPathLength 512
+#define checkpointMagic "PADCKPT1" // The first bytes of a state file (8 characters)
+
+/*
+	The function for building the path of a file in the checkpoint directory
+*/
+void checkpointFilePath(char *path, const char *dirPath, const char *fileName){
+	snprintf(path, checkpointPathLength, "%s/%s", dirPath, fileName);
+}
+
+/*
+	The function for flushing a file or a directory to the disk (false if it could not be opened or synced)
+*/
+bool syncPathCheckpointPLCP(const char *path){
+	int fd = open(path, O_RDONLY);
+	if(fd < 0)
+		return false;
+	bool isSynced = (fsync(fd) == 0);
+	close(fd);
+	return isSynced;
+}
+
+/*
+	The function for saving the encryption parameters and the public and evaluation keys into the checkpoint directory (once per key generation)
+	Note: The secret key is not stored here, the checkpoint directory only holds what the cloud is allowed to see (see saveSecretKeyStorePLCP)
+*/
+bool saveKeysCheckpointPLCP(const char *dirPath, EncryptionParameters *parmsPtr, PublicKey *public_keyPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr){
+
+	// Create the directory and the files
+	char path[checkpointPathLength];
+	mkdir(dirPath, 0755);
+	checkpointFilePath(path, dirPath, "parms.bin");
+	ofstream parmsStream(path, ios::binary | ios::trunc);
+	checkpointFilePath(path, dirPath, "public.key");
+	ofstream publicStream(path, ios::binary | ios::trunc);
+	checkpointFilePath(path, dirPath, "relin.key");
+	ofstream relinStream(path, ios::binary | ios::trunc);
+	checkpointFilePath(path, dirPath, "galois.key");
+	ofstream galoisStream(path, ios::binary | ios::trunc);
+	if(!parmsStream || !publicStream || !relinStream || !galoisStream){
+		printf("Checkpoint: the keys could not be saved into %s\n", dirPath);
+		return false;
+	}
+
+	// Save the encryption parameters and the keys with the default compression
+	streamoff numBytes = parmsPtr->save(parmsStream);
+	numBytes += public_keyPtr->save(publicStream);
+	numBytes += relin_keysPtr->save(relinStream);
+	numBytes += gal_keysPtr->save(galoisStream);
+	printf("Checkpoint: the public and evaluation keys are saved into %s (%lld bytes)\n", dirPath, (long long) numBytes);
+	return true;
+}
+
+/*
+	The function for saving the secret key into the key store (owner-only permissions, false if the key store is the checkpoint directory)
+	Note: The key store is opt-in, without it a checkpoint cannot be resumed since its state is only decryptable with the secret key
+*/
+bool saveSecretKeyStorePLCP(const char *keyStoreDir, const char *dirPath, SecretKey *secret_keyPtr){
+
+	// The secret key must not sit next to the encrypted state
+	char path[checkpointPathLength], checkpointPath[checkpointPathLength];
+	if(realpath(dirPath, checkpointPath) != NULL && realpath(keyStoreDir, path) != NULL && strcmp(path, checkpointPath) == 0){
+		printf("Checkpoint: the key store %s is the checkpoint directory, the secret key is not saved\n", keyStoreDir);
+		return false;
+	}
+
+	// Create the owner-only directory and file before writing the key
+	mkdir(keyStoreDir, 0700);
+	checkpointFilePath(path, keyStoreDir, "secret.key");
+	ofstream secretStream(path, ios::binary | ios::trunc);
+	if(!secretStream || chmod(path, 0600) != 0){
+		printf("Checkpoint: the secret key could not be saved into %s\n", keyStoreDir);
+		return false;
+	}
+	streamoff numBytes = secret_keyPtr->save(secretStream);
+	printf("Checkpoint: the secret key is saved into the key store %s (%lld bytes)\n", keyStoreDir, (long long) numBytes);
+	return true;
+}
+
+/*
+	The function for loading the stored keys (false if they are missing or were generated for different encryption parameters)
+*/
+bool loadKeysCheckpointPLCP(const char *dirPath, const char *keyStoreDir, EncryptionParameters *parmsPtr, SEALContext *contextPtr, SecretKey *secret_keyPtr, PublicKey *public_keyPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr){
+
+	// The state is only decryptable with the secret key of the key store
+	if(keyStoreDir == NULL || keyStoreDir[0] == '\0'){
+		printf("Checkpoint: no key store is configured, the checkpoint in %s cannot be resumed\n", dirPath);
+		return false;
+	}
+
+	// Open the files
+	char path[checkpointPathLength];
+	checkpointFilePath(path, dirPath, "parms.bin");
+	ifstream parmsStream(path, ios::binary);
+	checkpointFilePath(path, keyStoreDir, "secret.key");
+	ifstream secretStream(path, ios::binary);
+	checkpointFilePath(path, dirPath, "public.key");
+	ifstream publicStream(path, ios::binary);
+	checkpointFilePath(path, dirPath, "relin.key");
+	ifstream relinStream(path, ios::binary);
+	checkpointFilePath(path, dirPath, "galois.key");
+	ifstream galoisStream(path, ios::binary);
+	if(!parmsStream || !secretStream || !publicStream || !relinStream || !galoisStream){
+		printf("Checkpoint: no stored keys in %s and the key store %s\n", dirPath, keyStoreDir);
+		return false;
+	}
+
+	// The keys are only valid for the encryption parameters they were generated for
+	try{
+		EncryptionParameters storedParms;
+		storedParms.load(parmsStream);
+		if(!(storedParms == *parmsPtr)){
+			printf("Checkpoint: the stored keys in %s belong to different encryption parameters\n", dirPath);
+			return false;
+		}
+		secret_keyPtr->load(*contextPtr, secretStream);
+		public_keyPtr->load(*contextPtr, publicStream);
+		relin_keysPtr->load(*contextPtr, relinStream);
+		gal_keysPtr->load(*contextPtr, galoisStream);
+	}catch(const exception &e){
+		printf("Checkpoint: the stored keys in %s could not be loaded (%s)\n", dirPath, e.what());
+		return false;
+	}
+	printf("Checkpoint: the keys are loaded from %s (the key generation is skipped)\n", dirPath);
+	return true;
+}
+
+/*
+	The function for creating the checkpoints of the given number of states into the given directory
+*/
+void create_CheckpointPLCP(struct checkpointPLCP *cp, const char *dirPath, int interval, int n){
+
+	// Assign the settings and create the directory
+	cp->dirPath  = dirPath;
+	cp->interval = interval;
+	cp->n 		 = n;
+	mkdir(dirPath, 0755);
+
+	// Allocate the snapshot and the writer flags
+	cp->xexeSnap 		  = new Ciphertext();
+	cp->ssSnap 			  = new Ciphertext();
+	cp->xxSnap 			  = (double *) calloc(n, sizeof(double));
+	cp->nextIter 		  = 0;
+	cp->xeLevelBudget 	  = -1;
+	cp->numSkippedRefresh = 0;
+	cp->writer 			  = NULL;
+	cp->isWriting 		  = new atomic<bool>(false);
+	cp->numWritten 		  = 0;
+	cp->numSkippedBusy 	  = 0;
+	cp->lastBytes 		  = new atomic<size_t>(0);
+	cp->hasFailed 		  = new atomic<bool>(false);
+}
+
+/*
+	The function for waiting for the last writer to finish
+*/
+void waitCheckpointPLCP(struct checkpointPLCP *cp){
+	if(cp->writer != NULL){
+		cp->writer->join();
+		delete cp->writer;
+		cp->writer = NULL;
+	}
+}
+
+/*
+	The function for waiting for the last writer and freeing the snapshot
+*/
+void free_CheckpointPLCP(struct checkpointPLCP *cp){
+	waitCheckpointPLCP(cp);
+	delete cp->xexeSnap;
+	delete cp->ssSnap;
+	free(cp->xxSnap);
+	delete cp->isWriting;
+	delete cp->lastBytes;
+	delete cp->hasFailed;
+}
+
+/*
+	The function for writing the snapshot into the state file (run on the writer thread)
+*/
+void writeStateCheckpointPLCP(struct checkpointPLCP *cp){
+
+	// Write the header, the plant state and the compressed ciphertexts into the temporary file
+	char tmpPath[checkpointPathLength], path[checkpointPathLength];
+	checkpointFilePath(tmpPath, cp->dirPath, "state.ckpt.tmp");
+	checkpointFilePath(path, cp->dirPath, "state.ckpt");
+	ofstream stateStream(tmpPath, ios::binary | ios::trunc);
+	size_t numBytes = 0;
+	bool isSaved 	= true;
+	try{
+		stateStream.write(checkpointMagic, 8);
+		stateStream.write((char *) &cp->nextIter, sizeof(int));
+		stateStream.write((char *) &cp->xeLevelBudget, sizeof(int));
+		stateStream.write((char *) &cp->numSkippedRefresh, sizeof(int));
+		stateStream.write((char *) &cp->n, sizeof(int));
+		stateStream.write((char *) cp->xxSnap, cp->n * sizeof(double));
+		cp->xexeSnap->save(stateStream);
+		cp->ssSnap->save(stateStream);
+		numBytes = (size_t) stateStream.tellp();
+	}catch(const exception &e){
+		isSaved = false; // The serialization throws if the stream fails (e.g., the disk is full)
+	}
+	stateStream.close();
+
+	// Replace the previous checkpoint only after the new one is on the disk (the sync of the directory makes the rename durable)
+	if(!isSaved || !stateStream || !syncPathCheckpointPLCP(tmpPath) || rename(tmpPath, path) != 0 || !syncPathCheckpointPLCP(cp->dirPath))
+		cp->hasFailed->store(true, memory_order_relaxed);
+	else
+		cp->lastBytes->store(numBytes, memory_order_relaxed);
+	cp->isWriting->store(false, memory_order_release);
+}
+
+/*
+	The function for snapshotting the recurrent state and writing it in the background (false if the previous checkpoint is still being written)
+	Note: A busy writer means that the serialization is slower than the checkpoint interval, the checkpoint is skipped instead of stalling the loop
+*/
+bool scheduleCheckpointPLCP(struct checkpointPLCP *cp, int nextIter, Ciphertext *xexe_CP, Ciphertext *ss_CP, double **xx, int xeLevelBudget, int numSkippedRefresh){
+
+	// Skip the checkpoint if the previous one is still being written
+	if(cp->isWriting->load(memory_order_acquire)){
+		cp->numSkippedBusy++;
+		return false;
+	}
+	waitCheckpointPLCP(cp);
+
+	// Snapshot the state (the online loop keeps updating its own ciphertexts)
+	*cp->xexeSnap = *xexe_CP;
+	*cp->ssSnap   = *ss_CP;
+	for(int i = 0; i < cp->n; i++)
+		cp->xxSnap[i] = xx[i][0];
+	cp->nextIter 		  = nextIter;
+	cp->xeLevelBudget 	  = xeLevelBudget;
+	cp->numSkippedRefresh = numSkippedRefresh;
+
+	// Start the writer
+	cp->isWriting->store(true, memory_order_relaxed);
+	cp->writer = new thread(writeStateCheckpointPLCP, cp);
+	cp->numWritten++;
+	return true;
+}
+
+/*
+	The function for loading the recurrent state of the last checkpoint (false if there is no valid checkpoint)
+*/
+bool loadStateCheckpointPLCP(const char *dirPath, SEALContext *contextPtr, int *nextIter, Ciphertext *xexe_CP, Ciphertext *ss_CP, double **xx, int n, int *xeLevelBudget, int *numSkippedRefresh){
+
+	// Open the state file and check the header
+	char path[checkpointPathLength];
+	checkpointFilePath(path, dirPath, "state.ckpt");
+	ifstream stateStream(path, ios::binary);
+	if(!stateStream){
+		printf("Checkpoint: no state file in %s\n", dirPath);
+		return false;
+	}
+	char magic[8];
+	int storedIter = 0, storedBudget = -1, storedSkipped = 0, storedN = 0;
+	stateStream.read(magic, 8);
+	stateStream.read((char *) &storedIter, sizeof(int));
+	stateStream.read((char *) &storedBudget, sizeof(int));
+	stateStream.read((char *) &storedSkipped, sizeof(int));
+	stateStream.read((char *) &storedN, sizeof(int));
+	if(!stateStream || memcmp(magic, checkpointMagic, 8) != 0 || storedN != n){
+		printf("Checkpoint: the state file %s does not match the plant (n = %d)\n", path, n);
+		return false;
+	}
+
+	// Read the plant state and the ciphertexts into the temporaries (the ciphertexts are checked against the context)
+	// Note: The live state is only assigned after every read succeeded, so that a truncated or corrupt file leaves the loop at its initial state
+	vector<double> xxStored(n);
+	stateStream.read((char *) xxStored.data(), n * sizeof(double));
+	if(!stateStream){
+		printf("Checkpoint: the state file %s is truncated\n", path);
+		return false;
+	}
+	Ciphertext xexeStored, ssStored;
+	try{
+		xexeStored.load(*contextPtr, stateStream);
+		ssStored.load(*contextPtr, stateStream);
+	}catch(const exception &e){
+		printf("Checkpoint: the state file %s could not be loaded (%s)\n", path, e.what());
+		return false;
+	}
+	// Restore the ciphertexts, the plant state and the loop counters
+	*xexe_CP = xexeStored;
+	*ss_CP 	 = ssStored;
+	for(int i = 0; i < n; i++)
+		xx[i][0] = xxStored[i];
+	*nextIter 		   = storedIter;
+	*xeLevelBudget 	   = storedBudget;
+	*numSkippedRefresh = storedSkipped;
+	return true;
+}
+
+/*
+	The function for printing the checkpoint statistics
+*/
+void printCheckpointPLCP(struct checkpointPLCP *cp){
+	printf("Checkpoint: Written %zu, Skipped (Writer Busy) %zu, Last State File %zu bytes, Last Resume Iteration %d%s\n",
+		cp->numWritten, cp->numSkippedBusy, cp->lastBytes->load(memory_order_relaxed), cp->nextIter,
+		cp->hasFailed->load(memory_order_relaxed) ? ", a state file could not be written" : "");
+}
@@ -0,0 +1,87 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the encrypted state checkpoints of the online loop (i.e., checkpointPLCP.cpp)
+						  The recurrent state (i.e., x^e[k], s[k], the next iteration index and the plant state x[k]) is snapshotted every interval
+						  iterations and written by a background thread with the compressed SEAL serialization. The public and the evaluation keys are
+						  stored once next to the state, whereas the secret key is only stored into a separate key store if one is configured, so that
+						  a restarted process with access to the key store loads them instead of the key generation and resumes at the iteration after
+						  the last checkpoint.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+#ifndef CHECKPOINTPLCP_H
+#define CHECKPOINTPLCP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+
+/* Import the important selected C libraries*/
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Main struct for holding the snapshot and the background writer of the checkpoints */
+struct checkpointPLCP {
+	const char * dirPath;           // The checkpoint directory (the keys and the state file)
+	int interval;                   // Iterations between the checkpoints
+	int n;                          // Number of the states (i.e., the entries of x[k])
+	// The snapshot handed to the writer (only touched by the writer while isWriting is set)
+	Ciphertext * xexeSnap;          // x^e[k] in MRP
+	Ciphertext * ssSnap;            // s[k] in MRP
+	double * xxSnap;                // x[k] of the plant [n]
+	int nextIter;                   // The iteration to be run after the resume
+	int xeLevelBudget;              // The measured level budget of the replicated x^e (-1: not measured yet)
+	int numSkippedRefresh;          // The skipped x^e refreshes so far
+	// The background writer
+	thread * writer;                // The writer thread of the last checkpoint (NULL: none started)
+	atomic<bool> * isWriting;       // The writer is serializing the snapshot
+	// Statistics
+	size_t numWritten;              // Number of the scheduled checkpoints
+	size_t numSkippedBusy;          // Number of the checkpoints skipped since the previous one was still being written
+	atomic<size_t> * lastBytes;     // Size of the last written state file
+	atomic<bool> * hasFailed;       // A state file could not be written
+};
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Keys ===========================
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+/* The function for saving the encryption parameters and the public and evaluation keys into the checkpoint directory (once per key generation) */
+bool saveKeysCheckpointPLCP(const char *dirPath, EncryptionParameters *parmsPtr, PublicKey *public_keyPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr);
+
+/* The function for saving the secret key into the key store (owner-only permissions, false if the key store is the checkpoint directory) */
+bool saveSecretKeyStorePLCP(const char *keyStoreDir, const char *dirPath, SecretKey *secret_keyPtr);
+
+/* The function for loading the stored keys (false if they are missing, the key store is not given or they were generated for different encryption parameters) */
+bool loadKeysCheckpointPLCP(const char *dirPath, const char *keyStoreDir, EncryptionParameters *parmsPtr, SEALContext *contextPtr, SecretKey *secret_keyPtr, PublicKey *public_keyPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr);
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the State ==========================
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+/* The function for creating the checkpoints of the given number of states into the given directory */
+void create_CheckpointPLCP(struct checkpointPLCP *cp, const char *dirPath, int interval, int n);
+
+/* The function for waiting for the last writer to finish */
+void waitCheckpointPLCP(struct checkpointPLCP *cp);
+
+/* The function for waiting for the last writer and freeing the snapshot */
+void free_CheckpointPLCP(struct checkpointPLCP *cp);
+
+/* The function for snapshotting the recurrent state and writing it in the background (false if the previous checkpoint is still being written) */
+bool scheduleCheckpointPLCP(struct checkpointPLCP *cp, int nextIter, Ciphertext *xexe_CP, Ciphertext *ss_CP, double **xx, int xeLevelBudget, int numSkippedRefresh);
+
+/* The function for loading the recurrent state of the last checkpoint (false if there is no valid checkpoint) */
+bool loadStateCheckpointPLCP(const char *dirPath, SEALContext *contextPtr, int *nextIter, Ciphertext *xexe_CP, Ciphertext *ss_CP, double **xx, int n, int *xeLevelBudget, int *numSkippedRefresh);
+
+/* The function for printing the checkpoint statistics */
+void printCheckpointPLCP(struct checkpointPLCP *cp);
+
+#endif
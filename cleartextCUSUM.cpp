@@ -0,0 +1,404 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the vectorized cleartext CUSUM detector engine.
+						  It is the fast cleartext baseline (i.e., the ground truth) of the crypto application and it is used for
+						  tuning the tau and v thresholds on the replayed noise traces.
+	Note				: The iteration semantics follow encodersplain.cpp and applyPLCPSimulation.cpp exactly, except that
+						  the max and indicator functions are computed exactly (no Chebyshev approximation)
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "cleartextCUSUM.h"       // The class containing the vectorized cleartext CUSUM detector engine
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <vector>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Call main namespaces */
+using namespace std;
+
+/* Define the number of the recorded noise rows (see assignValMatrixDatabyFileRead) */
+#define numNoiseRecords 201
+
+/*
+	The function for performing the batched matrix-vector multiplication, i.e., out(:, b) (+)= M * v(:, b) for each trace b
+	Note: The innermost loop runs over the contiguous traces, thus it is vectorized
+*/
+static void batchMatVecMult(double * __restrict out, const double * __restrict M, const double * __restrict v, int rowDm, int colDm, int batchSize, bool accumulate){
+
+	for(int i = 0; i < rowDm; i++){
+		double * __restrict outRow = out + (size_t) i * batchSize;
+		if(!accumulate)
+			for(int b = 0; b < batchSize; b++)
+				outRow[b] = 0;
+		for(int j = 0; j < colDm; j++){
+			const double mij = M[(size_t) i * colDm + j];
+			const double * __restrict vRow = v + (size_t) j * batchSize;
+			for(int b = 0; b < batchSize; b++)
+				outRow[b] += mij * vRow[b];
+		}
+	}
+}
+
+/*
+	The function for adding a (trace-independent) constant vector to each trace, i.e., out(:, b) += c
+*/
+static void batchAddConstVec(double * __restrict out, const double * __restrict c, int rowDm, int batchSize){
+
+	for(int i = 0; i < rowDm; i++){
+		double * __restrict outRow = out + (size_t) i * batchSize;
+		const double ci = c[i];
+		for(int b = 0; b < batchSize; b++)
+			outRow[b] += ci;
+	}
+}
+
+/*
+	The function for flattening a simulation matrix (double **) into a row-major array
+*/
+static double * flattenMatrix(double ** mat, int rowDm, int colDm){
+
+	double * flat = (double *) calloc((size_t) rowDm * colDm, sizeof(double));
+	for(int i = 0; i < rowDm; i++)
+		for(int j = 0; j < colDm; j++)
+			flat[(size_t) i * colDm + j] = mat[i][j];
+	return flat;
+}
+
+/*
+	The function for creating the cleartext CUSUM engine and copying the plant model loaded by assignValMatrixDatabyFileRead
+*/
+void create_CleartextCUSUMEngine(struct cleartextCUSUMEngine *cce, struct simulationMatrixData *smd, int batchSize){
+
+	// Assign the dimensions
+	cce->m 			  = smd->m;
+	cce->n 			  = smd->n;
+	cce->batchSize 	  = batchSize;
+	cce->numIter 	  = 0;
+	cce->numNoiseRows = numNoiseRecords;
+
+	// Copy the plant model (shared by all traces)
+	int m = cce->m;
+	int n = cce->n;
+	cce->AA 	  = flattenMatrix(smd->AA, n, n);
+	cce->BB 	  = flattenMatrix(smd->BB, n, m);
+	cce->GAMMA 	  = flattenMatrix(smd->GAMMA, n, n);
+	cce->LL 	  = flattenMatrix(smd->LL, n, n);
+	cce->ACL 	  = flattenMatrix(smd->ACL, n, n);
+	cce->KGKG 	  = flattenMatrix(smd->KGKG, m, n);
+	cce->KLKL 	  = flattenMatrix(smd->KLKL, m, n);
+	cce->xGxG 	  = flattenMatrix(smd->xGxG, n, 1);
+	cce->KxuGKxuG = flattenMatrix(smd->KxuGKxuG, m, 1);
+	cce->KxKx 	  = flattenMatrix(smd->KxKx, m, 1);
+	cce->uGuG 	  = flattenMatrix(smd->uGuG, m, 1);
+	cce->x0 	  = flattenMatrix(smd->xx, n, 1);
+	// Precompute B*uΓ which does not change over the iterations (2nd part of Equation 4-5)
+	cce->BuG 	  = (double *) calloc(n, sizeof(double));
+	for(int i = 0; i < n; i++)
+		for(int j = 0; j < m; j++)
+			cce->BuG[i] += smd->BB[i][j] * smd->uGuG[j][0];
+
+	// Create the batched state buffers
+	size_t nB = (size_t) n * batchSize;
+	size_t mB = (size_t) m * batchSize;
+	cce->xx 	= (double *) calloc(nB, sizeof(double));
+	cce->xexe 	= (double *) calloc(nB, sizeof(double));
+	cce->xeNew 	= (double *) calloc(nB, sizeof(double));
+	cce->xpxp 	= (double *) calloc(nB, sizeof(double));
+	cce->yy 	= (double *) calloc(nB, sizeof(double));
+	cce->uu 	= (double *) calloc(mB, sizeof(double));
+	cce->rr 	= (double *) calloc(nB, sizeof(double));
+	cce->sBar 	= (double *) calloc(nB, sizeof(double));
+	cce->ss 	= (double *) calloc(nB, sizeof(double));
+	cce->alarm 	= (double *) calloc(nB, sizeof(double));
+	cce->TAU 	= (double *) calloc(nB, sizeof(double));
+	cce->vv 	= (double *) calloc(nB, sizeof(double));
+	cce->AxBu 	= (double *) calloc(nB, sizeof(double));
+	cce->yNoise = (double *) calloc(nB, sizeof(double));
+	cce->xNoise = (double *) calloc(nB, sizeof(double));
+	cce->alarmCount 	= (long *) calloc(batchSize, sizeof(long));
+	cce->firstAlarmIter = (long *) calloc(batchSize, sizeof(long));
+
+	// Assign the one-time attack of sense_Encrypt_y (i.e., +4 on the 5th sensor when 79 < k - 1 < 82)
+	cce->attackState 	 = 4;
+	cce->attackStart 	 = 81;
+	cce->attackEnd 		 = 82;
+	cce->attackMagnitude = 4;
+
+	// Initialize the states and the thresholds
+	initCleartextCUSUMEngine(cce, smd);
+}
+
+/*
+	The function for (re)initializing the batched states (x = x^e = x^p = x0, s = 0) and the thresholds of all traces from the simulation data
+*/
+void initCleartextCUSUMEngine(struct cleartextCUSUMEngine *cce, struct simulationMatrixData *smd){
+
+	int B = cce->batchSize;
+	for(int i = 0; i < cce->n; i++){
+		for(int b = 0; b < B; b++){
+			size_t ind = (size_t) i * B + b;
+			cce->xx[ind] 	= cce->x0[i];
+			cce->xexe[ind] 	= cce->x0[i];
+			cce->xpxp[ind] 	= cce->x0[i];
+			cce->ss[ind] 	= 0;
+			cce->alarm[ind] = 0;
+			cce->TAU[ind] 	= smd->TAU[i][0];
+			cce->vv[ind] 	= smd->vv[i][0];
+		}
+	}
+	for(int b = 0; b < B; b++){
+		cce->alarmCount[b] 	   = 0;
+		cce->firstAlarmIter[b] = -1;
+	}
+	cce->numIter = 0;
+}
+
+/*
+	The function for assigning the CUSUM thresholds (tau and v) of a single trace by scaling the recorded thresholds
+*/
+void assignCleartextCUSUMThresholds(struct cleartextCUSUMEngine *cce, struct simulationMatrixData *smd, int traceInd, double tauScale, double vScale){
+
+	if(traceInd < 0 || traceInd >= cce->batchSize){
+		printf("Invalid trace index %d for the batch size %d\n", traceInd, cce->batchSize);
+		exit(0);
+	}
+	for(int i = 0; i < cce->n; i++){
+		cce->TAU[(size_t) i * cce->batchSize + traceInd] = tauScale * smd->TAU[i][0];
+		cce->vv[(size_t) i * cce->batchSize + traceInd]  = vScale * smd->vv[i][0];
+	}
+}
+
+/*
+	The function for performing one online iteration of all traces (noise buffers are given in the batch-inner layout)
+*/
+void stepCleartextCUSUMEngine(struct cleartextCUSUMEngine *cce, double * yNoiseBatch, double * xNoiseBatch){
+
+	int m = cce->m;
+	int n = cce->n;
+	int B = cce->batchSize;
+	long k = cce->numIter;
+	size_t nB = (size_t) n * B;
+
+	// Sensor measurement: y[k] = x[k] + sensor noise (with the one-time attack)
+	for(size_t ind = 0; ind < nB; ind++)
+		cce->yy[ind] = cce->xx[ind] + yNoiseBatch[ind];
+	if(k >= cce->attackStart && k <= cce->attackEnd && cce->attackState < n){
+		double * yRow = cce->yy + (size_t) cce->attackState * B;
+		for(int b = 0; b < B; b++)
+			yRow[b] += cce->attackMagnitude;
+	}
+
+	if(k > 0){
+		// Equation 2: x̂e[k] = Γx̂e[k−1] + Ly[k] + xΓ
+		batchMatVecMult(cce->xeNew, cce->GAMMA, cce->xexe, n, n, B, false);
+		batchMatVecMult(cce->xeNew, cce->LL, cce->yy, n, n, B, true);
+		batchAddConstVec(cce->xeNew, cce->xGxG, n, B);
+		// Equation 3: u[k] = KG*x̂e[k−1] + KL*y[k] + KXUΓ
+		batchMatVecMult(cce->uu, cce->KGKG, cce->xexe, m, n, B, false);
+		batchMatVecMult(cce->uu, cce->KLKL, cce->yy, m, n, B, true);
+		batchAddConstVec(cce->uu, cce->KxuGKxuG, m, B);
+		// Equation 4-5: x̂p[k] = Acl*x̂e[k−1] + B*uΓ
+		batchMatVecMult(cce->xpxp, cce->ACL, cce->xexe, n, n, B, false);
+		batchAddConstVec(cce->xpxp, cce->BuG, n, B);
+	}
+	else {
+		// Equation 3 at the very first iteration: u[0] = uΓ + Kx
+		for(int i = 0; i < m; i++)
+			for(int b = 0; b < B; b++)
+				cce->uu[(size_t) i * B + b] = cce->uGuG[i] + cce->KxKx[i];
+	}
+
+	// Equation 6: r[k] = (y[k] - x̂p[k])^2 (x̂p = x0 at the very first iteration)
+	for(size_t ind = 0; ind < nB; ind++){
+		double res = cce->yy[ind] - cce->xpxp[ind];
+		cce->rr[ind] = res * res;
+	}
+
+	// Equation 8-9-10: s̄[k + 1] = max(r + s - v, 0), alarm[k] = Ind(s - tau), s[k + 1] = s̄[k + 1] ⊙ (1 − alarm[k])
+	for(size_t ind = 0; ind < nB; ind++){
+		double sBarVal  = cce->rr[ind] + cce->ss[ind] - cce->vv[ind];
+		sBarVal 		= sBarVal > 0 ? sBarVal : 0;
+		double alarmVal = (cce->ss[ind] - cce->TAU[ind]) > 0 ? 1 : 0;
+		cce->sBar[ind]  = sBarVal;
+		cce->alarm[ind] = alarmVal;
+		cce->ss[ind] 	= sBarVal * (1 - alarmVal);
+	}
+
+	// Update the alarm statistics of each trace
+	for(int i = 0; i < n; i++){
+		const double * alarmRow = cce->alarm + (size_t) i * B;
+		for(int b = 0; b < B; b++){
+			if(alarmRow[b] == 1){
+				cce->alarmCount[b]++;
+				if(cce->firstAlarmIter[b] < 0)
+					cce->firstAlarmIter[b] = k;
+			}
+		}
+	}
+
+	// Refresh the estimation for the next iteration (i.e., the secret share of x̂e in the crypto application)
+	if(k > 0){
+		double * tmp = cce->xexe;
+		cce->xexe 	 = cce->xeNew;
+		cce->xeNew 	 = tmp;
+	}
+
+	// Plant update: x[k + 1] = A*x[k] + B*u[k] + process noise
+	batchMatVecMult(cce->AxBu, cce->AA, cce->xx, n, n, B, false);
+	batchMatVecMult(cce->AxBu, cce->BB, cce->uu, n, m, B, true);
+	for(size_t ind = 0; ind < nB; ind++)
+		cce->xx[ind] = cce->AxBu[ind] + xNoiseBatch[ind];
+
+	cce->numIter++;
+}
+
+/*
+	The function for replaying the recorded noise traces (trace b starts at row noiseOffsets[b]) for the given number of iterations
+	Note: The 1st trace's results are recorded into the simulation data struct (as the ground truth of the crypto application) if requested
+*/
+void replayCleartextCUSUMEngine(struct cleartextCUSUMEngine *cce, struct simulationMatrixData *smd, long numSteps, int * noiseOffsets, bool recordResults){
+
+	int m = cce->m;
+	int n = cce->n;
+	int B = cce->batchSize;
+
+	for(long step = 0; step < numSteps; step++){
+		// Gather the noise rows of each trace (the recorded noise traces are replayed cyclically)
+		long k = cce->numIter;
+		for(int b = 0; b < B; b++){
+			int offset = (noiseOffsets == NULL) ? 0 : noiseOffsets[b];
+			long row   = (k + offset) % cce->numNoiseRows;
+			for(int i = 0; i < n; i++){
+				cce->yNoise[(size_t) i * B + b] = smd->yNoise[row][i];
+				cce->xNoise[(size_t) i * B + b] = smd->xNoise[row][i];
+			}
+		}
+
+		// Record the sensor measurement of the 1st trace before the iteration (i.e., x[k] + noise)
+		bool isRecorded = recordResults && k < smd->tMax;
+		if(isRecorded)
+			for(int i = 0; i < n; i++)
+				smd->x_Res[k][i] = cce->xx[(size_t) i * B];
+
+		// Apply the iteration
+		stepCleartextCUSUMEngine(cce, cce->yNoise, cce->xNoise);
+
+		// Record the experimental results of the 1st trace with the same indexing as encodersplain.cpp
+		if(isRecorded){
+			for(int i = 0; i < n; i++){
+				size_t ind = (size_t) i * B;
+				smd->y_Res[k][i] 		= cce->yy[ind];
+				smd->residue_Res[k][i]  = cce->rr[ind];
+				smd->sBar_Res[k][i] 	= cce->sBar[ind];
+				smd->alarm_Res[k][i] 	= cce->alarm[ind];
+				smd->s_Res[k + 1][i] 	= cce->ss[ind];
+				if(k > 0){
+					smd->xe_Res[k][i] = cce->xexe[ind];
+					smd->xp_Res[k][i] = cce->xpxp[ind];
+				}
+			}
+			for(int i = 0; i < m; i++)
+				smd->u_Res[k][i] = cce->uu[(size_t) i * B];
+		}
+	}
+}
+
+/*
+	The function for releasing the cleartext CUSUM engine buffers
+*/
+void free_CleartextCUSUMEngine(struct cleartextCUSUMEngine *cce){
+
+	// Release the plant model
+	free(cce->AA);
+	free(cce->BB);
+	free(cce->GAMMA);
+	free(cce->LL);
+	free(cce->ACL);
+	free(cce->KGKG);
+	free(cce->KLKL);
+	free(cce->xGxG);
+	free(cce->KxuGKxuG);
+	free(cce->KxKx);
+	free(cce->uGuG);
+	free(cce->BuG);
+	free(cce->x0);
+	// Release the batched states
+	free(cce->xx);
+	free(cce->xexe);
+	free(cce->xeNew);
+	free(cce->xpxp);
+	free(cce->yy);
+	free(cce->uu);
+	free(cce->rr);
+	free(cce->sBar);
+	free(cce->ss);
+	free(cce->alarm);
+	free(cce->AxBu);
+	free(cce->TAU);
+	free(cce->vv);
+	free(cce->yNoise);
+	free(cce->xNoise);
+	free(cce->alarmCount);
+	free(cce->firstAlarmIter);
+}
+
+/*
+	The function for running the cleartext baseline (the ground truth) and a tau/v threshold sweep on the replayed noise traces
+*/
+void example_cleartext_cusum(){
+
+	// Print the introduction banner
+	print_example_banner("Example: Cleartext CUSUM Baseline / Threshold Replay");
+
+	// Create and build the simulation data (the same plant model as the crypto application)
+	char * folderPath_y50_u10 = currentRunConfigPLCP()->dataPath; // The configured plant (default: ./all_data/y50_u10)
+	struct simulationMatrixData * smd = (struct simulationMatrixData *) calloc(1, sizeof(struct simulationMatrixData));
+	create_SimulationMatrixData(smd);
+	assignValMatrixDatabyFileRead(smd, folderPath_y50_u10);
+	initRemainVec(smd);
+
+	// Ground truth: a single trace with the recorded noise and thresholds
+	struct cleartextCUSUMEngine * cce = (struct cleartextCUSUMEngine *) calloc(1, sizeof(struct cleartextCUSUMEngine));
+	create_CleartextCUSUMEngine(cce, smd, 1);
+	replayCleartextCUSUMEngine(cce, smd, smd->tMax, NULL, true);
+	printf("Ground truth: %ld alarms, the first alarm at iteration %ld\n", cce->alarmCount[0], cce->firstAlarmIter[0]);
+	free_CleartextCUSUMEngine(cce);
+
+	// Threshold sweep: each trace has its own tau scale and noise offset
+	int batchSize 	= 64;
+	long numSteps 	= 20000;
+	int * noiseOffsets = (int *) calloc(batchSize, sizeof(int));
+	create_CleartextCUSUMEngine(cce, smd, batchSize);
+	for(int b = 0; b < batchSize; b++){
+		noiseOffsets[b] = b % cce->numNoiseRows;
+		assignCleartextCUSUMThresholds(cce, smd, b, 0.5 + (double) b / batchSize, 1);
+	}
+	cce->attackEnd = -1; // No attack during the false alarm sweep
+	clock_t st_Replay_Start = clock();
+	replayCleartextCUSUMEngine(cce, smd, numSteps, noiseOffsets, false);
+	clock_t st_Replay_End = clock();
+	double replayTime = (double) (st_Replay_End - st_Replay_Start) / CLOCKS_PER_SEC;
+
+	// Print the false alarm rate of each tau scale and the throughput
+	for(int b = 0; b < batchSize; b++)
+		printf("tau scale %.4f: false alarm rate %.8f\n", 0.5 + (double) b / batchSize, (double) cce->alarmCount[b] / ((double) numSteps * cce->n));
+	printf("Replayed %ld trace-iterations in %f s (%f iterations/s)\n", numSteps * batchSize, replayTime, (double) numSteps * batchSize / replayTime);
+
+	// Release the buffers
+	free_CleartextCUSUMEngine(cce);
+	free(cce);
+	free(noiseOffsets);
+	free_SimulationMatrixData(smd);
+	free(smd);
+}
@@ -0,0 +1,110 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: The header file of the class used for the vectorized cleartext CUSUM detector engine (i.e., cleartextCUSUM.cpp)
+						  The engine runs the exact pipeline of applyPLCPSimulation.cpp (estimation, control, prediction, residues,
+						  CUSUM with the true max/indicator functions and the plant update) on many plants/traces at once
+	Note				: The batch-inner layout (i.e., element i of trace b is stored at [i * batchSize + b]) is used,
+						  so that the innermost loops run over the traces and are vectorized by the compiler
+*/
+
+#ifndef CLEARTEXTCUSUM_H
+#define CLEARTEXTCUSUM_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <vector>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Call main namespaces */
+using namespace std;
+
+/* Main struct for holding the cleartext CUSUM detector engine */
+struct cleartextCUSUMEngine {
+
+	// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+	// ==== Dimensions and the Iteration Counter ============
+	// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+	int m;
+	int n;
+	int batchSize;    // Number of plants/traces processed at once
+	long numIter;     // Online iteration counter (i.e., k in applyPLCPSimulation.cpp)
+	int numNoiseRows; // Number of the recorded noise rows (the noise traces are replayed cyclically)
+
+	// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+	// ==== Plant Model (flat row-major, shared by traces) ==
+	// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+	double * AA;  	 	// [n][n]
+	double * BB; 	 	// [n][m]
+	double * GAMMA; 	// [n][n]
+	double * LL; 	 	// [n][n]
+	double * ACL; 	 	// [n][n]
+	double * KGKG;  	// [m][n]
+	double * KLKL;  	// [m][n]
+	double * xGxG;  	// [n]
+	double * KxuGKxuG; 	// [m]
+	double * KxKx; 	 	// [m]
+	double * uGuG; 	 	// [m]
+	double * BuG;    	// [n] B*uΓ, constant over the iterations
+	double * x0;     	// [n]
+
+	// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+	// ==== Batched States (batch-inner layout) =============
+	// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+	double * xx;    	// [n][batchSize]
+	double * xexe;  	// [n][batchSize]
+	double * xeNew; 	// [n][batchSize]
+	double * xpxp;  	// [n][batchSize]
+	double * yy;    	// [n][batchSize]
+	double * uu;    	// [m][batchSize]
+	double * rr;    	// [n][batchSize]
+	double * sBar;  	// [n][batchSize]
+	double * ss;    	// [n][batchSize]
+	double * alarm; 	// [n][batchSize]
+	double * AxBu;  	// [n][batchSize] A*x + B*u of the plant update
+	// Per-trace CUSUM thresholds (tuned independently for each trace)
+	double * TAU;   	// [n][batchSize]
+	double * vv;    	// [n][batchSize]
+	// Noise buffers of the current iteration
+	double * yNoise; 	// [n][batchSize]
+	double * xNoise; 	// [n][batchSize]
+
+	// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+	// ==== Attack Injection and Replay Statistics ==========
+	// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+	int attackState;  		// The attacked sensor index
+	int attackStart;  		// The first attacked iteration
+	int attackEnd;    		// The last attacked iteration
+	double attackMagnitude; // The value added to the attacked sensor
+	long * alarmCount;  	// [batchSize] Total number of raised alarms
+	long * firstAlarmIter; 	// [batchSize] The first iteration with an alarm (-1 if none)
+};
+
+/* The function for creating the cleartext CUSUM engine and copying the plant model loaded by assignValMatrixDatabyFileRead */
+void create_CleartextCUSUMEngine(struct cleartextCUSUMEngine *cce, struct simulationMatrixData *smd, int batchSize);
+
+/* The function for (re)initializing the batched states (x = x^e = x^p = x0, s = 0) and the thresholds of all traces from the simulation data */
+void initCleartextCUSUMEngine(struct cleartextCUSUMEngine *cce, struct simulationMatrixData *smd);
+
+/* The function for assigning the CUSUM thresholds (tau and v) of a single trace by scaling the recorded thresholds */
+void assignCleartextCUSUMThresholds(struct cleartextCUSUMEngine *cce, struct simulationMatrixData *smd, int traceInd, double tauScale, double vScale);
+
+/* The function for performing one online iteration of all traces (noise buffers are given in the batch-inner layout) */
+void stepCleartextCUSUMEngine(struct cleartextCUSUMEngine *cce, double * yNoiseBatch, double * xNoiseBatch);
+
+/* The function for replaying the recorded noise traces (trace b starts at row noiseOffsets[b]) for the given number of iterations */
+void replayCleartextCUSUMEngine(struct cleartextCUSUMEngine *cce, struct simulationMatrixData *smd, long numSteps, int * noiseOffsets, bool recordResults);
+
+/* The function for releasing the cleartext CUSUM engine buffers */
+void free_CleartextCUSUMEngine(struct cleartextCUSUMEngine *cce);
+
+#endif
@@ -0,0 +1,340 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the complex slot packing of the linear stages
+						  The model plaintexts are real, thus, the plaintext-ciphertext products, the additions and the rotations of the linear
+						  stages act on the real and the imaginary parts of the slots independently, and a packed ciphertext carries two
+						  instances through Eq2, Eq3 and Eq4-5 at the cost of one (plus a conjugation and a level for the separation).
+	Note				: The secret share refreshes, the decryptions and the CUSUM approximations decode the real parts only, so that the
+						  packed results are separated before them (the benchmark compares the packed stages with two real evaluations).
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "generateplaintextMRP.h" // The functions used to prepare plain matrices in MRP format
+#include "prepareVecMatMRP.h"     // The class which prepares the read matrices in MRP format
+#include "initializationPLCP.h"   // The class containing the functions which convert the prepared matrices to Plaintext and Ciphertext objects.
+#include "plcpOperations.h"       // The class containing the functions which does Ciphertext-Ciphertext and Plaintext-Ciphertext arithmetic and algebraic operations
+#include "applyPLCPSimulation.h"  // The class containing the crypto application functions for each targeted equation
+#include "tiledMRP.h"             // The class containing the multi-ciphertext (tiled) MRP format
+#include "complexPackingPLCP.h"   // The class containing the complex slot packing of the linear stages
+
+/* Import the important selected C libraries*/
+#include <complex>
+#include <iostream>
+#include <vector>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+	The function for encoding and encrypting two MRP vectors into the real and the imaginary parts of the slots
+*/
+void encryptComplexPairMatRowPacking(vector<double> *reVec, vector<double> *imVec, double scale, Ciphertext *ct, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr){
+
+	// z = a + i * b (the shorter vector is padded with zeros)
+	size_t numSlots = max(reVec->size(), imVec->size());
+	vector<complex<double>> packedVec(numSlots);
+	for(size_t i = 0; i < numSlots; i++)
+		packedVec[i] = complex<double>(i < reVec->size() ? reVec->at(i) : 0.0, i < imVec->size() ? imVec->at(i) : 0.0);
+
+	// Encode and encrypt at the top of the modulus chain
+	Plaintext packed_PL;
+	encoderPtr->encode(packedVec, scale, packed_PL);
+	encryptorPtr->encrypt(packed_PL, *ct);
+}
+
+/*
+	The function for separating the real and the imaginary parts of a packed ciphertext into two ciphertexts by the complex conjugation (consumes a level)
+	Note: The conjugation key is in the default Galois keys (i.e., keygen.create_galois_keys without the steps)
+*/
+void separateComplexPairPLCP(Ciphertext *re_CP, Ciphertext *im_CP, Ciphertext *packed_CP, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, GaloisKeys *gal_keysPtr){
+
+	// z̄ = a - i * b
+	Ciphertext conjugate_CP;
+	evaluatorPtr->complex_conjugate(*packed_CP, *gal_keysPtr, conjugate_CP);
+
+	// The constants 1/2 and -i/2 at the level of the packed ciphertext
+	Plaintext half_PL, minusHalfI_PL;
+	encoderPtr->encode(0.5, packed_CP->parms_id(), scale, half_PL);
+	encoderPtr->encode(complex<double>(0.0, -0.5), packed_CP->parms_id(), scale, minusHalfI_PL);
+
+	// a = (z + z̄) / 2
+	evaluatorPtr->add(*packed_CP, conjugate_CP, *re_CP);
+	evaluatorPtr->multiply_plain_inplace(*re_CP, half_PL);
+	evaluatorPtr->rescale_to_next_inplace(*re_CP);
+	re_CP->scale() = scale;
+
+	// b = (z - z̄) * (-i / 2)
+	evaluatorPtr->sub(*packed_CP, conjugate_CP, *im_CP);
+	evaluatorPtr->multiply_plain_inplace(*im_CP, minusHalfI_PL);
+	evaluatorPtr->rescale_to_next_inplace(*im_CP);
+	im_CP->scale() = scale;
+}
+
+/*
+	The function for pairing the row tiles r and r + 1 of the matrix tiles into the complex tiles M_r + i * M_r+1 (the paired layout has half the row tiles, rounded up)
+	Note: The column tiles of x are real, thus, (M_r + i * M_r+1) * x = M_r * x + i * M_r+1 * x, and the rotate-and-sum acts on both parts. A pair of zero
+		  tiles is not encoded (i.e., skipped by tiledMatrixVectorMultMRP) and the odd last row tile is paired with zeros.
+*/
+void makeComplexPairTiledPlaintextMRP(vector<vector<double>> *tiles, struct tiledLayoutMRP *tl, double scale, vector<Plaintext> *pairedTiles_PL, struct tiledLayoutMRP *pairedTl, CKKSEncoder *encoderPtr){
+
+	// The paired layout keeps the rows and the column tiles
+	*pairedTl 			  = *tl;
+	pairedTl->numRowTiles = (tl->numRowTiles + 1) / 2;
+	pairedTiles_PL->assign((size_t) pairedTl->numRowTiles * tl->numColTiles, Plaintext());
+
+	// z = M_r + i * M_r+1 per column tile
+	for(int p = 0; p < pairedTl->numRowTiles; p++){
+		for(int c = 0; c < tl->numColTiles; c++){
+			vector<double> *reTile = &tiles->at((size_t) (2 * p) * tl->numColTiles + c);
+			vector<double> *imTile = (2 * p + 1 < tl->numRowTiles) ? &tiles->at((size_t) (2 * p + 1) * tl->numColTiles + c) : NULL;
+			bool isZeroPair = true;
+			vector<complex<double>> packedTile(reTile->size());
+			for(size_t i = 0; i < reTile->size(); i++){
+				packedTile[i] = complex<double>(reTile->at(i), (imTile != NULL) ? imTile->at(i) : 0.0);
+				if(packedTile[i] != complex<double>(0.0, 0.0))
+					isZeroPair = false;
+			}
+			if(!isZeroPair)
+				encoderPtr->encode(packedTile, scale, pairedTiles_PL->at((size_t) p * tl->numColTiles + c));
+		}
+	}
+}
+
+/*
+	The function for separating the paired row tiles into the row tiles of the original layout (the odd last row tile has no imaginary part and is only mod-switched)
+*/
+void separateComplexPairTiledPLCP(vector<Ciphertext> *rowTiles_CP, vector<Ciphertext> *pairedRowTiles_CP, int numRowTiles, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, GaloisKeys *gal_keysPtr){
+	vector<Ciphertext> separated(numRowTiles);
+	for(size_t p = 0; p < pairedRowTiles_CP->size(); p++){
+		if(2 * (int) p + 1 < numRowTiles)
+			separateComplexPairPLCP(&separated[2 * p], &separated[2 * p + 1], &pairedRowTiles_CP->at(p), scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr);
+		else
+			evaluatorPtr->mod_switch_to_next(pairedRowTiles_CP->at(p), separated[2 * p]); // Keeps the row tiles at the same level
+	}
+	*rowTiles_CP = separated;
+}
+
+/*
+	The function for applying a linear stage (2: Eq2, 3: Eq3, 4: Eq4-5) on the copies of its ciphertext inputs
+	Note: The matrix-vector helpers adjust the levels and the scales of their inputs in place
+*/
+static void applyLinearStageCXP(int equation, Ciphertext *res_CP, struct simulationMatrixMRP *smrp, Plaintext *matX_PL, Plaintext *matY_PL, Ciphertext *addVec_CP,
+	Ciphertext *yy_CP, Ciphertext *xexe_CP, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr,
+	CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr){
+
+	Ciphertext xe_CP = *xexe_CP, y_CP = *yy_CP, add_CP = *addVec_CP;
+	if(equation == 2)
+		applyEquation_2_PLCP(res_CP, smrp, matX_PL, matY_PL, &add_CP, &y_CP, &xe_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
+	else if(equation == 3)
+		applyEquation_3_PLCP(res_CP, smrp, matX_PL, matY_PL, &add_CP, &y_CP, &xe_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
+	else
+		applyEquation_4_5_PLCP(res_CP, smrp, matX_PL, &add_CP, &xe_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
+}
+
+/*
+	The function for finding the largest error of the entries at i * N against the cleartext reference
+*/
+static double maxErrorMatRowPackingCXP(Ciphertext *res_CP, double *ref, int numRows, int N, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr){
+
+	Plaintext res_PL;
+	vector<double> res_Vec;
+	decryptorPtr->decrypt(*res_CP, res_PL);
+	encoderPtr->decode(res_PL, res_Vec);
+	double maxErr = 0;
+	for(int i = 0; i < numRows; i++)
+		maxErr = max(maxErr, fabs(res_Vec[(size_t) i * N] - ref[i]));
+	return maxErr;
+}
+
+/*
+	The function for running the linear stages (Eq2, Eq3, Eq4-5) of two plant instances for n = 10, 20, 50 with two real ciphertexts and with a complex packed ciphertext,
+	and comparing their timings and errors
+	Note: The second instance is the same plant at the next sampling instant (i.e., x̂e of the first instance after Eq2 and the next noisy measurement)
+*/
+void example_complex_packing_benchmark(){
+
+	// Print the introduction banner
+	print_example_banner("Example: Complex Slot Packing of the Linear Stages");
+
+	// Create the CKKS context and the keys with the parameters of the crypto application (i.e., ckks_encoder_modify_matrix_row_packing_functional)
+	EncryptionParameters parms(scheme_type::ckks);
+	size_t poly_modulus_degree = 32768;
+	int bitsizesparam 		   = 50;
+	parms.set_poly_modulus_degree(poly_modulus_degree);
+	parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, {60, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, 60}));
+	SEALContext context(parms);
+	KeyGenerator keygen(context);
+	SecretKey secret_key = keygen.secret_key();
+	PublicKey public_key;
+	keygen.create_public_key(public_key);
+	RelinKeys relin_keys;
+	keygen.create_relin_keys(relin_keys);
+	GaloisKeys gal_keys;
+	keygen.create_galois_keys(gal_keys); // Includes the conjugation key
+	Encryptor encryptor(context, public_key);
+	Evaluator evaluator(context);
+	Decryptor decryptor(context, secret_key);
+	CKKSEncoder encoder(context);
+	double scale = pow(2.0, bitsizesparam);
+	int numReps  = 10;
+
+	// Run the benchmark for each recorded plant
+	const char * folderPaths[3] = {"./all_data/y10_u2", "./all_data/y20_u4", "./all_data/y50_u10"};
+	const char * equationNames[3] = {"Eq2", "Eq3", "Eq4_5"};
+	printf("n,m,Equation,Two Real Time (s),Packed Time (s),Separation Time (s),Speedup,Max Error Real,Max Error Packed\n");
+	for(int f = 0; f < 3; f++){
+
+		// Read the plant model and prepare the MRP format
+		struct simulationMatrixData * smd = (struct simulationMatrixData *) calloc(1, sizeof(struct simulationMatrixData));
+		create_SimulationMatrixData(smd);
+		assignValMatrixDatabyFileRead(smd, folderPaths[f]);
+		initRemainVec(smd);
+		assignCUSUMChebyshevAppxParams(smd);
+		struct simulationMatrixMRP *smrp = (struct simulationMatrixMRP *) calloc(1, sizeof(struct simulationMatrixMRP));
+		create_SimulationMatrixDataMRP(smd, smrp);
+		assignValMatrixDataMRP(smd, smrp);
+		int n = smd->n, m = smd->m;
+
+		// The inputs of the two instances (A: the recorded x̂e and the first measurement, B: x̂e of A after Eq2 and the second measurement)
+		double ** xeVec[2], ** yVec[2];
+		for(int p = 0; p < 2; p++){
+			xeVec[p] = (double **) calloc(n, sizeof(double *));
+			yVec[p]  = (double **) calloc(n, sizeof(double *));
+			for(int i = 0; i < n; i++){
+				xeVec[p][i] = (double *) calloc(1, sizeof(double));
+				yVec[p][i]  = (double *) calloc(1, sizeof(double));
+				yVec[p][i][0] = smd->xx[i][0] + smd->yNoise[p][i];
+			}
+		}
+		for(int i = 0; i < n; i++)
+			xeVec[0][i][0] = smd->xexe[i][0];
+		for(int i = 0; i < n; i++){
+			xeVec[1][i][0] = smd->xGxG[i][0];
+			for(int j = 0; j < n; j++)
+				xeVec[1][i][0] += smd->GAMMA[i][j] * xeVec[0][j][0] + smd->LL[i][j] * yVec[0][j][0];
+		}
+
+		// Cleartext references: x̂e = Γx̂e + Ly + xΓ, u = KΓx̂e + KLy + KxuΓ, x̂p = Acl x̂e + BuΓ
+		int numRows[3] = {n, m, n};
+		double * ref[3][2];
+		for(int p = 0; p < 2; p++){
+			for(int e = 0; e < 3; e++)
+				ref[e][p] = (double *) calloc(n, sizeof(double));
+			for(int i = 0; i < n; i++){
+				ref[0][p][i] = smd->xGxG[i][0];
+				for(int j = 0; j < n; j++)
+					ref[0][p][i] += smd->GAMMA[i][j] * xeVec[p][j][0] + smd->LL[i][j] * yVec[p][j][0];
+			}
+			for(int i = 0; i < m; i++){
+				ref[1][p][i] = smd->KxuGKxuG[i][0];
+				for(int j = 0; j < n; j++)
+					ref[1][p][i] += smd->KGKG[i][j] * xeVec[p][j][0] + smd->KLKL[i][j] * yVec[p][j][0];
+			}
+			for(int i = 0; i < n; i++){
+				for(int j = 0; j < n; j++)
+					ref[2][p][i] += smd->ACL[i][j] * xeVec[p][j][0];
+				for(int j = 0; j < m; j++)
+					ref[2][p][i] += smd->BB[i][j] * smd->uGuG[j][0];
+			}
+		}
+
+		// The model plaintexts are shared by both paths
+		Plaintext GAMMA_PL, LL_PL, KGKG_PL, KLKL_PL, ACL_PL, BB_PL;
+		makePlaintextMatRowPacking(smrp->GAMMA_MRP, scale, &GAMMA_PL, &encoder);
+		makePlaintextMatRowPacking(smrp->LL_MRP, scale, &LL_PL, &encoder);
+		makePlaintextMatRowPacking(smrp->KGKG_MRP, scale, &KGKG_PL, &encoder);
+		makePlaintextMatRowPacking(smrp->KLKL_MRP, scale, &KLKL_PL, &encoder);
+		makePlaintextMatRowPacking(smrp->ACL_MRP, scale, &ACL_PL, &encoder);
+		makePlaintextMatRowPacking(smrp->BB_MRP, scale, &BB_PL, &encoder);
+
+		// Real path: one ciphertext per instance (the constant vectors are shared)
+		vector<double> xeRep_MRP[2], yRep_MRP[2];
+		Ciphertext xexe_CP[2], yy_CP[2];
+		for(int p = 0; p < 2; p++){
+			xeRep_MRP[p].resize(smrp->N * smrp->n);
+			yRep_MRP[p].resize(smrp->N * smrp->n);
+			genRepXVecMRP_RPL_v0(&xeRep_MRP[p], xeVec[p], smrp->n, smrp->n, smrp->N, "xe", false);
+			genRepXVecMRP_RPL_v0(&yRep_MRP[p], yVec[p], smrp->n, smrp->n, smrp->N, "Sensor-Measurement-Y-Rep", false);
+			encryptXVectorMatRowPacking(&xeRep_MRP[p], scale, &xexe_CP[p], &encryptor, &encoder);
+			encryptXVectorMatRowPacking(&yRep_MRP[p], scale, &yy_CP[p], &encryptor, &encoder);
+		}
+		Ciphertext xGxG_CP, KxuGKxuG_CP, uGuG_CP, BuGLazy_CP;
+		encryptXVectorMatRowPacking(smrp->xGxG_MRP, scale, &xGxG_CP, &encryptor, &encoder);
+		encryptXVectorMatRowPacking(smrp->KxuGKxuG_MRP, scale, &KxuGKxuG_CP, &encryptor, &encoder);
+		encryptXVectorMatRowPacking(smrp->uGuG_MRP, scale, &uGuG_CP, &encryptor, &encoder);
+		precomputeEquation_4_5_PLCP(&BuGLazy_CP, smrp, &BB_PL, NULL, &uGuG_CP, scale, &context, &evaluator, &gal_keys);
+
+		// Packed path: x̂e and y of A in the real parts and of B in the imaginary parts (the constant vectors are shared, i.e., c + i * c)
+		Ciphertext xexePacked_CP, yyPacked_CP, xGxGPacked_CP, KxuGKxuGPacked_CP, uGuGPacked_CP, BuGLazyPacked_CP;
+		encryptComplexPairMatRowPacking(&xeRep_MRP[0], &xeRep_MRP[1], scale, &xexePacked_CP, &encryptor, &encoder);
+		encryptComplexPairMatRowPacking(&yRep_MRP[0], &yRep_MRP[1], scale, &yyPacked_CP, &encryptor, &encoder);
+		encryptComplexPairMatRowPacking(smrp->xGxG_MRP, smrp->xGxG_MRP, scale, &xGxGPacked_CP, &encryptor, &encoder);
+		encryptComplexPairMatRowPacking(smrp->KxuGKxuG_MRP, smrp->KxuGKxuG_MRP, scale, &KxuGKxuGPacked_CP, &encryptor, &encoder);
+		encryptComplexPairMatRowPacking(smrp->uGuG_MRP, smrp->uGuG_MRP, scale, &uGuGPacked_CP, &encryptor, &encoder);
+		precomputeEquation_4_5_PLCP(&BuGLazyPacked_CP, smrp, &BB_PL, NULL, &uGuGPacked_CP, scale, &context, &evaluator, &gal_keys);
+
+		// The operands of each equation
+		Plaintext * matX_PL[3] 		  = {&GAMMA_PL, &KGKG_PL, &ACL_PL};
+		Plaintext * matY_PL[3] 		  = {&LL_PL, &KLKL_PL, NULL};
+		Ciphertext * addVec_CP[3] 	  = {&xGxG_CP, &KxuGKxuG_CP, &BuGLazy_CP};
+		Ciphertext * addVecPacked_CP[3] = {&xGxGPacked_CP, &KxuGKxuGPacked_CP, &BuGLazyPacked_CP};
+		for(int e = 0; e < 3; e++){
+
+			// ================ ================ ================ ================
+			// ===== Two real evaluations =========================================
+			// ================ ================ ================ ================
+			Ciphertext res_CP[2];
+			clock_t st_Real_Start = clock();
+			for(int r = 0; r < numReps; r++)
+				for(int p = 0; p < 2; p++)
+					applyLinearStageCXP(e + 2, &res_CP[p], smrp, matX_PL[e], matY_PL[e], addVec_CP[e], &yy_CP[p], &xexe_CP[p], scale, &context, &encryptor, &evaluator, &decryptor, &encoder, &relin_keys, &gal_keys);
+			clock_t st_Real_End = clock();
+			double maxErr_Real = 0;
+			for(int p = 0; p < 2; p++)
+				maxErr_Real = max(maxErr_Real, maxErrorMatRowPackingCXP(&res_CP[p], ref[e][p], numRows[e], smrp->N, &decryptor, &encoder));
+
+			// ================ ================ ================ ================
+			// ===== A packed evaluation and the separation =======================
+			// ================ ================ ================ ================
+			Ciphertext resPacked_CP, resSep_CP[2];
+			clock_t st_Packed_Start = clock();
+			for(int r = 0; r < numReps; r++)
+				applyLinearStageCXP(e + 2, &resPacked_CP, smrp, matX_PL[e], matY_PL[e], addVecPacked_CP[e], &yyPacked_CP, &xexePacked_CP, scale, &context, &encryptor, &evaluator, &decryptor, &encoder, &relin_keys, &gal_keys);
+			clock_t st_Packed_End = clock();
+			for(int r = 0; r < numReps; r++)
+				separateComplexPairPLCP(&resSep_CP[0], &resSep_CP[1], &resPacked_CP, scale, &context, &evaluator, &encoder, &gal_keys);
+			clock_t st_Separate_End = clock();
+			double maxErr_Packed = 0;
+			for(int p = 0; p < 2; p++)
+				maxErr_Packed = max(maxErr_Packed, maxErrorMatRowPackingCXP(&resSep_CP[p], ref[e][p], numRows[e], smrp->N, &decryptor, &encoder));
+
+			double realTime     = (double) (st_Real_End - st_Real_Start) / CLOCKS_PER_SEC / numReps;
+			double packedTime   = (double) (st_Packed_End - st_Packed_Start) / CLOCKS_PER_SEC / numReps;
+			double separateTime = (double) (st_Separate_End - st_Packed_End) / CLOCKS_PER_SEC / numReps;
+			printf("%d,%d,%s,%f,%f,%f,%.2f,%.3e,%.3e\n", n, m, equationNames[e], realTime, packedTime, separateTime,
+				realTime / (packedTime + separateTime), maxErr_Real, maxErr_Packed);
+		}
+
+		// Release the cleartext buffers
+		for(int p = 0; p < 2; p++){
+			for(int i = 0; i < n; i++){
+				free(xeVec[p][i]);
+				free(yVec[p][i]);
+			}
+			free(xeVec[p]);
+			free(yVec[p]);
+			for(int e = 0; e < 3; e++)
+				free(ref[e][p]);
+		}
+		free_SimulationMatrixDataMRP(smrp);
+		free(smrp);
+		free_SimulationMatrixData(smd);
+		free(smd);
+	}
+}
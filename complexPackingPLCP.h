@@ -0,0 +1,47 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the complex slot packing of the linear stages (i.e., complexPackingPLCP.cpp)
+						  The CKKS slots are complex numbers, whereas the crypto application only uses their real parts. Two MRP vectors
+						  (e.g., the x̂e and y of two plants sharing the model) are packed as z = a + i * b, so that a single evaluation of the
+						  linear stages (Eq2, Eq3, Eq4-5) with the real model plaintexts serves both, and the results are separated by the
+						  complex conjugation before the nonlinear stages (i.e., a = (z + z̄) / 2 and b = (z - z̄) / 2i). In the tiled MRP format, the row
+						  tiles r and r + 1 of a large plant are paired the same way into the complex model tiles (i.e., M_r + i * M_r+1) applied to the
+						  shared real column tiles, so that a single rotate-and-sum serves both row tiles.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+#ifndef COMPLEXPACKINGPLCP_H
+#define COMPLEXPACKINGPLCP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "prepareVecMatMRP.h"     // The class which prepares the read matrices in MRP format
+#include "tiledMRP.h"             // The class containing the multi-ciphertext (tiled) MRP format
+
+/* Import the important selected C libraries*/
+#include <complex>
+#include <iostream>
+#include <vector>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* The function for encoding and encrypting two MRP vectors into the real and the imaginary parts of the slots */
+void encryptComplexPairMatRowPacking(vector<double> *reVec, vector<double> *imVec, double scale, Ciphertext *ct, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr);
+
+/* The function for separating the real and the imaginary parts of a packed ciphertext into two ciphertexts by the complex conjugation (consumes a level) */
+void separateComplexPairPLCP(Ciphertext *re_CP, Ciphertext *im_CP, Ciphertext *packed_CP, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, GaloisKeys *gal_keysPtr);
+
+/* The function for pairing the row tiles r and r + 1 of the matrix tiles into the complex tiles M_r + i * M_r+1 (the paired layout has half the row tiles, rounded up) */
+void makeComplexPairTiledPlaintextMRP(vector<vector<double>> *tiles, struct tiledLayoutMRP *tl, double scale, vector<Plaintext> *pairedTiles_PL, struct tiledLayoutMRP *pairedTl, CKKSEncoder *encoderPtr);
+
+/* The function for separating the paired row tiles into the row tiles of the original layout (the odd last row tile has no imaginary part and is only mod-switched) */
+void separateComplexPairTiledPLCP(vector<Ciphertext> *rowTiles_CP, vector<Ciphertext> *pairedRowTiles_CP, int numRowTiles, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, GaloisKeys *gal_keysPtr);
+
+#endif
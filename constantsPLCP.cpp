@@ -0,0 +1,213 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the registry of the encoded constants of the online loop
+						  A registered plaintext is never adjusted in place: a lower level ciphertext takes the copy of the constant at its own level,
+						  which is made once (by dropping the primes of the nearest higher copy) and reused by the following iterations.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "constantsPLCP.h"        // The class containing the registry of the encoded constants of the online loop
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <vector>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* The active registry used by the plaintext-ciphertext operations */
+struct constantsRegistryPLCP *activeConstantsPLCP = NULL;
+
+/*
+	The function for creating an empty registry
+*/
+void create_ConstantsRegistryPLCP(struct constantsRegistryPLCP *reg, SEALContext *contextPtr, Evaluator *evaluatorPtr){
+	reg->keys 			= new vector<Plaintext *>();
+	reg->levels 		= new vector<vector<Plaintext> *>();
+	reg->scalarValues 	= new vector<double>();
+	reg->scalars 		= new vector<Plaintext *>();
+	reg->cipherKeys 	= new vector<Ciphertext *>();
+	reg->cipherLevels 	= new vector<vector<Ciphertext> *>();
+	reg->numLookups 	= 0;
+	reg->numLevelCopies = 0;
+	reg->contextPtr 	= contextPtr;
+	reg->evaluatorPtr 	= evaluatorPtr;
+}
+
+/*
+	The function for freeing the level copies and the scalar constants of a registry (the registered plaintexts are not owned)
+*/
+void free_ConstantsRegistryPLCP(struct constantsRegistryPLCP *reg){
+	for(size_t i = 0; i < reg->levels->size(); i++)
+		delete reg->levels->at(i);
+	for(size_t i = 0; i < reg->scalars->size(); i++)
+		delete reg->scalars->at(i);
+	for(size_t i = 0; i < reg->cipherLevels->size(); i++)
+		delete reg->cipherLevels->at(i);
+	delete reg->keys;
+	delete reg->levels;
+	delete reg->scalarValues;
+	delete reg->scalars;
+	delete reg->cipherKeys;
+	delete reg->cipherLevels;
+}
+
+/*
+	The function for registering an encoded plaintext
+*/
+void registerConstantPLCP(struct constantsRegistryPLCP *reg, Plaintext *plainPtr){
+	// A level copy slot per chain index (the empty plaintexts do not allocate)
+	size_t numLevels = reg->contextPtr->first_context_data()->chain_index() + 1;
+	reg->keys->push_back(plainPtr);
+	reg->levels->push_back(new vector<Plaintext>(numLevels));
+}
+
+/*
+	The function for registering the encoded plaintexts of a vector from the given index
+*/
+void registerConstantVecPLCP(struct constantsRegistryPLCP *reg, vector<Plaintext> *plainVecPtr, size_t startInd){
+	for(size_t i = startInd; i < plainVecPtr->size(); i++)
+		registerConstantPLCP(reg, &plainVecPtr->at(i));
+}
+
+/*
+	The function for finding the index of a registered plaintext in the active registry (-1 if it is not registered)
+*/
+int findConstantPLCP(Plaintext *plainPtr){
+	if(activeConstantsPLCP == NULL)
+		return -1;
+	for(size_t i = 0; i < activeConstantsPLCP->keys->size(); i++)
+		if(activeConstantsPLCP->keys->at(i) == plainPtr)
+			return (int) i;
+	return -1;
+}
+
+/*
+	The function for checking whether a plaintext is registered in the active registry
+*/
+bool isRegisteredConstantPLCP(Plaintext *plainPtr){
+	return findConstantPLCP(plainPtr) >= 0;
+}
+
+/*
+	The function for taking the level copy of a registered plaintext or ciphertext at the given chain index (made once from the nearest higher copy)
+*/
+template <typename T>
+static T * levelCopyPLCP(struct constantsRegistryPLCP *reg, T *constPtr, vector<T> *levelCopies, int targetChainIndex, int constChainIndex, parms_id_type targetParmsId){
+	T *levelCopy = &levelCopies->at(targetChainIndex);
+	if(levelCopy->parms_id() == parms_id_zero){
+		T *source = constPtr;
+		for(int c = targetChainIndex + 1; c < constChainIndex; c++){
+			if(levelCopies->at(c).parms_id() != parms_id_zero){
+				source = &levelCopies->at(c);
+				break;
+			}
+		}
+		reg->evaluatorPtr->mod_switch_to(*source, targetParmsId, *levelCopy);
+		reg->numLevelCopies++;
+	}
+	return levelCopy;
+}
+
+/*
+	The function for obtaining a registered constant at the level of the given ciphertext (the plaintext itself is returned if it is not registered)
+	Note: If the ciphertext is not below the constant, the chain adjustment switches the ciphertext instead, thus, the constant itself is returned
+*/
+Plaintext * levelConstantPLCP(Plaintext *plainPtr, Ciphertext *cipherPtr){
+
+	// Return the plaintext if it is not registered
+	int constInd = findConstantPLCP(plainPtr);
+	if(constInd < 0)
+		return plainPtr;
+	struct constantsRegistryPLCP *reg = activeConstantsPLCP;
+	reg->numLookups++;
+
+	// Return the constant itself if the ciphertext is not below it
+	int cipherChainIndex = reg->contextPtr->get_context_data(cipherPtr->parms_id())->chain_index();
+	int plainChainIndex  = reg->contextPtr->get_context_data(plainPtr->parms_id())->chain_index();
+	if(cipherChainIndex >= plainChainIndex)
+		return plainPtr;
+
+	// Make the copy at the level of the ciphertext once (from the nearest higher copy)
+	return levelCopyPLCP(reg, plainPtr, reg->levels->at(constInd), cipherChainIndex, plainChainIndex, cipherPtr->parms_id());
+}
+
+/*
+	The function for registering an iteration-invariant ciphertext (e.g., an encrypted constant or a precomputed subexpression)
+*/
+void registerCipherConstantPLCP(struct constantsRegistryPLCP *reg, Ciphertext *cipherConstPtr){
+	size_t numLevels = reg->contextPtr->first_context_data()->chain_index() + 1;
+	reg->cipherKeys->push_back(cipherConstPtr);
+	reg->cipherLevels->push_back(new vector<Ciphertext>(numLevels));
+}
+
+/*
+	The function for obtaining a registered ciphertext constant at the level of the given ciphertext (the constant itself is returned if it is not registered)
+	Note: If the ciphertext is not below the constant, the chain adjustment switches the ciphertext instead, thus, the constant itself is returned
+*/
+Ciphertext * levelCipherConstantPLCP(Ciphertext *cipherConstPtr, Ciphertext *cipherPtr){
+
+	// Return the ciphertext constant if it is not registered
+	struct constantsRegistryPLCP *reg = activeConstantsPLCP;
+	int constInd = -1;
+	for(size_t i = 0; reg != NULL && i < reg->cipherKeys->size(); i++)
+		if(reg->cipherKeys->at(i) == cipherConstPtr)
+			constInd = (int) i;
+	if(constInd < 0)
+		return cipherConstPtr;
+	reg->numLookups++;
+
+	// Return the constant itself if the ciphertext is not below it
+	int cipherChainIndex = reg->contextPtr->get_context_data(cipherPtr->parms_id())->chain_index();
+	int constChainIndex  = reg->contextPtr->get_context_data(cipherConstPtr->parms_id())->chain_index();
+	if(cipherChainIndex >= constChainIndex)
+		return cipherConstPtr;
+
+	// Make the copy at the level of the ciphertext once (from the nearest higher copy)
+	return levelCopyPLCP(reg, cipherConstPtr, reg->cipherLevels->at(constInd), cipherChainIndex, constChainIndex, cipherPtr->parms_id());
+}
+
+/*
+	The function for obtaining a scalar constant at the level of the given ciphertext (encoded into the local fallback if there is no active registry)
+*/
+Plaintext * scalarConstantPLCP(double value, Ciphertext *cipherPtr, double scale, CKKSEncoder *encoderPtr, Plaintext *localFallback){
+
+	// Encode the scalar as usual without an active registry
+	if(activeConstantsPLCP == NULL){
+		encoderPtr->encode(value, scale, *localFallback);
+		return localFallback;
+	}
+
+	// Find the scalar (encoded and registered at its first use)
+	struct constantsRegistryPLCP *reg = activeConstantsPLCP;
+	Plaintext *scalarPtr = NULL;
+	for(size_t i = 0; i < reg->scalars->size(); i++){
+		if(reg->scalarValues->at(i) == value && reg->scalars->at(i)->scale() == scale){
+			scalarPtr = reg->scalars->at(i);
+			break;
+		}
+	}
+	if(scalarPtr == NULL){
+		scalarPtr = new Plaintext();
+		encoderPtr->encode(value, scale, *scalarPtr);
+		reg->scalarValues->push_back(value);
+		reg->scalars->push_back(scalarPtr);
+		registerConstantPLCP(reg, scalarPtr);
+	}
+	return levelConstantPLCP(scalarPtr, cipherPtr);
+}
+
+/*
+	The function for printing the usage of a registry
+*/
+void printConstantsRegistryPLCP(struct constantsRegistryPLCP *reg){
+	printf("Constants Registry: Constants %zu (Scalars %zu, Ciphertexts %zu), Lookups %zu, Level Copies %zu\n",
+		reg->keys->size(), reg->scalars->size(), reg->cipherKeys->size(), reg->numLookups, reg->numLevelCopies);
+}
@@ -0,0 +1,76 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the registry of the encoded constants of the online loop (i.e., constantsPLCP.cpp)
+						  The constants of the CUSUM stage and the Chebyshev evaluators (i.e., the ones vector, alpha/beta, the first terms and the
+						  power series coefficients) are encoded once and registered. The plaintext-ciphertext operations then take the copy of a
+						  registered constant at the level of the ciphertext, so that the loop neither encodes nor mod-switches the constants in place.
+						  The iteration-invariant ciphertexts (i.e., the encrypted constants and the subexpressions precomputed from them) are registered
+						  in the same way and taken at the level where they are consumed.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+#ifndef CONSTANTSPLCP_H
+#define CONSTANTSPLCP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <vector>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Main struct for holding the registered constants and their copies per level */
+struct constantsRegistryPLCP {
+	vector<Plaintext *> 		 *keys;         // The registered plaintexts (kept intact at the level they were encoded)
+	vector<vector<Plaintext> *>  *levels;       // The copies of each constant indexed by the chain index (filled on the first use at a level)
+	vector<double> 				 *scalarValues; // The values of the scalar constants (looked up by the value)
+	vector<Plaintext *> 		 *scalars;      // The scalar constants encoded by the registry
+	vector<Ciphertext *> 		 *cipherKeys;   // The registered iteration-invariant ciphertexts (kept intact at their level)
+	vector<vector<Ciphertext> *> *cipherLevels; // The copies of each ciphertext constant indexed by the chain index
+	size_t numLookups;                          // Number of the lookups of a registered constant
+	size_t numLevelCopies;                      // Number of the level copies made (i.e., constant in the steady state)
+	SEALContext *contextPtr;                    // The context used for the chain indexes
+	Evaluator *evaluatorPtr;                    // The evaluator used to mod-switch the level copies
+};
+
+/* The active registry used by the plaintext-ciphertext operations (NULL: the plaintexts are used and adjusted as given) */
+extern struct constantsRegistryPLCP *activeConstantsPLCP;
+
+/* The function for creating an empty registry */
+void create_ConstantsRegistryPLCP(struct constantsRegistryPLCP *reg, SEALContext *contextPtr, Evaluator *evaluatorPtr);
+
+/* The function for freeing the level copies and the scalar constants of a registry (the registered plaintexts are not owned) */
+void free_ConstantsRegistryPLCP(struct constantsRegistryPLCP *reg);
+
+/* The function for registering an encoded plaintext */
+void registerConstantPLCP(struct constantsRegistryPLCP *reg, Plaintext *plainPtr);
+
+/* The function for registering the encoded plaintexts of a vector from the given index */
+void registerConstantVecPLCP(struct constantsRegistryPLCP *reg, vector<Plaintext> *plainVecPtr, size_t startInd);
+
+/* The function for checking whether a plaintext is registered in the active registry */
+bool isRegisteredConstantPLCP(Plaintext *plainPtr);
+
+/* The function for obtaining a registered constant at the level of the given ciphertext (the plaintext itself is returned if it is not registered) */
+Plaintext * levelConstantPLCP(Plaintext *plainPtr, Ciphertext *cipherPtr);
+
+/* The function for registering an iteration-invariant ciphertext (e.g., an encrypted constant or a precomputed subexpression) */
+void registerCipherConstantPLCP(struct constantsRegistryPLCP *reg, Ciphertext *cipherConstPtr);
+
+/* The function for obtaining a registered ciphertext constant at the level of the given ciphertext (the constant itself is returned if it is not registered) */
+Ciphertext * levelCipherConstantPLCP(Ciphertext *cipherConstPtr, Ciphertext *cipherPtr);
+
+/* The function for obtaining a scalar constant at the level of the given ciphertext (encoded into the local fallback if there is no active registry) */
+Plaintext * scalarConstantPLCP(double value, Ciphertext *cipherPtr, double scale, CKKSEncoder *encoderPtr, Plaintext *localFallback);
+
+/* The function for printing the usage of a registry */
+void printConstantsRegistryPLCP(struct constantsRegistryPLCP *reg);
+
+#endif
@@ -0,0 +1,443 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the diagonal (Halevi-Shoup) packing format as an alternative to the matrix-row-packing format
+						  In MRP, each matrix-vector multiplication ends with a log2(N) rotate-and-sum and leaves the result at the slots i * N,
+						  so that the estimation has to be re-arranged (i.e., secretShareEstimation) before it could be multiplied again.
+						  In the diagonal packing, y = sum_k diag_k ⊙ rot(x, k) is computed with the baby-step giant-step (BSGS) method:
+						  y = sum_g rot(sum_b diag'_{g * B + b} ⊙ rot(x, b), g * B), where the baby-step rotations rot(x, b) are hoisted
+						  (computed once per input vector and shared by the matrices multiplying the same vector) and diag' is pre-rotated by -g * B.
+						  Since both the input vector and the diagonals are replicated with the period D, the result is also replicated with the
+						  period D (i.e., the slot j holds y[j mod D]), which is exactly the layout of the next input.
+   Abbreviation/Acronym	: # _DGP: Diagonal packing format
+						  # BSGS: Baby-step giant-step
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "generateplaintextMRP.h" // The functions used to prepare plain matrices in MRP format
+#include "prepareVecMatMRP.h"     // The class which prepares the read matrices in MRP format
+#include "initializationPLCP.h"   // The class containing the functions which convert the prepared matrices to Plaintext and Ciphertext objects.
+#include "plcpOperations.h"       // The class containing the functions which does Ciphertext-Ciphertext and Plaintext-Ciphertext arithmetic and algebraic operations
+#include "secretShare.h" 		  // The class containing the functions which does the secret sharing
+#include "applyPLCPSimulation.h"  // The class containing the crypto application functions for each targeted equation
+#include "diagonalPacking.h"      // The class containing the diagonal (Halevi-Shoup) packing format
+
+/* Import the important selected C libraries*/
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Diagonal Layout Creation =======
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+
+/*
+	The function for calculating the diagonal packing layout (the replication period, the baby and the giant steps)
+*/
+void calculateDiagonalLayoutDGP(struct diagonalLayoutDGP *dl, int n, int m, size_t slotCount){
+
+	// The replication period is the binary power covering the state vector (as the MRP row segment size)
+	size_t calculated_D = 0;
+	calculateVectorSize((size_t) n, &calculated_D);
+	dl->n 		  = n;
+	dl->m 		  = m;
+	dl->D 		  = (int) calculated_D;
+	dl->slotCount = slotCount;
+
+	// The baby step is the smallest binary power whose square covers D (i.e., babyStep >= giantStep)
+	int babyStep = 1;
+	while(babyStep * babyStep < dl->D)
+		babyStep *= 2;
+	dl->babyStep  = babyStep;
+	dl->giantStep = dl->D / babyStep;
+
+	// The replication period has to divide the number of slots, so that the cyclic rotations of the replicated vectors stay inside the period
+	if(slotCount % dl->D != 0){
+		printf("Diagonal Layout Error: the replication period D = %d does not divide %zu slots\n", dl->D, slotCount);
+		exit(0);
+	}
+}
+
+/*
+	The function for listing the rotation steps used by the BSGS matrix-vector multiplication (i.e., 1 ... babyStep - 1 and the multiples of babyStep)
+*/
+void getDiagonalGaloisStepsDGP(vector<int> *steps, struct diagonalLayoutDGP *dl){
+
+	steps->clear();
+	// Baby steps
+	for(int b = 1; b < dl->babyStep; b++)
+		steps->push_back(b);
+	// Giant steps
+	for(int g = 1; g < dl->giantStep; g++)
+		steps->push_back(g * dl->babyStep);
+}
+
+/*
+	The function for creating the Galois keys of only the BSGS rotation steps (each rotation is then a single key switch)
+	Note: The default Galois keys only hold the binary power steps, thus, a non-binary-power step would be decomposed into several key switches
+*/
+void createDiagonalGaloisKeysDGP(GaloisKeys *diag_gal_keysPtr, struct diagonalLayoutDGP *dl, SEALContext *contextPtr, SecretKey *secret_keyPtr){
+
+	vector<int> steps;
+	getDiagonalGaloisStepsDGP(&steps, dl);
+	KeyGenerator keygen(*contextPtr, *secret_keyPtr);
+	keygen.create_galois_keys(steps, *diag_gal_keysPtr);
+}
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Diagonal Cleartext Packing =====
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+
+/*
+	The function for generating the BSGS pre-rotated generalized diagonals of a (numRows x numCols) matrix
+	Note: The diagonal k holds diag_k[j] = M[j][(j + k) mod D] at the slots j mod D, and the diagonal k = g * babyStep + b is rotated by -g * babyStep,
+		  so that the giant-step rotation could be applied once to the inner sum of the baby steps
+*/
+void genDiagonalsDGP_RPL(vector<vector<double>> *diags, double ** mat, int numRows, int numCols, struct diagonalLayoutDGP *dl){
+
+	int D = dl->D;
+	diags->assign(D, vector<double>(dl->slotCount, 0));
+	for(int k = 0; k < D; k++){
+		int giantOffset = (k / dl->babyStep) * dl->babyStep;
+		for(size_t s = 0; s < dl->slotCount; s++){
+			int j   = (int) ((s + dl->slotCount - giantOffset) % D); // Row index of the entry moved to the slot s by the pre-rotation
+			int col = (j + k) % D;
+			if(j < numRows && col < numCols)
+				diags->at(k)[s] = mat[j][col];
+		}
+	}
+}
+
+/*
+	The function for generating the replicated vector (i.e., the slot j holds vec[j mod D], zero for j mod D >= len)
+*/
+void genRepVecDGP_RPL(vector<double> *repVec, double ** vec, int len, struct diagonalLayoutDGP *dl){
+
+	repVec->assign(dl->slotCount, 0);
+	for(size_t s = 0; s < dl->slotCount; s++){
+		int j = (int) (s % dl->D);
+		if(j < len)
+			repVec->at(s) = vec[j][0];
+	}
+}
+
+/*
+	The function for encoding the diagonals into Plaintexts (the all-zero diagonals are not encoded and left empty)
+*/
+void makeDiagonalPlaintextsDGP(vector<vector<double>> *diags, double scale, vector<Plaintext> *diags_PL, CKKSEncoder *encoderPtr){
+
+	diags_PL->clear();
+	diags_PL->resize(diags->size());
+	for(size_t k = 0; k < diags->size(); k++){
+		bool isZeroDiagonal = true;
+		for(size_t s = 0; s < diags->at(k).size() && isZeroDiagonal; s++)
+			if(diags->at(k)[s] != 0)
+				isZeroDiagonal = false;
+		if(!isZeroDiagonal)
+			encoderPtr->encode(diags->at(k), scale, diags_PL->at(k));
+	}
+}
+
+/*
+	The function for counting the non-zero (i.e., encoded) diagonals
+*/
+int countNonZeroDiagonalsDGP(vector<Plaintext> *diags_PL){
+
+	int numNonZero = 0;
+	for(size_t k = 0; k < diags_PL->size(); k++)
+		if(!diags_PL->at(k).is_zero())
+			numNonZero++;
+	return numNonZero;
+}
+
+/*
+	The function for creating the compact MRP view (i.e., N = 1, the entry i at the slot i) of the element-wise CUSUM vectors
+	Note: The slots i < n of a replicated diagonal packing result hold the result entries, thus, the element-wise functions of applyPLCPSimulation.cpp
+		  (i.e., the CUSUM, the alarm, the noise addition and the result extraction) read them at i * N with N = 1. The alpha vectors are zero at the
+		  slots >= n, so that the replicated copies are zeroed out before the Chebyshev approximations.
+*/
+void create_DiagonalMRPView(struct simulationMatrixMRP *smrpView, struct simulationMatrixMRP *smrp, struct simulationMatrixData *smd){
+
+	// Assign the dimensions of the view
+	smrpView->m 		  = smrp->m;
+	smrpView->n 		  = smrp->n;
+	smrpView->N 		  = 1;
+	smrpView->rotLenEq2   = 1;
+	smrpView->rotLenEq3   = 1;
+	smrpView->rotLenEq4_5 = 1;
+	// Assign the Chebyshev Approximation parameters
+	smrpView->chebDegEq8 	  = smrp->chebDegEq8;
+	smrpView->chebDegEq9 	  = smrp->chebDegEq9;
+	smrpView->alpbetLowBouEq8 = smrp->alpbetLowBouEq8;
+	smrpView->alpbetUpBouEq8  = smrp->alpbetUpBouEq8;
+	smrpView->alpbetLowBouEq9 = smrp->alpbetLowBouEq9;
+	smrpView->alpbetUpBouEq9  = smrp->alpbetUpBouEq9;
+	smrpView->alpEq8 		  = smrp->alpEq8;
+	smrpView->betEq8 		  = smrp->betEq8;
+	smrpView->alpEq9 		  = smrp->alpEq9;
+	smrpView->betEq9 		  = smrp->betEq9;
+
+	// Generate the element-wise vectors in the compact layout
+	size_t n = smrpView->n;
+	smrpView->xpxp_MRP 			   = new std::vector<double>(n);
+	smrpView->ss_MRP 			   = new std::vector<double>(n);
+	smrpView->vv_MRP 			   = new std::vector<double>(n);
+	smrpView->One_MRP 			   = new std::vector<double>(n);
+	smrpView->TAU_MRP 			   = new std::vector<double>(n);
+	smrpView->chebPowSerFT_Eq8_MRP = new std::vector<double>(n);
+	smrpView->chebPowSerFT_Eq9_MRP = new std::vector<double>(n);
+	smrpView->alpEq8_MRP 		   = new std::vector<double>(n);
+	smrpView->betEq8_MRP 		   = new std::vector<double>(n);
+	smrpView->alpEq9_MRP 		   = new std::vector<double>(n);
+	smrpView->betEq9_MRP 		   = new std::vector<double>(n);
+	genYVecAddOperMRP_RPL(smrpView->xpxp_MRP, smd, 0, n, n, 1, "xp", false);
+	genYVecAddOperMRP_RPL(smrpView->ss_MRP, smd, 0, n, n, 1, "s", false);
+	genYVecAddOperMRP_RPL(smrpView->vv_MRP, smd, 0, n, n, 1, "v", false);
+	genYVecAddOperMRP_RPL(smrpView->One_MRP, smd, 0, n, n, 1, "one", false);
+	genYVecAddOperMRP_RPL(smrpView->TAU_MRP, smd, 0, n, n, 1, "tau", false);
+	genYVecAddOperMRP_RPL(smrpView->chebPowSerFT_Eq8_MRP, smd, 0, n, n, 1, "chb_1st_T_D_12_m_2_n_10", false);
+	genYVecAddOperMRP_RPL(smrpView->chebPowSerFT_Eq9_MRP, smd, 0, n, n, 1, "chb_2nd_T_D_12_m_2_n_10", false);
+	genRangTransfVecChebApprx(smrpView->alpEq8_MRP, smrpView->betEq8_MRP, smrpView->alpbetLowBouEq8, smrpView->alpbetUpBouEq8, 1, n);
+	genRangTransfVecChebApprx(smrpView->alpEq9_MRP, smrpView->betEq9_MRP, smrpView->alpbetLowBouEq9, smrpView->alpbetUpBouEq9, 1, n);
+}
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Diagonal Homomorphic Operations =
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+
+/*
+	The function for hoisting the baby-step rotations of an input vector (computed once and shared by all the matrices multiplying the same input)
+	Note: SEAL does not expose the shared key-switching decomposition of the rotations, thus, the hoisting is done at the level of the application,
+		  i.e., xe is rotated babyStep - 1 times per iteration for Gamma, KG and ACL together instead of once per matrix
+*/
+void hoistBabyStepRotationsDGP(vector<Ciphertext> *babyRots_CP, Ciphertext *x_CP, struct diagonalLayoutDGP *dl, Evaluator *evaluatorPtr, GaloisKeys *diag_gal_keysPtr){
+
+	babyRots_CP->resize(dl->babyStep);
+	babyRots_CP->at(0) = *x_CP;
+	for(int b = 1; b < dl->babyStep; b++)
+		evaluatorPtr->rotate_vector(*x_CP, b, *diag_gal_keysPtr, babyRots_CP->at(b));
+}
+
+/*
+	The function for performing the BSGS Plaintext-Ciphertext matrix-vector multiplication M1*x1 (+ M2*x2) with the hoisted baby-step rotations of x1 (and x2)
+	Note: The products of a giant step are accumulated before a single rescale and a single giant-step rotation,
+		  and the all-zero diagonals (e.g., the band matrices, the padded rows and columns) are skipped
+*/
+void diagonalMatrixVectorMultDGP(Ciphertext *res_CP, struct diagonalLayoutDGP *dl, vector<Plaintext> *diags_PL, vector<Ciphertext> *babyRots_CP,
+								 vector<Plaintext> *diags2_PL, vector<Ciphertext> *babyRots2_CP,
+								 double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, GaloisKeys *diag_gal_keysPtr){
+
+	int numTerms 	  = (diags2_PL != NULL) ? 2 : 1;
+	bool isResAssigned = false;
+	for(int g = 0; g < dl->giantStep; g++){
+
+		// 1st part: Sum the baby-step products of the giant step (of both terms)
+		Ciphertext innerSum;
+		bool isInnerSumAssigned = false;
+		for(int t = 0; t < numTerms; t++){
+			vector<Plaintext>  *termDiags_PL    = (t == 0) ? diags_PL : diags2_PL;
+			vector<Ciphertext> *termBabyRots_CP = (t == 0) ? babyRots_CP : babyRots2_CP;
+			for(int b = 0; b < dl->babyStep; b++){
+				Plaintext *diagPtr = &termDiags_PL->at(g * dl->babyStep + b);
+				if(diagPtr->is_zero())
+					continue;
+				adjustScaleandChainParametersPlaintextAndVectors(&termBabyRots_CP->at(b), diagPtr, scale, contextPtr, evaluatorPtr);
+				Ciphertext product;
+				evaluatorPtr->multiply_plain(termBabyRots_CP->at(b), *diagPtr, product);
+				if(!isInnerSumAssigned){
+					innerSum 		   = product;
+					isInnerSumAssigned = true;
+				}else{
+					adjustScaleandChainParametersTwoVectors(&innerSum, &product, &innerSum, scale, contextPtr, evaluatorPtr);
+					evaluatorPtr->add_inplace(innerSum, product);
+				}
+			}
+		}
+		if(!isInnerSumAssigned)
+			continue;
+
+		// 2nd part: Rescale the inner sum once and apply the giant-step rotation
+		evaluatorPtr->rescale_to_next_inplace(innerSum);
+		if(g > 0)
+			evaluatorPtr->rotate_vector_inplace(innerSum, g * dl->babyStep, *diag_gal_keysPtr);
+
+		// 3rd part: Add the giant step to the result
+		if(!isResAssigned){
+			*res_CP 	  = innerSum;
+			isResAssigned = true;
+		}else{
+			evaluatorPtr->add_inplace(*res_CP, innerSum);
+		}
+	}
+
+	// Assign an encrypted zero if all the diagonals are zero
+	if(!isResAssigned){
+		vector<double> zeroVec(dl->slotCount, 0);
+		Plaintext zero_PL;
+		encoderPtr->encode(zeroVec, scale, zero_PL);
+		encryptorPtr->encrypt(zero_PL, *res_CP);
+	}
+}
+
+/*
+	The function for running the estimation matrix-vector multiplication (Equation-2) of the MRP and the diagonal packing for n = 10, 20, 50 and comparing their timings, rotations and errors
+	Note: The MRP estimation is followed by the re-arranging secret share (i.e., secretShareEstimation) to become the next input, whereas the replicated
+		  diagonal packing estimation is only refreshed (i.e., secretSharev2) without any re-arrangement
+*/
+void example_diagonal_benchmark(){
+
+	// Print the introduction banner
+	print_example_banner("Example: Diagonal (Halevi-Shoup) Packing vs. MRP Benchmark");
+
+	// Create the CKKS context and the keys with the parameters of the crypto application (i.e., ckks_encoder_modify_matrix_row_packing_functional)
+	EncryptionParameters parms(scheme_type::ckks);
+	size_t poly_modulus_degree = 32768;
+	int bitsizesparam 		   = 50;
+	parms.set_poly_modulus_degree(poly_modulus_degree);
+	parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, {60, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, 60}));
+	SEALContext context(parms);
+	KeyGenerator keygen(context);
+	SecretKey secret_key = keygen.secret_key();
+	PublicKey public_key;
+	keygen.create_public_key(public_key);
+	RelinKeys relin_keys;
+	keygen.create_relin_keys(relin_keys);
+	GaloisKeys gal_keys;
+	keygen.create_galois_keys(gal_keys);
+	Encryptor encryptor(context, public_key);
+	Evaluator evaluator(context);
+	Decryptor decryptor(context, secret_key);
+	CKKSEncoder encoder(context);
+	double scale = pow(2.0, bitsizesparam);
+	int numReps  = 10;
+
+	// Run the benchmark for each recorded plant
+	const char * folderPaths[3] = {"./all_data/y10_u2", "./all_data/y20_u4", "./all_data/y50_u10"};
+	printf("n,m,Backend,Eq2 Time (s),Refresh Time (s),Rotations,Plaintexts,Max Error\n");
+	for(int f = 0; f < 3; f++){
+
+		// Read the plant model and prepare the MRP format
+		struct simulationMatrixData * smd = (struct simulationMatrixData *) calloc(1, sizeof(struct simulationMatrixData));
+		create_SimulationMatrixData(smd);
+		assignValMatrixDatabyFileRead(smd, folderPaths[f]);
+		initRemainVec(smd);
+		assignCUSUMChebyshevAppxParams(smd);
+		struct simulationMatrixMRP *smrp = (struct simulationMatrixMRP *) calloc(1, sizeof(struct simulationMatrixMRP));
+		create_SimulationMatrixDataMRP(smd, smrp);
+		assignValMatrixDataMRP(smd, smrp);
+		int n = smd->n;
+
+		// Sensor measurement (without attack) and the cleartext reference x̂e = Γx̂e + Ly + xΓ
+		double ** yVec = (double **) calloc(n, sizeof(double *));
+		for(int i = 0; i < n; i++){
+			yVec[i] 	  = (double *) calloc(1, sizeof(double));
+			yVec[i][0] = smd->xx[i][0] + smd->yNoise[0][i];
+		}
+		double * xeRef = (double *) calloc(n, sizeof(double));
+		for(int i = 0; i < n; i++){
+			xeRef[i] = smd->xGxG[i][0];
+			for(int j = 0; j < n; j++)
+				xeRef[i] += smd->GAMMA[i][j] * smd->xexe[j][0] + smd->LL[i][j] * yVec[j][0];
+		}
+
+		// ================ ================ ================ ================
+		// ===== MRP: Equation-2 and the re-arranging secret share ===========
+		// ================ ================ ================ ================
+		Plaintext GAMMA_MRP_PL, LL_MRP_PL;
+		Ciphertext xexe_MRP_CP, yy_MRP_CP, xGxG_MRP_CP, secEqRes_MRP_CP;
+		makePlaintextMatRowPacking(smrp->GAMMA_MRP, scale, &GAMMA_MRP_PL, &encoder);
+		makePlaintextMatRowPacking(smrp->LL_MRP, scale, &LL_MRP_PL, &encoder);
+		encryptXVectorMatRowPacking(smrp->xexe_MRP, scale, &xexe_MRP_CP, &encryptor, &encoder);
+		encryptXVectorMatRowPacking(smrp->xGxG_MRP, scale, &xGxG_MRP_CP, &encryptor, &encoder);
+		vector<double> yRep_MRP(smrp->N * smrp->n);
+		genRepXVecMRP_RPL_v0(&yRep_MRP, yVec, smrp->n, smrp->n, smrp->N, "Sensor-Measurement-Y-Rep", false);
+		encryptXVectorMatRowPacking(&yRep_MRP, scale, &yy_MRP_CP, &encryptor, &encoder);
+		clock_t st_MRP_Eq2_Start = clock();
+		for(int r = 0; r < numReps; r++){
+			Ciphertext xe_CP = xexe_MRP_CP;
+			applyEquation_2_PLCP(&secEqRes_MRP_CP, smrp, &GAMMA_MRP_PL, &LL_MRP_PL, &xGxG_MRP_CP, &yy_MRP_CP, &xe_CP, scale, &context, &encryptor, &evaluator, &decryptor, &encoder, &relin_keys, &gal_keys);
+		}
+		clock_t st_MRP_Eq2_End = clock();
+		// Error of the entries at i * N
+		Plaintext res_PL;
+		vector<double> res_Vec;
+		decryptor.decrypt(secEqRes_MRP_CP, res_PL);
+		encoder.decode(res_PL, res_Vec);
+		double maxErr_MRP = 0;
+		for(int i = 0; i < n; i++)
+			maxErr_MRP = max(maxErr_MRP, fabs(res_Vec[i * smrp->N] - xeRef[i]));
+		clock_t st_MRP_Refresh_Start = clock();
+		for(int r = 0; r < numReps; r++){
+			Ciphertext xe_CP = secEqRes_MRP_CP;
+			secretShareEstimation(&xe_CP, &context, &encryptor, &evaluator, &decryptor, &encoder, scale, smrp->n, smrp->n, smrp->N);
+		}
+		clock_t st_MRP_Refresh_End = clock();
+		printf("%d,%d,MRP,%f,%f,%d,%d,%.3e\n", n, smd->m, (double) (st_MRP_Eq2_End - st_MRP_Eq2_Start) / CLOCKS_PER_SEC / numReps,
+			(double) (st_MRP_Refresh_End - st_MRP_Refresh_Start) / CLOCKS_PER_SEC / numReps, findBinaryPower(smrp->rotLenEq2), 2, maxErr_MRP);
+
+		// ================ ================ ================ ================
+		// ===== Diagonal packing: BSGS Equation-2 and the plain refresh =====
+		// ================ ================ ================ ================
+		struct diagonalLayoutDGP dl;
+		calculateDiagonalLayoutDGP(&dl, n, smd->m, encoder.slot_count());
+		GaloisKeys diag_gal_keys;
+		createDiagonalGaloisKeysDGP(&diag_gal_keys, &dl, &context, &secret_key);
+		vector<vector<double>> cleartextDiags;
+		vector<Plaintext> GAMMA_DGP_PL, LL_DGP_PL;
+		genDiagonalsDGP_RPL(&cleartextDiags, smd->GAMMA, n, n, &dl); makeDiagonalPlaintextsDGP(&cleartextDiags, scale, &GAMMA_DGP_PL, &encoder);
+		genDiagonalsDGP_RPL(&cleartextDiags, smd->LL, n, n, &dl);    makeDiagonalPlaintextsDGP(&cleartextDiags, scale, &LL_DGP_PL, &encoder);
+		vector<double> repVec;
+		Ciphertext xexe_DGP_CP, yy_DGP_CP, xGxG_DGP_CP, secEqRes_DGP_CP;
+		genRepVecDGP_RPL(&repVec, smd->xexe, n, &dl); encryptXVectorMatRowPacking(&repVec, scale, &xexe_DGP_CP, &encryptor, &encoder);
+		genRepVecDGP_RPL(&repVec, yVec, n, &dl);      encryptXVectorMatRowPacking(&repVec, scale, &yy_DGP_CP, &encryptor, &encoder);
+		genRepVecDGP_RPL(&repVec, smd->xGxG, n, &dl); encryptXVectorMatRowPacking(&repVec, scale, &xGxG_DGP_CP, &encryptor, &encoder);
+		clock_t st_DGP_Eq2_Start = clock();
+		for(int r = 0; r < numReps; r++){
+			vector<Ciphertext> xeBabyRots_CP, yBabyRots_CP;
+			hoistBabyStepRotationsDGP(&xeBabyRots_CP, &xexe_DGP_CP, &dl, &evaluator, &diag_gal_keys);
+			hoistBabyStepRotationsDGP(&yBabyRots_CP, &yy_DGP_CP, &dl, &evaluator, &diag_gal_keys);
+			diagonalMatrixVectorMultDGP(&secEqRes_DGP_CP, &dl, &GAMMA_DGP_PL, &xeBabyRots_CP, &LL_DGP_PL, &yBabyRots_CP, scale, &context, &encryptor, &evaluator, &encoder, &diag_gal_keys);
+			addSubtractTwoVector(&secEqRes_DGP_CP, &secEqRes_DGP_CP, &xGxG_DGP_CP, scale, &context, &evaluator, true);
+		}
+		clock_t st_DGP_Eq2_End = clock();
+		// Error of the entries at i and of their last replica
+		decryptor.decrypt(secEqRes_DGP_CP, res_PL);
+		encoder.decode(res_PL, res_Vec);
+		double maxErr_DGP = 0;
+		size_t lastReplica = dl.slotCount - dl.D;
+		for(int i = 0; i < n; i++)
+			maxErr_DGP = max(maxErr_DGP, max(fabs(res_Vec[i] - xeRef[i]), fabs(res_Vec[lastReplica + i] - xeRef[i])));
+		clock_t st_DGP_Refresh_Start = clock();
+		for(int r = 0; r < numReps; r++){
+			Ciphertext xe_CP = secEqRes_DGP_CP;
+			secretSharev2(&xe_CP, &context, &encryptor, &evaluator, &decryptor, &encoder, scale, (int) (dl.slotCount / dl.D), n, dl.D);
+		}
+		clock_t st_DGP_Refresh_End = clock();
+		int numRotations = 2 * (dl.babyStep - 1) + (dl.giantStep - 1);
+		printf("%d,%d,Diagonal (D = %d; %d baby x %d giant steps),%f,%f,%d,%d,%.3e\n", n, smd->m, dl.D, dl.babyStep, dl.giantStep,
+			(double) (st_DGP_Eq2_End - st_DGP_Eq2_Start) / CLOCKS_PER_SEC / numReps, (double) (st_DGP_Refresh_End - st_DGP_Refresh_Start) / CLOCKS_PER_SEC / numReps,
+			numRotations, countNonZeroDiagonalsDGP(&GAMMA_DGP_PL) + countNonZeroDiagonalsDGP(&LL_DGP_PL), maxErr_DGP);
+
+		// Release the cleartext buffers
+		for(int i = 0; i < n; i++)
+			free(yVec[i]);
+		free(yVec);
+		free(xeRef);
+		free_SimulationMatrixDataMRP(smrp);
+		free(smrp);
+		free_SimulationMatrixData(smd);
+		free(smd);
+	}
+}
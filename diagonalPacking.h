@@ -0,0 +1,94 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the diagonal (Halevi-Shoup) packing format (i.e., diagonalPacking.cpp)
+						  A (numRows x numCols) matrix is padded to (D x D) and stored as its D generalized diagonals, each replicated over all slots.
+						  The multiplied vector is replicated with the period D (i.e., the slot j holds x[j mod D]), so that the result of a
+						  matrix-vector multiplication comes back in the same replicated layout and is directly reusable as the next input.
+   Abbreviation/Acronym	: # _DGP: Diagonal packing format
+						  # BSGS: Baby-step giant-step
+*/
+
+#ifndef DIAGONALPACKING_H
+#define DIAGONALPACKING_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "generateplaintextMRP.h" // The functions used to prepare plain matrices in MRP format
+#include "prepareVecMatMRP.h"     // The class which prepares the read matrices in MRP format
+#include "initializationPLCP.h"   // The class containing the functions which convert the prepared matrices to Plaintext and Ciphertext objects.
+#include "plcpOperations.h"       // The class containing the functions which does Ciphertext-Ciphertext and Plaintext-Ciphertext arithmetic and algebraic operations
+
+/* Import the important selected C libraries*/
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Main struct for holding the diagonal packing layout */
+struct diagonalLayoutDGP {
+	int n;            // Number of states (i.e., the length of the state vector)
+	int m;            // Number of inputs (i.e., the length of the control action vector)
+	int D;            // Replication period and the number of diagonals (a binary power covering n)
+	int babyStep;     // Number of the baby steps (i.e., the hoisted rotations of an input vector, a binary power close to sqrt(D))
+	int giantStep;    // Number of the giant steps (i.e., D / babyStep)
+	size_t slotCount; // Number of the slots of a single ciphertext
+};
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Diagonal Layout Creation =======
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+/* The function for calculating the diagonal packing layout (the replication period, the baby and the giant steps) */
+void calculateDiagonalLayoutDGP(struct diagonalLayoutDGP *dl, int n, int m, size_t slotCount);
+
+/* The function for listing the rotation steps used by the BSGS matrix-vector multiplication (i.e., 1 ... babyStep - 1 and the multiples of babyStep) */
+void getDiagonalGaloisStepsDGP(vector<int> *steps, struct diagonalLayoutDGP *dl);
+
+/* The function for creating the Galois keys of only the BSGS rotation steps (each rotation is then a single key switch) */
+void createDiagonalGaloisKeysDGP(GaloisKeys *diag_gal_keysPtr, struct diagonalLayoutDGP *dl, SEALContext *contextPtr, SecretKey *secret_keyPtr);
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Diagonal Cleartext Packing =====
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+/* The function for generating the BSGS pre-rotated generalized diagonals of a (numRows x numCols) matrix (the diagonal k = g * babyStep + b is rotated by -g * babyStep) */
+void genDiagonalsDGP_RPL(vector<vector<double>> *diags, double ** mat, int numRows, int numCols, struct diagonalLayoutDGP *dl);
+
+/* The function for generating the replicated vector (i.e., the slot j holds vec[j mod D], zero for j mod D >= len) */
+void genRepVecDGP_RPL(vector<double> *repVec, double ** vec, int len, struct diagonalLayoutDGP *dl);
+
+/* The function for encoding the diagonals into Plaintexts (the all-zero diagonals are not encoded and left empty) */
+void makeDiagonalPlaintextsDGP(vector<vector<double>> *diags, double scale, vector<Plaintext> *diags_PL, CKKSEncoder *encoderPtr);
+
+/* The function for counting the non-zero (i.e., encoded) diagonals */
+int countNonZeroDiagonalsDGP(vector<Plaintext> *diags_PL);
+
+/* The function for creating the compact MRP view (i.e., N = 1, the entry i at the slot i) of the element-wise CUSUM vectors, so that the CUSUM and
+   the alarm functions of applyPLCPSimulation.cpp could be applied to the (replicated) diagonal packing results */
+void create_DiagonalMRPView(struct simulationMatrixMRP *smrpView, struct simulationMatrixMRP *smrp, struct simulationMatrixData *smd);
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Diagonal Homomorphic Operations =
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+/* The function for hoisting the baby-step rotations of an input vector (computed once and shared by all the matrices multiplying the same input, e.g., Gamma, KG, ACL with xe) */
+void hoistBabyStepRotationsDGP(vector<Ciphertext> *babyRots_CP, Ciphertext *x_CP, struct diagonalLayoutDGP *dl, Evaluator *evaluatorPtr, GaloisKeys *diag_gal_keysPtr);
+
+/* The function for performing the BSGS Plaintext-Ciphertext matrix-vector multiplication M1*x1 (+ M2*x2) with the hoisted baby-step rotations of x1 (and x2)
+   The optional 2nd term shares the giant-step rotations of the 1st one (e.g., Gamma*xe + L*y, ACL*xe + B*uG), and the all-zero diagonals are skipped */
+void diagonalMatrixVectorMultDGP(Ciphertext *res_CP, struct diagonalLayoutDGP *dl, vector<Plaintext> *diags_PL, vector<Ciphertext> *babyRots_CP,
+								 vector<Plaintext> *diags2_PL, vector<Ciphertext> *babyRots2_CP,
+								 double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, GaloisKeys *diag_gal_keysPtr);
+
+/* The function for running the estimation matrix-vector multiplication (Equation-2) of the MRP and the diagonal packing for n = 10, 20, 50 and comparing their timings, rotations and errors */
+void example_diagonal_benchmark();
+
+#endif
@@ -12,7 +12,6 @@
 
 /* Define  several constants */
 #define PI 3.141592653589793
-#define numRandBits 20
 
 /* Import the other classes' header files*/
 #include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application     	
@@ -25,6 +24,19 @@
 #include "encryptedAppx.h"        // The class containing the functions which does the Chebyshev approximation with different assumptions     
 #include "secretShare.h" 		  // The class containing the functions which does the secret sharing  
 #include "applyPLCPSimulation.h"  // The class containing the crypto application functions for each targeted equation
+#include "tiledMRP.h"             // The class containing the multi-ciphertext tiled MRP layout
+#include "diagonalPacking.h"      // The class containing the diagonal (Halevi-Shoup) packing format
+#include "arenaPLCP.h"            // The class containing the reusable Ciphertext and Plaintext buffers of the online loop
+#include "sessionPLCP.h"          // The class containing the reusable cleartext buffers of the online loop
+#include "streamingPLCP.h"        // The class containing the streaming ingestion of the sensor measurements
+#include "checkpointPLCP.h"       // The class containing the encrypted state checkpoints of the online loop
+#include "constantsPLCP.h"        // The class containing the registry of the encoded constants of the online loop
+#include "extractionPLCP.h"       // The class containing the lean result extraction of the online loop
+#include "resultsWriterPLCP.h"    // The class containing the asynchronous structured results writer of the online loop
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
+#include "sweepPLCP.h"            // The class containing the parameter sweep of the crypto application
+#include "refreshSchedulerPLCP.h" // The class containing the level-budget-driven refresh scheduling of the recurrent ciphertexts
+#include "complexPackingPLCP.h"   // The class containing the complex slot packing of the linear stages
 #include "encodersplain.h"        // The main application class of the crypto application
 
 /* Import the important selected C libraries*/
@@ -41,6 +53,8 @@
 #include <stdbool.h>
 #include <cmath>
 #include <stdio.h>
+#include <chrono>
+#include <thread>
 
 /* Call main namespaces */
 using namespace std;
@@ -64,6 +78,23 @@ double CUSUMTime 			 = 0;
 double Eq10Time  			 = 0; 
 double EqLastSecretShareTime = 0;
 
+/*
+	Define the checkpoint settings of the online loop (the public and evaluation keys and the recurrent state are stored in checkpointDir)
+	A resumed run loads the stored keys (the secret key from the key_store_dir) instead of the key generation and continues at the iteration after the last checkpoint 
+*/
+bool useCheckpointing 	  = false;
+bool resumeFromCheckpoint = false;
+const char * checkpointDir = "./checkpoint";
+int checkpointInterval 	  = 10; // The iterations between the checkpoints
+
+/*
+	Define the results settings of the online loop (the records of the iterations are written by a background thread into resultsDir)
+	The console verbosity is selected by activeLogLevelPLCP (i.e., LOG_LEVEL_VERBOSE keeps every phase timing and every extracted value)
+*/
+bool useResultsWriter 				 = false;
+const char * resultsDir 			 = "./results";
+enum resultsFormatPLCP resultsFormat = RESULTS_FORMAT_CSV;
+
 /*
 	The function for performing the cyberphysical system's functionalities (one after another)   
 */
@@ -84,14 +115,14 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 	// Define the all the simulation file paths based on the matrix dimensions 
 	char * folderPath_y10_u2 	= "./all_data/y10_u2";
 	char * folderPath_y20_u4 	= "./all_data/y20_u4";
-	char * folderPath_y50_u10 	= "./all_data/y50_u10";		
 	// Create and build simulationMatrixData struct holding the  	
 	struct simulationMatrixData * smd = (struct simulationMatrixData *) calloc(1, sizeof(struct simulationMatrixData)); 	
 	create_SimulationMatrixData(smd);
 	// Read the recorded system matrices and vectors
 	// assignValMatrixDatabyFileRead(smd, folderPath_y10_u2); // The system matrices and vectors when n = 10, m = 2  	
 	// assignValMatrixDatabyFileRead(smd, folderPath_y20_u4); // The system matrices and vectors when n = 20, m = 4
-	assignValMatrixDatabyFileRead(smd, folderPath_y50_u10); // The system matrices and vectors when n = 50, m = 10
+	struct runConfigPLCP *cfg = currentRunConfigPLCP();
+	assignValMatrixDatabyFileRead(smd, cfg->dataPath); // The system matrices and vectors of the configured plant (default: n = 50, m = 10)
 	// Initialize the remaining vectors including the sensor measurement vector y
 	initRemainVec(smd);	
 	// Initialize the CUSUM Chebyshev Appx. parameters and arrays
@@ -100,7 +131,65 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 	struct simulationMatrixMRP *smrp   = (struct simulationMatrixMRP *) calloc(1, sizeof(struct simulationMatrixMRP));
 	create_SimulationMatrixDataMRP(smd, smrp);
 	assignValMatrixDataMRP(smd, smrp);	
+	// Switch to the tiled (multi-ciphertext) MRP format if the state vector does not fit into a single ciphertext (i.e., n * N > slot_count)
+	// or if the column tiles are selected (see tiled_col_tile_width)
+	bool isLayoutOverflowed = isMRPLayoutOverflowed(smrp, encoderPtr->slot_count());
+	if(isLayoutOverflowed || cfg->tiledColTileWidth > 0){
+		if(isLayoutOverflowed)
+			printf("MRP Layout Overflow: n * N = %d > %zu slots, the tiled MRP format is used\n", smrp->n * smrp->N, encoderPtr->slot_count());
+		// The row tile views only carry the plain CUSUM options (see create_RowTileMRPView), thus, the others are rejected instead of being ignored
+		bool isTiledSupported = true;
+		if(cfg->useFoldedRangeTransform){
+			printf("Tiled MRP Error: folded_range_transform is not supported by the tiled MRP format\n");
+			isTiledSupported = false;
+		}
+		if(cfg->appxBackendEq8 != CUSUM_APPX_CHEBYSHEV || cfg->appxBackendEq9 != CUSUM_APPX_CHEBYSHEV){
+			printf("Tiled MRP Error: the composite appx_eq8 and appx_eq9 are not supported by the tiled MRP format\n");
+			isTiledSupported = false;
+		}
+		if(cfg->useHomomorphicReset){
+			printf("Tiled MRP Error: homomorphic_reset is not supported by the tiled MRP format\n");
+			isTiledSupported = false;
+		}
+		if(isTiledSupported)
+			performTiledMatrixVectorMultiplicationsPlain(contextPtr, relin_keysPtr, gal_keysPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, smd, smrp, scale, cfg->tiledColTileWidth);
+		free_SimulationMatrixDataMRP(smrp);
+		free(smrp);
+		free_SimulationMatrixData(smd);
+		free(smd);
+		return;
+	}
+	// Switch to the diagonal (Halevi-Shoup) packing backend if selected (see diagonal_packing)
+	if(cfg->useDiagonalPacking){
+		performDiagonalMatrixVectorMultiplicationsPlain(contextPtr, secret_keyPtr, relin_keysPtr, gal_keysPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, smd, smrp, scale);
+		free_SimulationMatrixDataMRP(smrp);
+		free(smrp);
+		free_SimulationMatrixData(smd);
+		free(smd);
+		return;
+	}
+	// Select the approximation backends of the CUSUM nonlinearities (Chebyshev or composite sign, see assignCUSUMAppxBackendMRP)
+	assignCUSUMAppxBackendMRP(smrp, cfg);
+	// Reset the CUSUM parametric sum under encryption (i.e., without the per-iteration alarm decryption of Eq10)
+	smrp->isResetHomomorphic = cfg->useHomomorphicReset;
+	// Fold the range transformations of the Chebyshev evaluations into the prediction, the residues and the CUSUM vectors (one level less per evaluation)
+	// The folded prediction takes n - 1 rotations per iteration instead of log2(rotLenEq4_5), thus, it only pays off when the level is needed (see folded_range_transform)
+	if(cfg->useFoldedRangeTransform && smrp->appxBackendEq8 == CUSUM_APPX_CHEBYSHEV && smrp->appxBackendEq9 == CUSUM_APPX_CHEBYSHEV)
+		foldCUSUMRangeTransformMRP(smrp);
+	// The homomorphically reset s is refreshed by decrypting s + mask, thus, the chain must hold the residues, Eq8 and the reset above the masked downlink level
+	int sPlannedLevelsPerIter = -1;
+	if(smrp->isResetHomomorphic && !planHomomorphicResetMRP(smrp, (int) contextPtr->first_context_data()->chain_index(), downlinkChainIndexPLCP(true, scale, contextPtr), &sPlannedLevelsPerIter)){
+		free_SimulationMatrixDataMRP(smrp);
+		free(smrp);
+		free_SimulationMatrixData(smd);
+		free(smd);
+		return;
+	}
 
+	// The offline encodings and encryptions below are independent, thus, they are queued into a batch and run together on the worker threads
+	struct encodingBatchPLCP * initBatch = (struct encodingBatchPLCP *) calloc(1, sizeof(struct encodingBatchPLCP));
+	create_EncodingBatchPLCP(initBatch);
+	int numInitThreads = (cfg->numThreads > 0) ? cfg->numThreads : (int) thread::hardware_concurrency();
 
 	// ================ ================ ================ ================ ================
 	// ========= Estimation Phase-Equation-2 Plaintext-Ciphertext Initialization ========== 
@@ -117,10 +206,10 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 	xGxG_CP	 = &CP_xGxG;
 	xexe_CP  = &CP_xexe;
 	// Encode and encrypt the plaintexts and ciphertexts respectively
-	makePlaintextMatRowPacking(smrp->GAMMA_MRP, scale, GAMMA_PL, encoderPtr);
-	makePlaintextMatRowPacking(smrp->LL_MRP, scale, LL_PL, encoderPtr);	
-	encryptXVectorMatRowPacking(smrp->xGxG_MRP, scale, xGxG_CP, encryptorPtr, encoderPtr);	
-	encryptXVectorMatRowPacking(smrp->xexe_MRP, scale, xexe_CP, encryptorPtr, encoderPtr);	
+	addPlaintextEncodingBatch(initBatch, smrp->GAMMA_MRP, GAMMA_PL);
+	addPlaintextEncodingBatch(initBatch, smrp->LL_MRP, LL_PL);	
+	addCiphertextEncodingBatch(initBatch, smrp->xGxG_MRP, xGxG_CP);	
+	addCiphertextEncodingBatch(initBatch, smrp->xexe_MRP, xexe_CP);	
 		
 	// ================ ================ ================ ================ ================
 	// ================== Equation-3 Plaintext-Ciphertext Initialization ================== 
@@ -137,11 +226,11 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 	KxKx_PL 	= &PL_KxKx;  	
 	uGuG_AS_CP 	= &CP_uGuG_AS; 
 	// Encode and encrypt the plaintexts and ciphertexts respectively
-	makePlaintextMatRowPacking(smrp->KGKG_MRP, scale, KGKG_PL, encoderPtr);
-	makePlaintextMatRowPacking(smrp->KLKL_MRP, scale, KLKL_PL, encoderPtr);	
-	makePlaintextMatRowPacking(smrp->KxKx_MRP, scale, KxKx_PL, encoderPtr); // Used in the very first iteration 	 
-	encryptXVectorMatRowPacking(smrp->KxuGKxuG_MRP, scale, KxuGKxuG_CP, encryptorPtr, encoderPtr);
-	encryptXVectorMatRowPacking(smrp->uGuG_AS_MRP, scale, uGuG_AS_CP, encryptorPtr, encoderPtr); // Used in the very first iteration  
+	addPlaintextEncodingBatch(initBatch, smrp->KGKG_MRP, KGKG_PL);
+	addPlaintextEncodingBatch(initBatch, smrp->KLKL_MRP, KLKL_PL);	
+	addPlaintextEncodingBatch(initBatch, smrp->KxKx_MRP, KxKx_PL); // Used in the very first iteration 	 
+	addCiphertextEncodingBatch(initBatch, smrp->KxuGKxuG_MRP, KxuGKxuG_CP);
+	addCiphertextEncodingBatch(initBatch, smrp->uGuG_AS_MRP, uGuG_AS_CP); // Used in the very first iteration  
 		
 	// ================ ================ ================ ================ ================
 	// ================== Equation-4-5 Plaintext-Ciphertext Initialization ================
@@ -156,9 +245,20 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 	BB_PL  = &PL_BB; 	
 	uGuG_CP = &CP_uGuG;
 	// Encode and encrypt the plaintexts and ciphertexts respectively
-	makePlaintextMatRowPacking(smrp->ACL_MRP, scale, ACL_PL, encoderPtr);
-	makePlaintextMatRowPacking(smrp->BB_MRP, scale, BB_PL, encoderPtr);
-	encryptXVectorMatRowPacking(smrp->uGuG_MRP, scale, uGuG_CP, encryptorPtr, encoderPtr);	
+	addPlaintextEncodingBatch(initBatch, smrp->ACL_MRP, ACL_PL);
+	addPlaintextEncodingBatch(initBatch, smrp->BB_MRP, BB_PL);
+	addCiphertextEncodingBatch(initBatch, smrp->uGuG_MRP, uGuG_CP);	
+	// The columns of A - LC and B at the row segment starts (the folded range transformation)
+	vector <Plaintext> * ACLCols_PL = NULL;
+	vector <Plaintext> * BBCols_PL  = NULL;
+	if(smrp->isRangeFolded){
+		ACLCols_PL = new vector<Plaintext>(smrp->n);
+		BBCols_PL  = new vector<Plaintext>(smrp->m);
+		for(int col = 0; col < smrp->n; col++)
+			addPlaintextEncodingBatch(initBatch, &smrp->ACLCols_MRP->at(col), &ACLCols_PL->at(col));
+		for(int col = 0; col < smrp->m; col++)
+			addPlaintextEncodingBatch(initBatch, &smrp->BBCols_MRP->at(col), &BBCols_PL->at(col));
+	}
 
 	// ================ ================ ================ ================ ================
 	// ================== Equation-6 Plaintext Initialization ============================= 
@@ -166,9 +266,8 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 	// Define plaintext pointers
 	Plaintext PL_xpxp; 
 	Plaintext *xpxp_PL = &PL_xpxp;
-	// Encode the plaintexts	
-	makePlaintextMatRowPacking(smrp->ACL_MRP, scale, ACL_PL, encoderPtr);
-	makePlaintextMatRowPacking(smrp->xpxp_MRP, scale, xpxp_PL, encoderPtr);
+	// Encode the plaintexts (A - LC is already queued for the Equation-4-5)	
+	addPlaintextEncodingBatch(initBatch, smrp->xpxp_MRP, xpxp_PL);
 		
 	// ================ ================ ================ ================ ================
 	// ================== Equation-8 Plaintext-Ciphertext Initialization ================== 
@@ -193,13 +292,13 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 	ss_CP 		 = &CP_ss; 
 	firstChebPowSerTerm_max_PL = & PL_firstChebPowSerTerm_max;	
 	// Encode and encrypt the plaintexts and ciphertexts respectively
-	makePlaintextMatRowPacking(smrp->ss_MRP, scale, ss_PL, encoderPtr);
-	makePlaintextMatRowPacking(smrp->vv_MRP, scale, vv_PL, encoderPtr);
-	makePlaintextMatRowPacking(smrp->alpEq8_MRP, scale, alpha_Eq8_PL, encoderPtr);
-	makePlaintextMatRowPacking(smrp->betEq8_MRP, scale, beta_Eq8_PL, encoderPtr);
-	encryptXVectorMatRowPacking(smrp->ss_MRP, scale, ss_CP, encryptorPtr, encoderPtr);  	 			  	
-	makePlaintextMatRowPacking(smrp->chebPowSerFT_Eq8_MRP, scale, firstChebPowSerTerm_max_PL, encoderPtr); 	 			
-	preparePwSrCoeffVec(chebPwSrCoefVec_Eq8_PL, smd, smd->chebDegEq8 + 1, smrp->N, scale, decryptorPtr, encoderPtr, true);
+	addPlaintextEncodingBatch(initBatch, smrp->ss_MRP, ss_PL);
+	addPlaintextEncodingBatch(initBatch, smrp->vv_MRP, vv_PL);
+	addPlaintextEncodingBatch(initBatch, smrp->alpEq8_MRP, alpha_Eq8_PL);
+	addPlaintextEncodingBatch(initBatch, smrp->betEq8_MRP, beta_Eq8_PL);
+	addCiphertextEncodingBatch(initBatch, smrp->ss_MRP, ss_CP);  	 			  	
+	addPlaintextEncodingBatch(initBatch, smrp->chebPowSerFT_Eq8_MRP, firstChebPowSerTerm_max_PL); 	 			
+	addPwSrCoeffVecEncodingBatch(initBatch, chebPwSrCoefVec_Eq8_PL, smd, smd->chebDegEq8 + 1, true, smrp->sScale); // The folded range transformation keeps s as alpha9 * s
 
 	// ================ ================ ================ ================ ================
 	// ================== Equation-9 Plaintext-Ciphertext initialization ================== 
@@ -220,17 +319,194 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 	// Initialize the Chenbyshev coefficient array 
 	vector <Plaintext> * chebPwSrCoefVec_Eq9_PL =  new vector<Plaintext>(smd->chebDegEq9 + 1);	
 	// Encode and encrypt the plaintexts and ciphertexts respectively
- 	makePlaintextMatRowPacking(smrp->TAU_MRP, scale, TAU_PL, encoderPtr);
-	makePlaintextMatRowPacking(smrp->alpEq9_MRP, scale, alpha_Eq9_PL, encoderPtr); // Uncomment after rawplain.cpp and prepareVecMatMRP.cpp modifications
-	makePlaintextMatRowPacking(smrp->betEq9_MRP, scale, beta_Eq9_PL, encoderPtr);  // Uncomment after rawplain.cpp and prepareVecMatMRP.cpp modifications
-	makePlaintextMatRowPacking(smrp->chebPowSerFT_Eq9_MRP, scale, firstChebPowSerTerm_ISub_PL, encoderPtr); // Prepare the very first term of Cheb. Polyn. for Eq-8   		
-	preparePwSrCoeffVec(chebPwSrCoefVec_Eq9_PL, smd, smd->chebDegEq9 + 1, smrp->N, scale, decryptorPtr, encoderPtr, false); // Prepare coeff vector of Cheb. Polyn. for Eq-9
+ 	addPlaintextEncodingBatch(initBatch, smrp->TAU_MRP, TAU_PL);
+	addPlaintextEncodingBatch(initBatch, smrp->alpEq9_MRP, alpha_Eq9_PL); // Uncomment after rawplain.cpp and prepareVecMatMRP.cpp modifications
+	addPlaintextEncodingBatch(initBatch, smrp->betEq9_MRP, beta_Eq9_PL);  // Uncomment after rawplain.cpp and prepareVecMatMRP.cpp modifications
+	addPlaintextEncodingBatch(initBatch, smrp->chebPowSerFT_Eq9_MRP, firstChebPowSerTerm_ISub_PL); // Prepare the very first term of Cheb. Polyn. for Eq-8   		
+	addPwSrCoeffVecEncodingBatch(initBatch, chebPwSrCoefVec_Eq9_PL, smd, smd->chebDegEq9 + 1, false, 1); // Prepare coeff vector of Cheb. Polyn. for Eq-9
 	// Last multiplication of Alarm 	
 	Ciphertext CP_vecOne_last;
 	Ciphertext * vecOne_last_CP;
 	vecOne_last_CP  = &CP_vecOne_last;
 	// makePlaintextMatRowPacking(smrp->One_MRP, scale, vecOne_PL_last, encoderPtr);
-	encryptXVectorMatRowPacking(smrp->One_MRP, scale, vecOne_last_CP, encryptorPtr, encoderPtr);
+	addCiphertextEncodingBatch(initBatch, smrp->One_MRP, vecOne_last_CP);
+	// The ones vector of the Chebyshev evaluations (encoded once for all the iterations)
+	Plaintext PL_vecOneConst;
+	Plaintext *vecOneConst_PL = &PL_vecOneConst;
+	addPlaintextEncodingBatch(initBatch, smrp->One_MRP, vecOneConst_PL);
+
+	// ================ ================ ================ ================ ================
+	// ================== Homomorphic Replication Plaintext Initialization ================ 
+	// ================ ================ ================ ================ ================	
+	// Replicate x^e[k] into the repeated MRP format in the server instead of the re-arranging secret share round-trip (secretShareEstimation, see homomorphic_replication)
+	// Note: The replication takes log2(slot_count / N) rotations and two levels per iteration, thus, it only pays off when the refresh of x^e is skipped
+	bool useHomomorphicReplication = cfg->useHomomorphicReplication;
+	Plaintext PL_rowStartMask, PL_diagMask;
+	Plaintext *rowStartMask_PL = &PL_rowStartMask;
+	Plaintext *diagMask_PL 	   = &PL_diagMask;
+	vector<double> rowStartMask, diagMask;
+	if(useHomomorphicReplication){
+		genReplicationMasksMRP_RPL(&rowStartMask, &diagMask, smrp->n, smrp->N, encoderPtr->slot_count());
+		addPlaintextEncodingBatch(initBatch, &rowStartMask, rowStartMask_PL);
+		addPlaintextEncodingBatch(initBatch, &diagMask, diagMask_PL);
+	}
+	// The recurrent ciphertexts (i.e., the replicated x^e and the homomorphically reset s) are refreshed only when their remaining levels cannot fit the next 
+	// iteration above the masked downlink level (i.e., the levels consumed down to their deepest dependent results are measured per iteration)
+	// Note: x^e is only scheduled with homomorphic_replication = true (off by default), otherwise the re-arranging secret share runs every iteration
+	int xeStartChainIndex  = 0;
+	struct refreshSchedulerPLCP refreshScheduler;
+	create_RefreshSchedulerPLCP(&refreshScheduler, contextPtr);
+	int xeRefreshEntry = registerRefreshEntryPLCP(&refreshScheduler, "x^e", downlinkChainIndexPLCP(true, scale, contextPtr));
+	int sRefreshEntry  = registerRefreshEntryPLCP(&refreshScheduler, "s", downlinkChainIndexPLCP(true, scale, contextPtr));
+	refreshScheduler.entries[sRefreshEntry].levelsPerIter = sPlannedLevelsPerIter; // The planned budget of a fresh s (the measured consumption only raises it)
+	// Mod-switch the sums of Eq2-3-4_5 down to the lowest levels serving their consumers before the rotate-and-sum (i.e., fewer primes per key switch)
+	// u is only decrypted, x^e is only refreshed by the secret sharing (without the homomorphic replication), and the floor of x̂p is measured at the 2nd iteration 
+	// as the masked downlink level plus the levels consumed from x̂p by the CUSUM stage (the folded prediction rotates x^e before the products, the homomorphic reset keeps s from x̂p)
+	bool useRotationLevelPlanning = cfg->useRotationLevelPlanning;
+	int xpChainIndex 			  = 0;
+	if(useRotationLevelPlanning){
+		smrp->isRotationLevelPlanned = true;
+		smrp->rotFloorEq2 			 = useHomomorphicReplication ? -1 : downlinkChainIndexPLCP(true, scale, contextPtr);
+		smrp->rotFloorEq3 			 = downlinkChainIndexPLCP(false, scale, contextPtr);
+	}
+	// Encrypt y at the level where the server first consumes it (y: the level of x^e in Eq2-3, y for the residues: the level of x̂p in Eq6)
+	// The levels consumed by the prediction (i.e., from x^e[k] to x̂p[k]) are measured per iteration, y is encrypted at the top until the 2nd iteration
+	bool useLevelTargetedSensing = cfg->useLevelTargetedSensing;
+	int predictionLevels 		 = -1;
+	size_t uplinkBytes 			 = 0; // The bytes of the encrypted sensor measurements sent by the client
+	size_t uplinkTopBytes 		 = 0; // The bytes of the same ciphertexts at the top of the modulus chain
+	// The ciphertexts decrypted by the client are sent at their lowest level (see modSwitchDownlinkPLCP), their bytes are accounted per run
+	memset(&downlinkStatsPLCP_Active, 0, sizeof(struct downlinkStatsPLCP));
+
+	// ================ ================ ================ ================ ================
+	// ================== Parallel Encoding of the Queued Plaintexts and Ciphertexts ====== 
+	// ================ ================ ================ ================ ================	
+	// The wall-clock time is reported as well since clock() sums the CPU time of the worker threads
+	clock_t start_Init_Batch  = clock();
+	auto startWall_Init_Batch = chrono::steady_clock::now();
+	size_t numInitJobs 		  = initBatch->jobs->size();
+	runEncodingBatchPLCP(initBatch, scale, encryptorPtr, encoderPtr, numInitThreads);
+	free_EncodingBatchPLCP(initBatch);
+	free(initBatch);
+	double initBatchWallTime = chrono::duration<double>(chrono::steady_clock::now() - startWall_Init_Batch).count();
+	printf("Parallel Init Encoding: %zu jobs on %d threads, Wall Time-CPU Time: %f-%f\n", numInitJobs, numInitThreads, initBatchWallTime, (double) (clock() - start_Init_Batch) / CLOCKS_PER_SEC);
+
+	// ================ ================ ================ ================ ================
+	// ================== Constants Registry Initialization =============================== 
+	// ================ ================ ================ ================ ================	
+	// Register the constants of the CUSUM stage and the Chebyshev evaluations, so that the loop takes their copies per level instead of encoding them again
+	bool useConstantsRegistry = cfg->useConstantsRegistry;
+	struct constantsRegistryPLCP * constants = NULL;
+	if(useConstantsRegistry){
+		constants = (struct constantsRegistryPLCP *) calloc(1, sizeof(struct constantsRegistryPLCP));
+		create_ConstantsRegistryPLCP(constants, contextPtr, evaluatorPtr);
+		Plaintext * cusumConstants[] = {ss_PL, vv_PL, TAU_PL, alpha_Eq8_PL, beta_Eq8_PL, alpha_Eq9_PL, beta_Eq9_PL, firstChebPowSerTerm_max_PL, firstChebPowSerTerm_ISub_PL, vecOneConst_PL};
+		for(size_t i = 0; i < sizeof(cusumConstants) / sizeof(cusumConstants[0]); i++)
+			registerConstantPLCP(constants, cusumConstants[i]);
+		// The ones vector is also the row-start mask of the homomorphic reset (see applyEquation_10_PLCP)
+		smrp->rowStartMask_PL = vecOneConst_PL;
+		registerConstantVecPLCP(constants, chebPwSrCoefVec_Eq8_PL, 1);
+		registerConstantVecPLCP(constants, chebPwSrCoefVec_Eq9_PL, 1);
+		if(smrp->isRangeFolded){
+			registerConstantVecPLCP(constants, ACLCols_PL, 0);
+			registerConstantVecPLCP(constants, BBCols_PL, 0);
+		}
+		// The operands of x^e and y (taken at the level of x^e instead of the per-iteration copies) and the encrypted constants of Eq2-3
+		Plaintext * linearConstants[] = {GAMMA_PL, LL_PL, KGKG_PL, KLKL_PL, ACL_PL};
+		for(size_t i = 0; i < sizeof(linearConstants) / sizeof(linearConstants[0]); i++)
+			registerConstantPLCP(constants, linearConstants[i]);
+		registerCipherConstantPLCP(constants, xGxG_CP);
+		registerCipherConstantPLCP(constants, KxuGKxuG_CP);
+		activeConstantsPLCP = constants;
+	}
+
+	// ================ ================ ================ ================ ================
+	// ================== Iteration-Invariant Precomputation ============================== 
+	// ================ ================ ================ ================ ================	
+	// uΓ is encrypted once and never updated, thus, B*uΓ of Eq4-5 (the m rotations and products with the folded range transformation) is evaluated once
+	// and kept unrescaled, so that the loop only adds it into the lazy sum of Acl*x̂e[k − 1] at the level of x^e
+	Ciphertext CP_BuGLazy;
+	Ciphertext *BuGLazy_CP = &CP_BuGLazy;
+	precomputeEquation_4_5_PLCP(BuGLazy_CP, smrp, BB_PL, BBCols_PL, uGuG_CP, scale, contextPtr, evaluatorPtr, gal_keysPtr);
+	if(useConstantsRegistry)
+		registerCipherConstantPLCP(constants, BuGLazy_CP);
+
+	// ================ ================ ================ ================ ================
+	// ================== Ciphertext-Plaintext Arena Initialization ======================= 
+	// ================ ================ ================ ================ ================	
+	// The temporaries of the helpers and the per-iteration results are taken from the arena, so that the steady-state iterations reuse the same buffers 
+	struct arenaPLCP * arena = (struct arenaPLCP *) calloc(1, sizeof(struct arenaPLCP));
+	create_ArenaPLCP(arena, contextPtr, 32, 16, 2);
+	activeArenaPLCP = arena;
+	// The cleartext buffers of the sensor measurement, the process noise addition and the CUSUM reset are taken from the session
+	struct sessionPLCP * session = (struct sessionPLCP *) calloc(1, sizeof(struct sessionPLCP));
+	create_SessionPLCP(session, smrp->n, smrp->m, (size_t) smrp->n * smrp->N);
+	activeSessionPLCP = session;
+
+	// ================ ================ ================ ================ ================
+	// ================== Result Extraction Initialization ================================ 
+	// ================ ================ ================ ================ ================	
+	// The results (i.e., u for the plant, the alarm for the CUSUM reset and the reported y, u, alarm, s) are decrypted once into reused buffers and only the slots i * N are gathered
+	// The reporting-only decryptions can be disabled, or handed to a background worker with a bounded queue so that they leave the critical path
+	bool useResultReporting = cfg->useResultReporting;
+	bool useAsyncReporting  = cfg->useAsyncReporting;
+	struct extractorPLCP * extractor = (struct extractorPLCP *) calloc(1, sizeof(struct extractorPLCP));
+	create_ExtractorPLCP(extractor, smd, smrp->n, smrp->N, useResultReporting, useAsyncReporting, 8, decryptorPtr, encoderPtr);
+	activeExtractorPLCP = extractor;
+	// The reported results are sent at their lowest level (see downlink_mod_switch)
+	if(cfg->useDownlinkModSwitch)
+		setExtractorDownlinkPLCP(extractor, scale, contextPtr, evaluatorPtr);
+	// The results carrying the folded range transformation are unscaled (i.e., y and x^p carry sqrt(alpha8), the residues alpha8, s alpha9)
+	if(smrp->isRangeFolded){
+		setExtractorTargetScalePLCP(extractor, RESULT_TARGET_Y, smrp->residueScale);
+		setExtractorTargetScalePLCP(extractor, RESULT_TARGET_XP, smrp->residueScale);
+		setExtractorTargetScalePLCP(extractor, RESULT_TARGET_RESIDUE, smrp->residueScale * smrp->residueScale);
+		setExtractorTargetScalePLCP(extractor, RESULT_TARGET_SBAR, smrp->sScale);
+		setExtractorTargetScalePLCP(extractor, RESULT_TARGET_S, smrp->sScale);
+	}
+	// The records of the iterations are written by a background thread into the results directory (CSV or columnar binary)
+	struct resultsWriterPLCP * resultsWriter = NULL;
+	if(useResultsWriter){
+		resultsWriter = (struct resultsWriterPLCP *) calloc(1, sizeof(struct resultsWriterPLCP));
+		create_ResultsWriterPLCP(resultsWriter, resultsDir, resultsFormat, smd->n, smd->m, 64);
+	}
+
+	// ================ ================ ================ ================ ================
+	// ================== Streaming Ingestion Initialization ============================== 
+	// ================ ================ ================ ================ ================	
+	// Drive the online loop with the live y vectors of stdin, a FIFO or a tailed binary file (the plant is not simulated) until the end of the stream
+	// The results are kept in the last tMax rows of the result vectors (i.e., the iteration k is recorded at k mod tMax), so the memory stays bounded
+	bool useStreamingIngestion 		   = cfg->useStreamingIngestion;
+	enum streamSourcePLCP streamSource = (enum streamSourcePLCP) cfg->streamSource;
+	const char * streamPath 		   = cfg->streamPath; // The FIFO or the tailed binary file
+	size_t streamRingCapacity 		   = cfg->streamRingCapacity; // The y vectors buffered between the source and the online loop
+	int streamReportInterval 		   = 100; // The iterations between the backpressure reports
+	struct streamRingPLCP streamRing;
+	struct streamIngestionPLCP streamIngestion;
+	double * yStream = NULL;
+	if(useStreamingIngestion){
+		create_StreamRingPLCP(&streamRing, smrp->n, streamRingCapacity);
+		startStreamIngestionPLCP(&streamIngestion, &streamRing, streamSource, streamPath);
+		yStream = (double *) calloc(smrp->n, sizeof(double));
+	}
+
+	// ================ ================ ================ ================ ================
+	// ================== Checkpoint Initialization ======================================= 
+	// ================ ================ ================ ================ ================	
+	// Restore x^e[k], s[k] and x[k] of the last checkpoint (the iterations before it are not replayed) 
+	int startIter = 0;
+	if(resumeFromCheckpoint){
+		if(loadStateCheckpointPLCP(checkpointDir, contextPtr, &startIter, xexe_CP, ss_CP, smd->xx, smd->n, &refreshScheduler.entries[xeRefreshEntry].levelsPerIter, &refreshScheduler.entries[xeRefreshEntry].numSkipped))
+			printf("Checkpoint: resumed at the online iteration %d\n", startIter + 1);
+		else
+			printf("Checkpoint: no valid state to resume, the online loop starts from the first iteration\n");
+	}
+	// Snapshot the recurrent state every checkpointInterval iterations (written by a background thread)
+	struct checkpointPLCP * checkpoint = NULL;
+	if(useCheckpointing){
+		checkpoint = (struct checkpointPLCP *) calloc(1, sizeof(struct checkpointPLCP));
+		create_CheckpointPLCP(checkpoint, checkpointDir, checkpointInterval, smd->n);
+	}
 	
 	// End of the initialization	
 	clock_t st_Crypto_Matrix_Vec_Init_End 	= clock(); // # Ciphertext Initialization-End #
@@ -248,21 +524,46 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 	** ====================================================================== 
 	*/
 	bool isFirstIter = true;		
-	for(int k = 0; k < smd->tMax; k++){
+	for(int k = startIter; useStreamingIngestion || k < smd->tMax; k++){
+		// Wait for the next streamed y vector (the loop ends with the stream)
+		if(useStreamingIngestion && !popStreamRingPLCP(&streamRing, yStream))
+			break;
+		// The row of the result vectors recording the iteration
+		int resInd = useStreamingIngestion ? k % smd->tMax : k;
  		// Print the online iteration banner for time measurement tracking  
-		cout << "=====================" << endl;		
-		cout << "Online Iteration: " << k + 1 << endl;   		
-		cout << "=====================" << endl;		
+		if(isLoggedPLCP(LOG_LEVEL_SUMMARY)){
+			cout << "=====================" << endl;		
+			cout << "Online Iteration: " << k + 1 << endl;   		
+			cout << "=====================" << endl;		
+		}
+		// Start the latency measurement of the iteration for the parameter sweep
+		chrono::steady_clock::time_point iterStartTime = chrono::steady_clock::now();
+		// Mark the arena (the per-iteration results are released at the end of the iteration)
+		struct arenaMarkPLCP iterMark = markArenaPLCP();
 
 		// Sensor measurement (System- Physical Plant) - Cleartext Part     	
 		// Receive the encrypted noisy sensor measurement
 		clock_t start_SensMeasurement = clock(); 
 		Ciphertext CP_yy, CP_yyAS; 
 		Ciphertext *yy_CP, *yyAS_CP; 	
-		yy_CP 	 = &CP_yy;	
-		yyAS_CP  = &CP_yyAS;		
-		sense_Encrypt_y(smd, smrp, k, yy_CP, yyAS_CP, scale, contextPtr, encryptorPtr, encoderPtr); // Fulfill the sensing duty of client		  
+		yy_CP 	 = acquireCiphertextArena(&CP_yy);	
+		yyAS_CP  = acquireCiphertextArena(&CP_yyAS);		
+		parms_id_type yyParmsId = parms_id_zero, yyASParmsId = parms_id_zero;
+		if(useLevelTargetedSensing && k > 0){
+			yyParmsId = xexe_CP->parms_id();
+			if(predictionLevels >= 0)
+				yyASParmsId = parmsIdBelowPLCP(contextPtr, xexe_CP->parms_id(), predictionLevels);
+		}else if(useLevelTargetedSensing)
+			yyParmsId = contextPtr->last_parms_id(); // y is not consumed at the very first iteration (only the residues of x̂p[0])
+		if(useStreamingIngestion)
+			sense_Encrypt_y_Stream(yStream, smrp, yy_CP, yyAS_CP, yyParmsId, yyASParmsId, scale, encryptorPtr, encoderPtr); // Encrypt the live sensor measurement
+		else
+			sense_Encrypt_y(smd, smrp, k, yy_CP, yyAS_CP, yyParmsId, yyASParmsId, scale, contextPtr, encryptorPtr, encoderPtr); // Fulfill the sensing duty of client		  
 		clock_t end_SensMeasurement = clock();	 	
+		uplinkBytes 	+= ciphertextBytesPLCP(yy_CP) + ciphertextBytesPLCP(yyAS_CP);
+		uplinkTopBytes 	+= topLevelCiphertextBytesPLCP(contextPtr, yy_CP) + topLevelCiphertextBytesPLCP(contextPtr, yyAS_CP);
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("Uplink y Bytes-Top Level Bytes: %zu-%zu\n", ciphertextBytesPLCP(yy_CP) + ciphertextBytesPLCP(yyAS_CP), topLevelCiphertextBytesPLCP(contextPtr, yy_CP) + topLevelCiphertextBytesPLCP(contextPtr, yyAS_CP));
 	
 		// Compute Sensor Measurement Phase Duration 
 		double sens_Meas_Indv  = (double) (end_SensMeasurement - start_SensMeasurement) / CLOCKS_PER_SEC;
@@ -272,10 +573,10 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 		// Define ciphertexts for the results of the crypto-estimation, control action, prediction, residues functions   
 		Ciphertext CP_secEqRes, CP_thirdEqRes, CP_fourthfifthEqRes, CP_sixthEqRes;		
 		Ciphertext * secEqRes_CP, * thirdEqRes_CP, * fourthfifthEqRes_CP, * sixthEqRes_CP;  
-		secEqRes_CP   = &CP_secEqRes; 		
-		thirdEqRes_CP = &CP_thirdEqRes; 		
-		fourthfifthEqRes_CP = &CP_fourthfifthEqRes; 
-		sixthEqRes_CP = & CP_sixthEqRes; 
+		secEqRes_CP   = acquireCiphertextArena(&CP_secEqRes); 		
+		thirdEqRes_CP = acquireCiphertextArena(&CP_thirdEqRes); 		
+		fourthfifthEqRes_CP = acquireCiphertextArena(&CP_fourthfifthEqRes); 
+		sixthEqRes_CP = acquireCiphertextArena(&CP_sixthEqRes); 
 
 		// Define the time measurement variables for each separate phase  
 		double Eq2_Meas_Indv 	= 0;
@@ -288,32 +589,61 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 		// ================ ================ ================ ================ ================		
 		if(k > 0){ // or if (k >= 1)
 			isFirstIter = false;
+			xeStartChainIndex = (*contextPtr->get_context_data(xexe_CP->parms_id())).chain_index();
+			beginRefreshIterationPLCP(&refreshScheduler, xeRefreshEntry, xexe_CP);
+			// The registered operands are taken at the level of x^e from the registry. Without the registry, the operands are copied per iteration, 
+			// since the chain adjustment mod-switches them in place and the level of the replicated x^e varies
+			Plaintext *GAMMA_Iter_PL = GAMMA_PL, *LL_Iter_PL = LL_PL, *KGKG_Iter_PL = KGKG_PL, *KLKL_Iter_PL = KLKL_PL, *ACL_Iter_PL = ACL_PL;
+			Ciphertext *xGxG_Iter_CP = xGxG_CP, *KxuGKxuG_Iter_CP = KxuGKxuG_CP, *BuGLazy_Iter_CP = BuGLazy_CP;
+			Plaintext PL_GAMMA_Iter, PL_LL_Iter, PL_KGKG_Iter, PL_KLKL_Iter, PL_ACL_Iter;
+			Ciphertext CP_xGxG_Iter, CP_KxuGKxuG_Iter, CP_BuGLazy_Iter;
+			if(!useConstantsRegistry){
+				GAMMA_Iter_PL 	 = acquirePlaintextArena(&PL_GAMMA_Iter);
+				LL_Iter_PL 		 = acquirePlaintextArena(&PL_LL_Iter);
+				KGKG_Iter_PL 	 = acquirePlaintextArena(&PL_KGKG_Iter);
+				KLKL_Iter_PL 	 = acquirePlaintextArena(&PL_KLKL_Iter);
+				ACL_Iter_PL 	 = acquirePlaintextArena(&PL_ACL_Iter);
+				xGxG_Iter_CP 	 = acquireCiphertextArena(&CP_xGxG_Iter);
+				KxuGKxuG_Iter_CP = acquireCiphertextArena(&CP_KxuGKxuG_Iter);
+				BuGLazy_Iter_CP  = acquireCiphertextArena(&CP_BuGLazy_Iter);
+				*GAMMA_Iter_PL = *GAMMA_PL; *LL_Iter_PL = *LL_PL; *KGKG_Iter_PL = *KGKG_PL; *KLKL_Iter_PL = *KLKL_PL; *ACL_Iter_PL = *ACL_PL;
+				*xGxG_Iter_CP = *xGxG_CP; *KxuGKxuG_Iter_CP = *KxuGKxuG_CP; *BuGLazy_Iter_CP = *BuGLazy_CP;
+			}
 			// Estimation Phase (Equation-2) 
 			clock_t start_2ndEquation = clock();
-			applyEquation_2_PLCP(secEqRes_CP, smrp, GAMMA_PL,  LL_PL, xGxG_CP, yy_CP, xexe_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
+			applyEquation_2_PLCP(secEqRes_CP, smrp, GAMMA_Iter_PL, LL_Iter_PL, xGxG_Iter_CP, yy_CP, xexe_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
 			clock_t end_2ndEquation = clock();	
 			// Compute Estimate Phase Duration 
 			Eq2_Meas_Indv  = (double) (end_2ndEquation - start_2ndEquation) / CLOCKS_PER_SEC;
 			Eq2Time    += Eq2_Meas_Indv;
-			printf("Estimation x^e- Eq2 Measur. Time-Indiv. Measur.: %f-%f\n", Eq2Time, Eq2_Meas_Indv);	
+			if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+				printf("Estimation x^e- Eq2 Measur. Time-Indiv. Measur.: %f-%f\n", Eq2Time, Eq2_Meas_Indv);
 			
 			// Control Action Phase (Equation-3)  
 			clock_t start_3rdEquation = clock();			
-			applyEquation_3_PLCP(thirdEqRes_CP, smrp, KGKG_PL, KLKL_PL, KxuGKxuG_CP, yy_CP, xexe_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
+			applyEquation_3_PLCP(thirdEqRes_CP, smrp, KGKG_Iter_PL, KLKL_Iter_PL, KxuGKxuG_Iter_CP, yy_CP, xexe_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
 			clock_t end_3rdEquation = clock();
 			// Compute Control Action Phase Duration  
 			Eq3_Meas_Indv  = (double) (end_3rdEquation - start_3rdEquation) / CLOCKS_PER_SEC;
 			Eq3Time    += Eq3_Meas_Indv;
-			printf("Control u- Eq3 Measur. Time-Indiv. Measur.: %f-%f\n", Eq3Time, Eq3_Meas_Indv);	
+			if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+				printf("Control u- Eq3 Measur. Time-Indiv. Measur.: %f-%f\n", Eq3Time, Eq3_Meas_Indv);
 
 			// Prediction Phase (Equation-4-5) 
 			clock_t start_4_5_th_Equation = clock();
-			applyEquation_4_5_PLCP(fourthfifthEqRes_CP, smrp, ACL_PL, BB_PL, uGuG_CP, xexe_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
+			if(smrp->isRangeFolded)
+				applyEquation_4_5_Folded_PLCP(fourthfifthEqRes_CP, smrp, ACLCols_PL, BuGLazy_Iter_CP, xexe_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
+			else
+				applyEquation_4_5_PLCP(fourthfifthEqRes_CP, smrp, ACL_Iter_PL, BuGLazy_Iter_CP, xexe_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
 			clock_t end_4_5_th_Equation = clock();
+			// Measure the levels consumed by the prediction (the residues of y are encrypted at the level of x̂p from the next iteration)
+			xpChainIndex 	 = (*contextPtr->get_context_data(fourthfifthEqRes_CP->parms_id())).chain_index();
+			predictionLevels = xeStartChainIndex - xpChainIndex;
 			// Compute Prediction Phase Duration
 			Eq4_5_Meas_Indv  = (double) (end_4_5_th_Equation - start_4_5_th_Equation) / CLOCKS_PER_SEC;
 			Eq4_5Time    += Eq4_5_Meas_Indv;
-			printf("Prediction x^p- Eq4_5 Measur. Time-Indiv. Measur.: %f-%f\n", Eq4_5Time, Eq4_5_Meas_Indv);	
+			if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+				printf("Prediction x^p- Eq4_5 Measur. Time-Indiv. Measur.: %f-%f\n", Eq4_5Time, Eq4_5_Meas_Indv);
 			// exit(0);
 
 			// Residues Phase (Equation-6) 
@@ -323,7 +653,8 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 			// Compute Residues Phase Duration 
 			Eq6_Meas_Indv  = (double) (end_6_th_Equation - start_6_th_Equation) / CLOCKS_PER_SEC;
 			Eq6Time    += Eq6_Meas_Indv;
-			printf("Residues r- Eq6 Measur. Time-Indiv. Measur.: %f-%f\n", Eq6Time, Eq6_Meas_Indv);	
+			if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+				printf("Residues r- Eq6 Measur. Time-Indiv. Measur.: %f-%f\n", Eq6Time, Eq6_Meas_Indv);
  		} 
 
 		// ================ ================ ================ ================ ================
@@ -339,7 +670,8 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 			// Compute Control Action Phase Duration
 			Eq3_Meas_Indv  = (double) (end_3rdEquation - start_3rdEquation) / CLOCKS_PER_SEC;
 			Eq3Time    += Eq3_Meas_Indv;
-			printf("Control Action u - Eq3 Measur. Time-Indiv. Measur.: %f-%f\n", Eq3Time, Eq3_Meas_Indv);	
+			if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+				printf("Control Action u - Eq3 Measur. Time-Indiv. Measur.: %f-%f\n", Eq3Time, Eq3_Meas_Indv);
 
 			// Residues Phase (Equation-6)
 			clock_t start_6_th_Equation = clock();		
@@ -348,7 +680,8 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 			// Compute Residues Phase Duration
 			Eq6_Meas_Indv  = (double) (end_6_th_Equation - start_6_th_Equation) / CLOCKS_PER_SEC;
 			Eq6Time    += Eq6_Meas_Indv;
-			printf("Residues r- Eq6 Measur. Time-Indiv. Measur.: %f-%f\n", Eq6Time, Eq6_Meas_Indv);	
+			if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+				printf("Residues r- Eq6 Measur. Time-Indiv. Measur.: %f-%f\n", Eq6Time, Eq6_Meas_Indv);
 		}
 
 		/* 
@@ -360,13 +693,17 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 		*/
 		// Initial-CUSUM-Alarm Phase (Equation-8-9)	
 		clock_t start_8_9_th_Equation = clock();				
+		beginRefreshIterationPLCP(&refreshScheduler, sRefreshEntry, ss_CP);
 		Plaintext PL_vecOne; 
-		Plaintext *vecOne_PL = & PL_vecOne;
-		makePlaintextMatRowPacking(smrp->One_MRP, scale, vecOne_PL, encoderPtr);
+		Plaintext *vecOne_PL = vecOneConst_PL; // The registered ones vector is not adjusted in place, thus, it is not encoded again
+		if(!useConstantsRegistry){
+			vecOne_PL = acquirePlaintextArena(&PL_vecOne);
+			makePlaintextMatRowPacking(smrp->One_MRP, scale, vecOne_PL, encoderPtr);
+		}
 		// Apply Chebyshev Appx. for both Equation-8-9      
 		Ciphertext CP_eigthEqRes, CP_ninthEqRes;
-		Ciphertext * eigthEqRes_CP = &CP_eigthEqRes;		
-		Ciphertext * ninthEqRes_CP = &CP_ninthEqRes;		 	
+		Ciphertext * eigthEqRes_CP = acquireCiphertextArena(&CP_eigthEqRes);		
+		Ciphertext * ninthEqRes_CP = acquireCiphertextArena(&CP_ninthEqRes);		 	
 		applyEquation_CUSUM_PLCP(eigthEqRes_CP, ninthEqRes_CP, smrp, smd, k, ss_PL, vv_PL, 
 								 TAU_PL, alpha_Eq8_PL, beta_Eq8_PL, alpha_Eq9_PL, beta_Eq9_PL,
 								 vecOne_PL, 
@@ -378,7 +715,8 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 		// Compute CUSUM-Alarm Phase Duration 
 		double CUSUM_Meas_Indv  = (double) (end_8_9_th_Equation - start_8_9_th_Equation) / CLOCKS_PER_SEC;
 		CUSUMTime   += CUSUM_Meas_Indv;
-		printf("CUSUM Time-Indiv. Measur.: %f-%f\n", CUSUMTime, CUSUM_Meas_Indv);
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("CUSUM Time-Indiv. Measur.: %f-%f\n", CUSUMTime, CUSUM_Meas_Indv);
 	
 		// CUSUM-Parametric Sum Phase 
 		clock_t start_10_th_Equation = clock();	
@@ -387,7 +725,8 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 		// Compute CUSUM-Parametric Sum Phase Duration 
 		double Eq10_Meas_Indv  = (double) (end_10_th_Equation - start_10_th_Equation) / CLOCKS_PER_SEC;
 		Eq10Time   += Eq10_Meas_Indv;
-		printf("Alarm Computation Eq10 Measur. Time-Indiv. Measur.: %f-%f\n", Eq10Time, Eq10_Meas_Indv);	
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("Alarm Computation Eq10 Measur. Time-Indiv. Measur.: %f-%f\n", Eq10Time, Eq10_Meas_Indv);
 
 		/* 
 		** ====================================================================== 
@@ -396,21 +735,55 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 		** ======================================================================
 		** ====================================================================== 
 		*/
+		// Record the levels consumed from x^e[k - 1] and s[k] by the iteration (the planned rotation level of the prediction pins x̂p to its floor, thus, 
+		// the consumption of x^e is measured before the floor is planned)
+		if(k > 0 && smrp->rotFloorEq4_5 < 0){
+			int deepestChainIndex = min((*contextPtr->get_context_data(eigthEqRes_CP->parms_id())).chain_index(), (*contextPtr->get_context_data(ninthEqRes_CP->parms_id())).chain_index());
+			if(smrp->isResetHomomorphic)
+				deepestChainIndex = min(deepestChainIndex, (int) (*contextPtr->get_context_data(ss_CP->parms_id())).chain_index());
+			recordRefreshConsumptionPLCP(&refreshScheduler, xeRefreshEntry, deepestChainIndex);
+		}
+		if(smrp->isResetHomomorphic)
+			recordRefreshConsumptionPLCP(&refreshScheduler, sRefreshEntry, (*contextPtr->get_context_data(ss_CP->parms_id())).chain_index());
+
+		// Plan the rotation level of the prediction once (the deepest CUSUM result still holds the masked values of Eq10)
+		if(k > 0 && smrp->isRotationLevelPlanned && smrp->rotFloorEq4_5 < 0 && !smrp->isRangeFolded && !smrp->isResetHomomorphic){
+			int deepestChainIndex = min((*contextPtr->get_context_data(eigthEqRes_CP->parms_id())).chain_index(), (*contextPtr->get_context_data(ninthEqRes_CP->parms_id())).chain_index());
+			smrp->rotFloorEq4_5   = downlinkChainIndexPLCP(true, scale, contextPtr) + (xpChainIndex - deepestChainIndex);
+			if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+				printf("Rotation Level Floors Eq2-Eq3-Eq4_5: %d-%d-%d\n", smrp->rotFloorEq2, smrp->rotFloorEq3, smrp->rotFloorEq4_5);
+		}
+
 		// Secret-share Phase (for next iteration) 
 		clock_t start_Last_Secret_Share = clock(); 				
-		if(k > 0){
+		if(k > 0 && useHomomorphicReplication){
+			// Replicate x^e[k] homomorphically and refresh it (layout-agnostic, no re-arrangement) only if its remaining levels cannot fit the next iteration
+			replicateVectorMRP(xexe_CP, secEqRes_CP, rowStartMask_PL, diagMask_PL, scale, smrp->N, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr);
+			// The refresh decrypts the masked replica itself, thus, the replica is kept above the masked downlink level as well
+			if(smrp->rotFloorEq4_5 < 0)
+				recordRefreshConsumptionPLCP(&refreshScheduler, xeRefreshEntry, (*contextPtr->get_context_data(xexe_CP->parms_id())).chain_index());
+			if(isRefreshNeededPLCP(&refreshScheduler, xeRefreshEntry, xexe_CP))
+				secretSharev2(xexe_CP, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, scale, encoderPtr->slot_count() / smrp->N, smrp->n, smrp->N);
+		}else if(k > 0){
+			// The secret share also re-arranges x^e[k] into the repeated MRP format, thus, it cannot be skipped (i.e., x^e is refreshed every iteration)
 			secretShareEstimation(secEqRes_CP, contextPtr,  encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, scale, smrp->n, smrp->n,  smrp->N);
+			refreshScheduler.entries[xeRefreshEntry].numRefreshes++;
 			*xexe_CP = *secEqRes_CP;
 		}
+		// Refresh the homomorphically reset s[k + 1] (the alarm is never decrypted) only if its remaining levels cannot fit the next CUSUM stage
+		if(smrp->isResetHomomorphic && isRefreshNeededPLCP(&refreshScheduler, sRefreshEntry, ss_CP))
+			secretSharev2(ss_CP, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, scale, smrp->n, smrp->n, smrp->N);
 		clock_t end_Last_Secret_Share = clock();	
 		// Compute Secret Share Phase Duration 
 		double LastSecretShare_Meas_Indv  = (double) (end_Last_Secret_Share - start_Last_Secret_Share) / CLOCKS_PER_SEC;
 		EqLastSecretShareTime    		 += LastSecretShare_Meas_Indv;
-		printf("Last Secret Share of x^e Measur. Time-Indiv. Measur.: %f-%f\n", EqLastSecretShareTime, LastSecretShare_Meas_Indv);	
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("Last Secret Share of x^e Measur. Time-Indiv. Measur.: %f-%f\n", EqLastSecretShareTime, LastSecretShare_Meas_Indv);	
 
-		// Apply process noise phase 	
+		// Apply process noise phase (the live plant evolves by itself in the streaming mode)	
 		clock_t start_Process_Noise_Addition = clock();
-		applyXVecNoiseAddition(thirdEqRes_CP, k, smrp, smd, scale, contextPtr, encryptorPtr, decryptorPtr, encoderPtr);	
+		if(!useStreamingIngestion)
+			applyXVecNoiseAddition(thirdEqRes_CP, k, smrp, smd, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr);	
 		clock_t end_Process_Noise_Addition  = clock();
 		// Compute process noise phase duration 
 		double Process_Noise_Addition_Meas_Indv  = (double) (end_Process_Noise_Addition - start_Process_Noise_Addition)/CLOCKS_PER_SEC;
@@ -421,14 +794,16 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 		// =========================== =========================== ===============
 		// =========== PRINT TIME MEASUREMENT COMPUTATIONS =======================  
 	 	// =========================== =========================== =============== 		 	
-		printf("Sensor Measurement Time-Indiv. Measur.: %f-Enc-%f-Proc-Noise-%f\n", SensorMeasurementTime, sens_Meas_Indv, Process_Noise_Addition_Meas_Indv);
-		cout << "Iteration" << k << " Individual Times " << endl;
-		if (k == 0)
-			cout  <<  sens_Meas_Indv << "," << 0 << "," << Eq3_Meas_Indv << "," << 0 << "," << Eq6_Meas_Indv << "," << CUSUM_Meas_Indv << "," << Eq10_Meas_Indv << "," << LastSecretShare_Meas_Indv << "," <<	Process_Noise_Addition_Meas_Indv << endl;
-		else 
-			cout <<  sens_Meas_Indv << "," << Eq2_Meas_Indv << "," << Eq3_Meas_Indv << "," << Eq4_5_Meas_Indv << "," << Eq6_Meas_Indv << "," << CUSUM_Meas_Indv << "," << Eq10_Meas_Indv << "," << LastSecretShare_Meas_Indv << "," <<	Process_Noise_Addition_Meas_Indv << endl;
-		cout << "Iteration" << k << " Total Times" << endl;
-		cout << SensorMeasurementTime << "," << encryptionYTime << "," << decryptionUTime << "," << Eq2Time << "," << Eq3Time <<  "," <<  Eq4_5Time << "," << Eq6Time <<  "," <<  CUSUMTime <<  "," << Eq10Time << "," << EqLastSecretShareTime << endl;   
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE)){
+			printf("Sensor Measurement Time-Indiv. Measur.: %f-Enc-%f-Proc-Noise-%f\n", SensorMeasurementTime, sens_Meas_Indv, Process_Noise_Addition_Meas_Indv);
+			cout << "Iteration" << k << " Individual Times " << endl;
+			if (k == 0)
+				cout  <<  sens_Meas_Indv << "," << 0 << "," << Eq3_Meas_Indv << "," << 0 << "," << Eq6_Meas_Indv << "," << CUSUM_Meas_Indv << "," << Eq10_Meas_Indv << "," << LastSecretShare_Meas_Indv << "," <<	Process_Noise_Addition_Meas_Indv << endl;
+			else 
+				cout <<  sens_Meas_Indv << "," << Eq2_Meas_Indv << "," << Eq3_Meas_Indv << "," << Eq4_5_Meas_Indv << "," << Eq6_Meas_Indv << "," << CUSUM_Meas_Indv << "," << Eq10_Meas_Indv << "," << LastSecretShare_Meas_Indv << "," <<	Process_Noise_Addition_Meas_Indv << endl;
+			cout << "Iteration" << k << " Total Times" << endl;
+			cout << SensorMeasurementTime << "," << encryptionYTime << "," << decryptionUTime << "," << Eq2Time << "," << Eq3Time <<  "," <<  Eq4_5Time << "," << Eq6Time <<  "," <<  CUSUMTime <<  "," << Eq10Time << "," << EqLastSecretShareTime << endl;   
+		}
 
 		
 		// =========================== =========================== ==========================
@@ -436,18 +811,602 @@ FILE *fp,  double scale,  size_t numberOfIterations){
 	 	// =========================== =========================== ========================== 
 		// ## Four targets: y, u, alarm, s 	
 		// /*						
-		extractExpRes(yyAS_CP, smrp, smd, k, smd->n, scale, contextPtr, decryptorPtr, encoderPtr, "y"); // Sensor Measurement
+		reportResultPLCP(extractor, yyAS_CP, RESULT_TARGET_Y, resInd); // Sensor Measurement
 		// Note: Changes based on the first iteration	
-		// extractExpRes(secEqRes_CP, smrp, smd, k, smd->n, scale, contextPtr, decryptorPtr, encoderPtr, "xe"); // Estimation		
-		extractExpRes(thirdEqRes_CP, smrp, smd, k, smd->n, scale, contextPtr, decryptorPtr, encoderPtr, "u"); // Control 		
+		// reportResultPLCP(extractor, secEqRes_CP, RESULT_TARGET_XE, k); // Estimation		
+		reportResultPLCP(extractor, thirdEqRes_CP, RESULT_TARGET_U, resInd); // Control 		
 		// Note: Changes based on the first iteration			
-		// extractExpRes(fourthfifthEqRes_CP, smrp, smd, k, smd->n, scale, contextPtr, decryptorPtr, encoderPtr, "xp");		
-		// extractExpRes(sixthEqRes_CP, smrp, smd, k, smd->n, scale, contextPtr, decryptorPtr, encoderPtr, "residue"); // Residue		
-		// extractExpRes(eigthEqRes_CP, smrp, smd, k + 1, smd->n, scale, contextPtr, decryptorPtr, encoderPtr, "alarm"); // RELU Appx. Function  
-		extractExpRes(ninthEqRes_CP, smrp, smd, k, smd->n, scale, contextPtr, decryptorPtr, encoderPtr, "alarm"); // Alarm Appx. Func. (Indicator funct)		
-		extractExpRes(ss_CP, smrp, smd, k + 1, smd->n, scale, contextPtr, decryptorPtr, encoderPtr, "s"); // CUSUM parametric SUM
+		// reportResultPLCP(extractor, fourthfifthEqRes_CP, RESULT_TARGET_XP, k);		
+		// reportResultPLCP(extractor, eigthEqRes_CP, RESULT_TARGET_ALARM, k + 1); // RELU Appx. Function  
+		reportResultPLCP(extractor, ninthEqRes_CP, RESULT_TARGET_ALARM, resInd); // Alarm Appx. Func. (Indicator funct)		
+		reportResultPLCP(extractor, ss_CP, RESULT_TARGET_S, resInd + 1); // CUSUM parametric SUM
 		// */
+		// Push the record of the iteration to the results writer (the queued reports are finished first, since the record is taken from the result vectors)
+		if(useResultsWriter){
+			reportResultPLCP(extractor, sixthEqRes_CP, RESULT_TARGET_RESIDUE, resInd); // Residue (only decrypted for the record)
+			drainExtractorPLCP(extractor);
+			double iterTimings[numResultTimings] = {sens_Meas_Indv, Eq2_Meas_Indv, Eq3_Meas_Indv, Eq4_5_Meas_Indv, Eq6_Meas_Indv, CUSUM_Meas_Indv, Eq10_Meas_Indv, LastSecretShare_Meas_Indv, Process_Noise_Addition_Meas_Indv};
+			pushResultsRecordPLCP(resultsWriter, k, smd->y_Res[resInd], smd->u_Res[resInd], smd->alarm_Res[resInd], smd->s_Res[resInd + 1], smd->residue_Res[resInd], iterTimings);
+		}
+
+		// Release the per-iteration results to the arena
+		releaseArenaPLCP(iterMark);
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printArenaPLCP(arena);
+		// Checkpoint the state for the next iteration (i.e., x^e[k + 1], s[k + 1] and x[k + 1])
+		if(useCheckpointing && (k + 1) % checkpointInterval == 0)
+			scheduleCheckpointPLCP(checkpoint, k + 1, xexe_CP, ss_CP, smd->xx, refreshScheduler.entries[xeRefreshEntry].levelsPerIter, refreshScheduler.entries[xeRefreshEntry].numSkipped);
+		// Report the backpressure of the stream (i.e., a growing occupancy or full stalls mean that the online loop is slower than the source)
+		if(useStreamingIngestion && (k + 1) % streamReportInterval == 0)
+			printStreamRingPLCP(&streamRing);
+		// Record the iteration latency of the parameter sweep point
+		if(activeSweepPointPLCP != NULL)
+			recordSweepIterationPLCP(activeSweepPointPLCP, chrono::duration<double>(chrono::steady_clock::now() - iterStartTime).count());
+	}
+
+	// Report the uplink of the encrypted sensor measurements against the top level encryption, and the downlink of the decrypted ciphertexts
+	if(uplinkTopBytes > 0)
+		printf("Uplink y Total Bytes-Top Level Bytes-Ratio: %zu-%zu-%f\n", uplinkBytes, uplinkTopBytes, (double) uplinkBytes / uplinkTopBytes);
+	printDownlinkStatsPLCP(&downlinkStatsPLCP_Active);
+	printRefreshSchedulerPLCP(&refreshScheduler);
+
+	// Stop the streaming ingestion
+	if(useStreamingIngestion){
+		stopStreamIngestionPLCP(&streamIngestion);
+		printStreamRingPLCP(&streamRing);
+		free_StreamRingPLCP(&streamRing);
+		free(yStream);
+	}
+
+	// Wait for the last checkpoint
+	if(useCheckpointing){
+		waitCheckpointPLCP(checkpoint);
+		printCheckpointPLCP(checkpoint);
+		free_CheckpointPLCP(checkpoint);
+		free(checkpoint);
+	}
+
+	// Write the pushed records and free the results writer
+	if(useResultsWriter){
+		closeResultsWriterPLCP(resultsWriter);
+		printResultsWriterPLCP(resultsWriter);
+		free_ResultsWriterPLCP(resultsWriter);
+		free(resultsWriter);
+	}
+
+	// Finish the queued reports and free the extractor
+	activeExtractorPLCP = NULL;
+	free_ExtractorPLCP(extractor);
+	printExtractorPLCP(extractor);
+	free(extractor);
+	// Compare the extracted results with the cleartext reference of the parameter sweep point
+	if(activeSweepPointPLCP != NULL)
+		evaluateSweepPointPLCP(activeSweepPointPLCP, smd);
+
+	// Free the arena, the session and the constants registry
+	activeArenaPLCP = NULL;
+	free_ArenaPLCP(arena);
+	free(arena);
+	activeSessionPLCP = NULL;
+	free_SessionPLCP(session);
+	free(session);
+	if(useConstantsRegistry){
+		printConstantsRegistryPLCP(constants);
+		activeConstantsPLCP = NULL;
+		free_ConstantsRegistryPLCP(constants);
+		free(constants);
+	}
+	// Free the Chebyshev coefficient vectors and the simulation data
+	delete chebPwSrCoefVec_Eq8_PL;
+	delete chebPwSrCoefVec_Eq9_PL;
+	delete ACLCols_PL;
+	delete BBCols_PL;
+	free_SimulationMatrixDataMRP(smrp);
+	free(smrp);
+	free_SimulationMatrixData(smd);
+	free(smd);
+}
+
+/*
+	The function for performing the cyberphysical system's functionalities (one after another) in the tiled (multi-ciphertext) MRP format
+	Note: Used when the single ciphertext MRP layout overflows the slots (i.e., n * N > slot_count). The matrix-vector multiplications
+		  are computed per tile on the worker threads, whereas the element-wise CUSUM and the alarm computations are applied per row tile.
+		  The precomputed model vectors (i.e., xΓ, KxuΓ, Kx) are added as plaintexts after the rotations since the cloud knows the model.
+*/
+void performTiledMatrixVectorMultiplicationsPlain(SEALContext *contextPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, 
+	Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, struct simulationMatrixData *smd, struct simulationMatrixMRP *smrp, double scale, size_t maxColTileWidth){
+
+	/* 
+	** =============================================================== 
+	** ==================== TILED SYSTEM INITIALIZATION ============== 
+	** =============================================================== 
+	*/
+	clock_t st_Crypto_Matrix_Vec_Init_Start = clock(); // # Ciphertext Initialization-Start #	
+	// Create the tiled layouts for the (n x n), (m x n) and (n x m) matrices
+	size_t slotCount = encoderPtr->slot_count();
+	int N 			 = calculateTiledSegmentSize(smd->n, slotCount, maxColTileWidth);
+	int numThreads 	 = (currentRunConfigPLCP()->numThreads > 0) ? currentRunConfigPLCP()->numThreads : (int) thread::hardware_concurrency();
+	struct tiledLayoutMRP tlNN, tlMN, tlNM;
+	calculateTiledLayoutMRP(&tlNN, smd->n, smd->n, N, slotCount);
+	calculateTiledLayoutMRP(&tlMN, smd->m, smd->n, N, slotCount);
+	calculateTiledLayoutMRP(&tlNM, smd->n, smd->m, N, slotCount);
+	printf("Tiled MRP Layout: n = %d, N = %d, Row Tiles = %d, Column Tiles = %d, Rows per Tile = %d, Threads = %d\n", smd->n, N, tlNN.numRowTiles, tlNN.numColTiles, tlNN.rowsPerTile, numThreads);
+
+	// Equation-2-3-4-5 matrix tiles
+	vector<vector<double>> cleartextTiles;
+	vector<Plaintext> GAMMA_PL, LL_PL, KGKG_PL, KLKL_PL, ACL_PL, BB_PL;
+	genTiledMatMRP_RPL(&cleartextTiles, smd->GAMMA, &tlNN); makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &GAMMA_PL, encoderPtr, true);
+	genTiledMatMRP_RPL(&cleartextTiles, smd->LL, &tlNN);    makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &LL_PL, encoderPtr, true);
+	genTiledMatMRP_RPL(&cleartextTiles, smd->KGKG, &tlMN);  makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &KGKG_PL, encoderPtr, true);
+	genTiledMatMRP_RPL(&cleartextTiles, smd->KLKL, &tlMN);  makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &KLKL_PL, encoderPtr, true);
+	genTiledMatMRP_RPL(&cleartextTiles, smd->ACL, &tlNN);   makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &ACL_PL, encoderPtr, true);
+	genTiledMatMRP_RPL(&cleartextTiles, smd->BB, &tlNM);    makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &BB_PL, encoderPtr, true);
+	// Equation-2-3-6 precomputed vector tiles
+	vector<Plaintext> xGxG_PL, KxuGKxuG_PL, KxKx_PL, xpxp_PL;
+	genTiledAddVecMRP_RPL(&cleartextTiles, smd->xGxG, &tlNN);     makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &xGxG_PL, encoderPtr, false);
+	genTiledAddVecMRP_RPL(&cleartextTiles, smd->KxuGKxuG, &tlMN); makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &KxuGKxuG_PL, encoderPtr, false);
+	genTiledAddVecMRP_RPL(&cleartextTiles, smd->KxKx, &tlMN);     makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &KxKx_PL, encoderPtr, false);
+	genTiledAddVecMRP_RPL(&cleartextTiles, smd->xpxp, &tlNN);     makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &xpxp_PL, encoderPtr, false);
+	// Equation-2-3-4-5 ciphertext tiles
+	vector<Ciphertext> xexe_CP, uGuG_AS_CP, uGuG_CP;
+	genTiledRepXVecMRP_RPL(&cleartextTiles, smd->xexe, &tlNN); encryptTiledVectorMatRowPacking(&cleartextTiles, scale, &xexe_CP, encryptorPtr, encoderPtr);
+	genTiledAddVecMRP_RPL(&cleartextTiles, smd->uGuG, &tlMN);  encryptTiledVectorMatRowPacking(&cleartextTiles, scale, &uGuG_AS_CP, encryptorPtr, encoderPtr); // Used in the very first iteration
+	genTiledRepXVecMRP_RPL(&cleartextTiles, smd->uGuG, &tlNM); encryptTiledVectorMatRowPacking(&cleartextTiles, scale, &uGuG_CP, encryptorPtr, encoderPtr);
+	// Equation-8-9 vector tiles
+	vector<Plaintext> ss_PL, vv_PL, TAU_PL, alpha_Eq8_PL, beta_Eq8_PL, alpha_Eq9_PL, beta_Eq9_PL, firstChebPowSerTerm_max_PL, firstChebPowSerTerm_ISub_PL;
+	vector<Ciphertext> ss_CP, vecOne_last_CP;
+	genTiledAddVecMRP_RPL(&cleartextTiles, smd->ss, &tlNN);  makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &ss_PL, encoderPtr, false);
+	encryptTiledVectorMatRowPacking(&cleartextTiles, scale, &ss_CP, encryptorPtr, encoderPtr);
+	genTiledAddVecMRP_RPL(&cleartextTiles, smd->vv, &tlNN);  makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &vv_PL, encoderPtr, false);
+	genTiledAddVecMRP_RPL(&cleartextTiles, smd->TAU, &tlNN); makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &TAU_PL, encoderPtr, false);
+	genTiledAddVecMRP_RPL(&cleartextTiles, smd->eq8maxAppx_PS_FT_D12_y_10_u_2, &tlNN); makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &firstChebPowSerTerm_max_PL, encoderPtr, false);
+	genTiledAddVecMRP_RPL(&cleartextTiles, smd->eq9ISubAppx_PS_FT_D12_y_10_u_2, &tlNN); makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &firstChebPowSerTerm_ISub_PL, encoderPtr, false);
+	// Chebyshev range transformation tiles from [a,b] to [-1, 1] (i.e., alpha and beta + 1 as in genRangTransfVecChebApprx)
+	genTiledConstVecMRP_RPL(&cleartextTiles, 2 / (smrp->alpbetUpBouEq8 - smrp->alpbetLowBouEq8), &tlNN); makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &alpha_Eq8_PL, encoderPtr, false);
+	genTiledConstVecMRP_RPL(&cleartextTiles, 2 * smrp->alpbetLowBouEq8 / (smrp->alpbetUpBouEq8 - smrp->alpbetLowBouEq8) + 1, &tlNN); makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &beta_Eq8_PL, encoderPtr, false);
+	genTiledConstVecMRP_RPL(&cleartextTiles, 2 / (smrp->alpbetUpBouEq9 - smrp->alpbetLowBouEq9), &tlNN); makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &alpha_Eq9_PL, encoderPtr, false);
+	genTiledConstVecMRP_RPL(&cleartextTiles, 2 * smrp->alpbetLowBouEq9 / (smrp->alpbetUpBouEq9 - smrp->alpbetLowBouEq9) + 1, &tlNN); makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &beta_Eq9_PL, encoderPtr, false);
+	genTiledConstVecMRP_RPL(&cleartextTiles, 1, &tlNN); encryptTiledVectorMatRowPacking(&cleartextTiles, scale, &vecOne_last_CP, encryptorPtr, encoderPtr);
+	// Sparsity detection: the zero tiles are not encoded and the rotate-and-sum of each equation only covers the non-zero part of the row segments
+	struct tiledLayoutMRP tlEq2 = tlNN, tlEq3 = tlMN, tlEq4_5 = tlNN;
+	tlEq2.rotLen   = max(calculateTiledNonZeroSegmentWidth(smd->GAMMA, &tlNN), calculateTiledNonZeroSegmentWidth(smd->LL, &tlNN));
+	tlEq3.rotLen   = max(calculateTiledNonZeroSegmentWidth(smd->KGKG, &tlMN), calculateTiledNonZeroSegmentWidth(smd->KLKL, &tlMN));
+	tlEq4_5.rotLen = max(calculateTiledNonZeroSegmentWidth(smd->ACL, &tlNN), calculateTiledNonZeroSegmentWidth(smd->BB, &tlNM));
+	printf("Tiled MRP Sparsity: Non-zero tiles Gamma %d/%zu, L %d/%zu, KG %d/%zu, KL %d/%zu, ACL %d/%zu, B %d/%zu\n",
+		countNonZeroTiles(&GAMMA_PL), GAMMA_PL.size(), countNonZeroTiles(&LL_PL), LL_PL.size(), countNonZeroTiles(&KGKG_PL), KGKG_PL.size(),
+		countNonZeroTiles(&KLKL_PL), KLKL_PL.size(), countNonZeroTiles(&ACL_PL), ACL_PL.size(), countNonZeroTiles(&BB_PL), BB_PL.size());
+	printf("Tiled MRP Sparsity: Rotation lengths Eq2 %d, Eq3 %d, Eq4-5 %d (N = %d)\n", tlEq2.rotLen, tlEq3.rotLen, tlEq4_5.rotLen, N);
+	// Complex tile packing: the row tiles r and r + 1 are paired as M_r + i * M_r+1, so that a single rotate-and-sum serves both of them
+	// Note: The separation consumes a level, thus, Eq4-5 (whose result goes through the squaring and the Chebyshev approximation of Eq8
+	// 		 before the masked downlink of Eq10) is only paired when the chain has a spare level.
+	bool isPairedEq2 = currentRunConfigPLCP()->useComplexTilePacking && tlNN.numRowTiles >= 2;
+	bool isPairedEq3 = currentRunConfigPLCP()->useComplexTilePacking && tlMN.numRowTiles >= 2;
+	bool isPairedEq4_5 = false;
+	if(isPairedEq2){
+		int sBarChainIndex = (int) contextPtr->first_context_data()->chain_index() - 2 - 1 - 1 - chebyshevDepthPLCP(smd->chebDegEq8); // Eq4-5 and separation, squaring, alpha, Eq8
+		isPairedEq4_5 	   = (sBarChainIndex >= downlinkChainIndexPLCP(true, scale, contextPtr));
+	}
+	vector<Plaintext> GAMMA_Pair_PL, LL_Pair_PL, KGKG_Pair_PL, KLKL_Pair_PL, ACL_Pair_PL, BB_Pair_PL;
+	struct tiledLayoutMRP tlEq2Pair, tlEq3Pair, tlEq4_5Pair, tlNMPair;
+	if(isPairedEq2){
+		genTiledMatMRP_RPL(&cleartextTiles, smd->GAMMA, &tlNN); makeComplexPairTiledPlaintextMRP(&cleartextTiles, &tlEq2, scale, &GAMMA_Pair_PL, &tlEq2Pair, encoderPtr);
+		genTiledMatMRP_RPL(&cleartextTiles, smd->LL, &tlNN);    makeComplexPairTiledPlaintextMRP(&cleartextTiles, &tlEq2, scale, &LL_Pair_PL, &tlEq2Pair, encoderPtr);
+	}
+	if(isPairedEq3){
+		genTiledMatMRP_RPL(&cleartextTiles, smd->KGKG, &tlMN);  makeComplexPairTiledPlaintextMRP(&cleartextTiles, &tlEq3, scale, &KGKG_Pair_PL, &tlEq3Pair, encoderPtr);
+		genTiledMatMRP_RPL(&cleartextTiles, smd->KLKL, &tlMN);  makeComplexPairTiledPlaintextMRP(&cleartextTiles, &tlEq3, scale, &KLKL_Pair_PL, &tlEq3Pair, encoderPtr);
+	}
+	if(isPairedEq4_5){
+		genTiledMatMRP_RPL(&cleartextTiles, smd->ACL, &tlNN);   makeComplexPairTiledPlaintextMRP(&cleartextTiles, &tlEq4_5, scale, &ACL_Pair_PL, &tlEq4_5Pair, encoderPtr);
+		genTiledMatMRP_RPL(&cleartextTiles, smd->BB, &tlNM);    makeComplexPairTiledPlaintextMRP(&cleartextTiles, &tlNM, scale, &BB_Pair_PL, &tlNMPair, encoderPtr);
+	}
+	if(currentRunConfigPLCP()->useComplexTilePacking)
+		printf("Tiled MRP Complex Packing: Paired row tiles Eq2 %s, Eq3 %s, Eq4-5 %s\n", isPairedEq2 ? "yes" : "no (single row tile)",
+			   isPairedEq3 ? "yes" : "no (single row tile)", isPairedEq4_5 ? "yes" : (isPairedEq2 ? "no (no spare level above the masked downlink)" : "no (single row tile)"));
+	// Chebyshev coefficients (scalar plaintexts shared by the row tiles)
+	vector <Plaintext> * chebPwSrCoefVec_Eq8_PL = new vector<Plaintext>(smd->chebDegEq8 + 1);
+	vector <Plaintext> * chebPwSrCoefVec_Eq9_PL = new vector<Plaintext>(smd->chebDegEq9 + 1);
+	preparePwSrCoeffVec(chebPwSrCoefVec_Eq8_PL, smd, smd->chebDegEq8 + 1, N, scale, decryptorPtr, encoderPtr, true);
+	preparePwSrCoeffVec(chebPwSrCoefVec_Eq9_PL, smd, smd->chebDegEq9 + 1, N, scale, decryptorPtr, encoderPtr, false);
+	// MRP views of the row tiles for the element-wise CUSUM and alarm computations
+	struct simulationMatrixMRP *smrpRowTiles = (struct simulationMatrixMRP *) calloc(tlNN.numRowTiles, sizeof(struct simulationMatrixMRP));
+	for(int r = 0; r < tlNN.numRowTiles; r++)
+		create_RowTileMRPView(&smrpRowTiles[r], smrp, &tlNN, r);
+	// The cleartext buffers of the per row tile CUSUM reset are taken from the session
+	struct sessionPLCP * session = (struct sessionPLCP *) calloc(1, sizeof(struct sessionPLCP));
+	create_SessionPLCP(session, smd->n, smd->m, slotCount);
+	activeSessionPLCP = session;
+	// The row tiles of the results are decrypted once into the reused buffers of the extractor and only the slots i * N are gathered (see reportTiledResultPLCP)
+	struct runConfigPLCP *cfg = currentRunConfigPLCP();
+	struct extractorPLCP * extractor = (struct extractorPLCP *) calloc(1, sizeof(struct extractorPLCP));
+	create_ExtractorPLCP(extractor, smd, min(smd->n, tlNN.rowsPerTile), N, cfg->useResultReporting, cfg->useAsyncReporting, 8, decryptorPtr, encoderPtr);
+	activeExtractorPLCP = extractor;
+	if(cfg->useDownlinkModSwitch)
+		setExtractorDownlinkPLCP(extractor, scale, contextPtr, evaluatorPtr);
+	// The records of the iterations are written by a background thread into the results directory (the Eq2-6 stages are recorded together in the Eq2 column)
+	struct resultsWriterPLCP * resultsWriter = NULL;
+	if(useResultsWriter){
+		resultsWriter = (struct resultsWriterPLCP *) calloc(1, sizeof(struct resultsWriterPLCP));
+		create_ResultsWriterPLCP(resultsWriter, resultsDir, resultsFormat, smd->n, smd->m, 64);
+	}
+	// The recurrent state of the tiled format is held in multiple ciphertexts, thus, it is not checkpointed, and the plant is always simulated
+	if(useCheckpointing || resumeFromCheckpoint || cfg->useStreamingIngestion)
+		printf("Tiled MRP Layout: the checkpoints and the streaming ingestion are not supported, the online loop runs the simulated plant from the first iteration\n");
+
+	// End of the initialization	
+	clock_t st_Crypto_Matrix_Vec_Init_End = clock(); // # Ciphertext Initialization-End #
+	double cryp_Mat_Vect_Init_Time 		  = (double) (st_Crypto_Matrix_Vec_Init_End - st_Crypto_Matrix_Vec_Init_Start) / CLOCKS_PER_SEC;
+	encPlMatrVectTotalTime 				 += cryp_Mat_Vect_Init_Time;
+	printf("Crypto Matr-Vect Init Total Time-Indiv. Measur.: %f-%f\n", encPlMatrVectTotalTime, cryp_Mat_Vect_Init_Time);
+
+	/* 
+	** ====================================================================== 
+	** ==================== TILED CRYPTO ONLINE ITERATION LOOP ============== 
+	** ====================================================================== 
+	*/
+	bool isFirstIter = true;
+	for(int k = 0; k < smd->tMax; k++){
+		if(isLoggedPLCP(LOG_LEVEL_SUMMARY)){
+			cout << "=====================" << endl;		
+			cout << "Online Iteration: " << k + 1 << endl;   		
+			cout << "=====================" << endl;		
+		}
+		// Start the latency measurement of the iteration for the parameter sweep
+		chrono::steady_clock::time_point iterStartTime = chrono::steady_clock::now();
+
+		// Receive the encrypted noisy sensor measurement
+		clock_t start_SensMeasurement = clock(); 
+		vector<Ciphertext> yy_CP, yyAS_CP;
+		sense_Encrypt_y_Tiled(smd, &tlNN, k, &yy_CP, &yyAS_CP, scale, encryptorPtr, encoderPtr);
+		clock_t end_SensMeasurement = clock();	 	
+		double sens_Meas_Indv  = (double) (end_SensMeasurement - start_SensMeasurement) / CLOCKS_PER_SEC;
+		SensorMeasurementTime += sens_Meas_Indv;	
+		encryptionYTime  	  += sens_Meas_Indv;
+
+		// Define the row tiles of the estimation, control action, prediction, residues results
+		vector<Ciphertext> secEqRes_CP, thirdEqRes_CP, fourthfifthEqRes_CP, sixthEqRes_CP, sixthEqDiff_CP;
+		clock_t start_Linear_Equations = clock();
+		if(k > 0){
+			isFirstIter = false;
+			// Estimation Phase (Equation-2): x̂e[k] = Γx̂e[k−1] + Ly[k] + xΓ
+			if(isPairedEq2){
+				vector<Ciphertext> pairedRowTiles_CP;
+				tiledMatrixVectorMultMRP(&pairedRowTiles_CP, &tlEq2Pair, &GAMMA_Pair_PL, &xexe_CP, &tlEq2Pair, &LL_Pair_PL, &yy_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, numThreads);
+				separateComplexPairTiledPLCP(&secEqRes_CP, &pairedRowTiles_CP, tlNN.numRowTiles, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr);
+			}else
+				tiledMatrixVectorMultMRP(&secEqRes_CP, &tlEq2, &GAMMA_PL, &xexe_CP, &tlEq2, &LL_PL, &yy_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, numThreads);
+			addSubtractTiledPLCPVectors(&secEqRes_CP, &secEqRes_CP, &xGxG_PL, scale, contextPtr, evaluatorPtr, true);
+			// Control Action Phase (Equation-3): u[k] = KG*x̂e[k−1] + KL*y[k] + KxuΓ
+			if(isPairedEq3){
+				vector<Ciphertext> pairedRowTiles_CP;
+				tiledMatrixVectorMultMRP(&pairedRowTiles_CP, &tlEq3Pair, &KGKG_Pair_PL, &xexe_CP, &tlEq3Pair, &KLKL_Pair_PL, &yy_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, numThreads);
+				separateComplexPairTiledPLCP(&thirdEqRes_CP, &pairedRowTiles_CP, tlMN.numRowTiles, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr);
+			}else
+				tiledMatrixVectorMultMRP(&thirdEqRes_CP, &tlEq3, &KGKG_PL, &xexe_CP, &tlEq3, &KLKL_PL, &yy_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, numThreads);
+			addSubtractTiledPLCPVectors(&thirdEqRes_CP, &thirdEqRes_CP, &KxuGKxuG_PL, scale, contextPtr, evaluatorPtr, true);
+			// Prediction Phase (Equation-4-5): x̂p[k] = Acl*x̂e[k − 1] + B*uΓ
+			if(isPairedEq4_5){
+				vector<Ciphertext> pairedRowTiles_CP;
+				tiledMatrixVectorMultMRP(&pairedRowTiles_CP, &tlEq4_5Pair, &ACL_Pair_PL, &xexe_CP, &tlNMPair, &BB_Pair_PL, &uGuG_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, numThreads);
+				separateComplexPairTiledPLCP(&fourthfifthEqRes_CP, &pairedRowTiles_CP, tlNN.numRowTiles, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr);
+			}else
+				tiledMatrixVectorMultMRP(&fourthfifthEqRes_CP, &tlEq4_5, &ACL_PL, &xexe_CP, &tlNM, &BB_PL, &uGuG_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr, numThreads);
+			// Residues Phase (Equation-6): (y[k] - x̂p[k])^2
+			addSubtractTiledVectors(&sixthEqDiff_CP, &yyAS_CP, &fourthfifthEqRes_CP, scale, contextPtr, evaluatorPtr, false);
+		}else{
+			isFirstIter = true;
+			// Control Action Phase (Equation-3) at the very first iteration: u[0] = uΓ + Kx
+			addSubtractTiledPLCPVectors(&thirdEqRes_CP, &uGuG_AS_CP, &KxKx_PL, scale, contextPtr, evaluatorPtr, true);
+			// Residues Phase (Equation-6) at the very first iteration: (y[0] - x̂p[0])^2
+			addSubtractTiledPLCPVectors(&sixthEqDiff_CP, &yyAS_CP, &xpxp_PL, scale, contextPtr, evaluatorPtr, false);
+		}
+		sixthEqRes_CP.resize(sixthEqDiff_CP.size());
+		for(size_t r = 0; r < sixthEqDiff_CP.size(); r++)
+			vectorSquaringRowPacking(&sixthEqRes_CP[r], &sixthEqDiff_CP[r], scale, contextPtr, evaluatorPtr, relin_keysPtr);
+		clock_t end_Linear_Equations = clock();
+		double Eq2_6_Meas_Indv = (double) (end_Linear_Equations - start_Linear_Equations) / CLOCKS_PER_SEC;
+		Eq2Time += Eq2_6_Meas_Indv;
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("Tiled Estimation-Control-Prediction-Residues Eq2-6 Measur. Time-Indiv. Measur.: %f-%f\n", Eq2Time, Eq2_6_Meas_Indv);
+
+		// Initial-CUSUM-Alarm Phase (Equation-8-9) and CUSUM-Parametric Sum Phase (Equation-10) per row tile
+		vector<Ciphertext> eigthEqRes_CP(tlNN.numRowTiles), ninthEqRes_CP(tlNN.numRowTiles);
+		clock_t start_8_9_th_Equation = clock();				
+		for(int r = 0; r < tlNN.numRowTiles; r++){
+			Plaintext PL_vecOne; 
+			makePlaintextMatRowPacking(smrpRowTiles[r].One_MRP, scale, &PL_vecOne, encoderPtr);
+			applyEquation_CUSUM_PLCP(&eigthEqRes_CP[r], &ninthEqRes_CP[r], &smrpRowTiles[r], smd, k, &ss_PL[r], &vv_PL[r], 
+									 &TAU_PL[r], &alpha_Eq8_PL[r], &beta_Eq8_PL[r], &alpha_Eq9_PL[r], &beta_Eq9_PL[r],
+									 &PL_vecOne, 
+									 &firstChebPowSerTerm_max_PL[r], chebPwSrCoefVec_Eq8_PL,
+									 &firstChebPowSerTerm_ISub_PL[r], chebPwSrCoefVec_Eq9_PL,
+									 &sixthEqRes_CP[r], &ss_CP[r], scale, 
+									 contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr, isFirstIter);
+		}
+		clock_t end_8_9_th_Equation = clock();		
+		double CUSUM_Meas_Indv = (double) (end_8_9_th_Equation - start_8_9_th_Equation) / CLOCKS_PER_SEC;
+		CUSUMTime += CUSUM_Meas_Indv;
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("CUSUM Time-Indiv. Measur.: %f-%f\n", CUSUMTime, CUSUM_Meas_Indv);
+		clock_t start_10_th_Equation = clock();	
+		for(int r = 0; r < tlNN.numRowTiles; r++)
+			applyEquation_10_PLCP(&ss_CP[r], &smrpRowTiles[r], &eigthEqRes_CP[r], &ninthEqRes_CP[r], &vecOne_last_CP[r], scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
+		clock_t end_10_th_Equation = clock();
+		double Eq10_Meas_Indv = (double) (end_10_th_Equation - start_10_th_Equation) / CLOCKS_PER_SEC;
+		Eq10Time += Eq10_Meas_Indv;
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("Alarm Computation Eq10 Measur. Time-Indiv. Measur.: %f-%f\n", Eq10Time, Eq10_Meas_Indv);	
+
+		// Secret-share Phase (for next iteration): the estimation row tiles are re-arranged into the replicated column tiles
+		clock_t start_Last_Secret_Share = clock(); 				
+		if(k > 0)
+			secretShareTiledEstimation(&xexe_CP, &secEqRes_CP, &tlNN, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr);
+		clock_t end_Last_Secret_Share = clock();	
+		double LastSecretShare_Meas_Indv = (double) (end_Last_Secret_Share - start_Last_Secret_Share) / CLOCKS_PER_SEC;
+		EqLastSecretShareTime 			+= LastSecretShare_Meas_Indv;
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("Last Secret Share of x^e Measur. Time-Indiv. Measur.: %f-%f\n", EqLastSecretShareTime, LastSecretShare_Meas_Indv);	
+
+		// Apply process noise phase 	
+		clock_t start_Process_Noise_Addition = clock();
+		applyXVecNoiseAdditionTiled(&thirdEqRes_CP, &tlMN, k, smd, scale, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr);
+		clock_t end_Process_Noise_Addition = clock();
+		double Process_Noise_Addition_Meas_Indv = (double) (end_Process_Noise_Addition - start_Process_Noise_Addition) / CLOCKS_PER_SEC;
+		SensorMeasurementTime += Process_Noise_Addition_Meas_Indv;
+		decryptionUTime 	  += Process_Noise_Addition_Meas_Indv;
+
+		// Print the time measurements
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE)){
+			cout << "Iteration" << k << " Individual Times " << endl;
+			cout << sens_Meas_Indv << "," << Eq2_6_Meas_Indv << "," << CUSUM_Meas_Indv << "," << Eq10_Meas_Indv << "," << LastSecretShare_Meas_Indv << "," << Process_Noise_Addition_Meas_Indv << endl;
+		}
+
+		// ## Four targets: y, u, alarm, s (and the residue for the results writer)
+		reportTiledResultPLCP(extractor, &yyAS_CP, tlNN.rowsPerTile, smd->n, RESULT_TARGET_Y, k); // Sensor Measurement
+		reportTiledResultPLCP(extractor, &thirdEqRes_CP, tlMN.rowsPerTile, smd->m, RESULT_TARGET_U, k); // Control
+		reportTiledResultPLCP(extractor, &ninthEqRes_CP, tlNN.rowsPerTile, smd->n, RESULT_TARGET_ALARM, k); // Alarm Appx. Func. (Indicator funct)
+		reportTiledResultPLCP(extractor, &ss_CP, tlNN.rowsPerTile, smd->n, RESULT_TARGET_S, k + 1); // CUSUM parametric SUM
+		// Push the record of the iteration to the results writer (the queued reports are finished first, since the record is taken from the result vectors)
+		if(useResultsWriter){
+			reportTiledResultPLCP(extractor, &sixthEqRes_CP, tlNN.rowsPerTile, smd->n, RESULT_TARGET_RESIDUE, k); // Residue
+			drainExtractorPLCP(extractor);
+			double iterTimings[numResultTimings] = {sens_Meas_Indv, Eq2_6_Meas_Indv, 0, 0, 0, CUSUM_Meas_Indv, Eq10_Meas_Indv, LastSecretShare_Meas_Indv, Process_Noise_Addition_Meas_Indv};
+			pushResultsRecordPLCP(resultsWriter, k, smd->y_Res[k], smd->u_Res[k], smd->alarm_Res[k], smd->s_Res[k + 1], smd->residue_Res[k], iterTimings);
+		}
+		// Record the iteration latency of the parameter sweep point
+		if(activeSweepPointPLCP != NULL)
+			recordSweepIterationPLCP(activeSweepPointPLCP, chrono::duration<double>(chrono::steady_clock::now() - iterStartTime).count());
+	}
+
+	// Write the pushed records and free the results writer
+	if(useResultsWriter){
+		closeResultsWriterPLCP(resultsWriter);
+		printResultsWriterPLCP(resultsWriter);
+		free_ResultsWriterPLCP(resultsWriter);
+		free(resultsWriter);
+	}
+	// Finish the queued reports and free the extractor
+	activeExtractorPLCP = NULL;
+	free_ExtractorPLCP(extractor);
+	printExtractorPLCP(extractor);
+	free(extractor);
+	// Compare the extracted results with the cleartext reference of the parameter sweep point
+	if(activeSweepPointPLCP != NULL)
+		evaluateSweepPointPLCP(activeSweepPointPLCP, smd);
+
+	// Free the session, the row tile views and the Chebyshev coefficient vectors
+	activeSessionPLCP = NULL;
+	free_SessionPLCP(session);
+	free(session);
+	for(int r = 0; r < tlNN.numRowTiles; r++)
+		free_SimulationMatrixDataMRP(&smrpRowTiles[r]);
+	free(smrpRowTiles);
+	delete chebPwSrCoefVec_Eq8_PL;
+	delete chebPwSrCoefVec_Eq9_PL;
+}
+
+/*
+	The function for performing the cyberphysical system's functionalities (one after another) in the diagonal (Halevi-Shoup) packing format
+	Note: The matrix-vector multiplications are computed with the BSGS method on the replicated vectors, thus, the estimation comes back in the layout
+		  of the next input and it is only refreshed (i.e., secretSharev2) without any re-arrangement. The element-wise CUSUM and the alarm computations
+		  are applied through the compact MRP view (N = 1) of the replicated results.
+*/
+void performDiagonalMatrixVectorMultiplicationsPlain(SEALContext *contextPtr, SecretKey *secret_keyPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, 
+	Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, struct simulationMatrixData *smd, struct simulationMatrixMRP *smrp, double scale){
+
+	/* 
+	** =============================================================== 
+	** ==================== DIAGONAL SYSTEM INITIALIZATION =========== 
+	** =============================================================== 
+	*/
+	clock_t st_Crypto_Matrix_Vec_Init_Start = clock(); // # Ciphertext Initialization-Start #	
+	// Create the diagonal layout and the Galois keys of the BSGS rotation steps
+	struct diagonalLayoutDGP dl;
+	calculateDiagonalLayoutDGP(&dl, smd->n, smd->m, encoderPtr->slot_count());
+	GaloisKeys diag_gal_keys;
+	createDiagonalGaloisKeysDGP(&diag_gal_keys, &dl, contextPtr, secret_keyPtr);
+	printf("Diagonal Layout: n = %d, m = %d, D = %d, Baby Steps = %d, Giant Steps = %d\n", dl.n, dl.m, dl.D, dl.babyStep, dl.giantStep);
+
+	// Equation-2-3-4-5 matrix diagonals
+	vector<vector<double>> cleartextDiags;
+	vector<Plaintext> GAMMA_PL, LL_PL, KGKG_PL, KLKL_PL, ACL_PL, BB_PL;
+	genDiagonalsDGP_RPL(&cleartextDiags, smd->GAMMA, smd->n, smd->n, &dl); makeDiagonalPlaintextsDGP(&cleartextDiags, scale, &GAMMA_PL, encoderPtr);
+	genDiagonalsDGP_RPL(&cleartextDiags, smd->LL, smd->n, smd->n, &dl);    makeDiagonalPlaintextsDGP(&cleartextDiags, scale, &LL_PL, encoderPtr);
+	genDiagonalsDGP_RPL(&cleartextDiags, smd->KGKG, smd->m, smd->n, &dl);  makeDiagonalPlaintextsDGP(&cleartextDiags, scale, &KGKG_PL, encoderPtr);
+	genDiagonalsDGP_RPL(&cleartextDiags, smd->KLKL, smd->m, smd->n, &dl);  makeDiagonalPlaintextsDGP(&cleartextDiags, scale, &KLKL_PL, encoderPtr);
+	genDiagonalsDGP_RPL(&cleartextDiags, smd->ACL, smd->n, smd->n, &dl);   makeDiagonalPlaintextsDGP(&cleartextDiags, scale, &ACL_PL, encoderPtr);
+	genDiagonalsDGP_RPL(&cleartextDiags, smd->BB, smd->n, smd->m, &dl);    makeDiagonalPlaintextsDGP(&cleartextDiags, scale, &BB_PL, encoderPtr);
+	cleartextDiags.clear();
+	printf("Diagonal Sparsity: Non-zero diagonals Gamma %d, L %d, KG %d, KL %d, ACL %d, B %d (D = %d)\n", countNonZeroDiagonalsDGP(&GAMMA_PL), countNonZeroDiagonalsDGP(&LL_PL),
+		countNonZeroDiagonalsDGP(&KGKG_PL), countNonZeroDiagonalsDGP(&KLKL_PL), countNonZeroDiagonalsDGP(&ACL_PL), countNonZeroDiagonalsDGP(&BB_PL), dl.D);
+	// Equation-2-3-4-5 replicated ciphertexts
+	vector<double> repVec;
+	Ciphertext xexe_CP, xGxG_CP, KxuGKxuG_CP, uGuG_CP;
+	genRepVecDGP_RPL(&repVec, smd->xexe, smd->n, &dl);     encryptXVectorMatRowPacking(&repVec, scale, &xexe_CP, encryptorPtr, encoderPtr);
+	genRepVecDGP_RPL(&repVec, smd->xGxG, smd->n, &dl);     encryptXVectorMatRowPacking(&repVec, scale, &xGxG_CP, encryptorPtr, encoderPtr);
+	genRepVecDGP_RPL(&repVec, smd->KxuGKxuG, smd->m, &dl); encryptXVectorMatRowPacking(&repVec, scale, &KxuGKxuG_CP, encryptorPtr, encoderPtr);
+	genRepVecDGP_RPL(&repVec, smd->uGuG, smd->m, &dl);     encryptXVectorMatRowPacking(&repVec, scale, &uGuG_CP, encryptorPtr, encoderPtr);
+	// Equation-3 (the very first iteration) vectors
+	Plaintext KxKx_PL;
+	Ciphertext uGuG_AS_CP;
+	genRepVecDGP_RPL(&repVec, smd->KxKx, smd->m, &dl); makePlaintextMatRowPacking(&repVec, scale, &KxKx_PL, encoderPtr);
+	genRepVecDGP_RPL(&repVec, smd->uGuG, smd->m, &dl); encryptXVectorMatRowPacking(&repVec, scale, &uGuG_AS_CP, encryptorPtr, encoderPtr);
+
+	// Equation-6-8-9-10 vectors in the compact MRP view
+	struct simulationMatrixMRP *smrpView = (struct simulationMatrixMRP *) calloc(1, sizeof(struct simulationMatrixMRP));
+	create_DiagonalMRPView(smrpView, smrp, smd);
+	Plaintext xpxp_PL, ss_PL, vv_PL, TAU_PL, alpha_Eq8_PL, beta_Eq8_PL, alpha_Eq9_PL, beta_Eq9_PL, firstChebPowSerTerm_max_PL, firstChebPowSerTerm_ISub_PL, vecOne_PL;
+	Ciphertext ss_CP, vecOne_last_CP;
+	makePlaintextMatRowPacking(smrpView->xpxp_MRP, scale, &xpxp_PL, encoderPtr);
+	makePlaintextMatRowPacking(smrpView->ss_MRP, scale, &ss_PL, encoderPtr);
+	makePlaintextMatRowPacking(smrpView->vv_MRP, scale, &vv_PL, encoderPtr);
+	makePlaintextMatRowPacking(smrpView->TAU_MRP, scale, &TAU_PL, encoderPtr);
+	makePlaintextMatRowPacking(smrpView->alpEq8_MRP, scale, &alpha_Eq8_PL, encoderPtr);
+	makePlaintextMatRowPacking(smrpView->betEq8_MRP, scale, &beta_Eq8_PL, encoderPtr);
+	makePlaintextMatRowPacking(smrpView->alpEq9_MRP, scale, &alpha_Eq9_PL, encoderPtr);
+	makePlaintextMatRowPacking(smrpView->betEq9_MRP, scale, &beta_Eq9_PL, encoderPtr);
+	makePlaintextMatRowPacking(smrpView->chebPowSerFT_Eq8_MRP, scale, &firstChebPowSerTerm_max_PL, encoderPtr);
+	makePlaintextMatRowPacking(smrpView->chebPowSerFT_Eq9_MRP, scale, &firstChebPowSerTerm_ISub_PL, encoderPtr);
+	encryptXVectorMatRowPacking(smrpView->ss_MRP, scale, &ss_CP, encryptorPtr, encoderPtr);
+	encryptXVectorMatRowPacking(smrpView->One_MRP, scale, &vecOne_last_CP, encryptorPtr, encoderPtr);
+	vector <Plaintext> * chebPwSrCoefVec_Eq8_PL = new vector<Plaintext>(smd->chebDegEq8 + 1);
+	vector <Plaintext> * chebPwSrCoefVec_Eq9_PL = new vector<Plaintext>(smd->chebDegEq9 + 1);
+	preparePwSrCoeffVec(chebPwSrCoefVec_Eq8_PL, smd, smd->chebDegEq8 + 1, smrpView->N, scale, decryptorPtr, encoderPtr, true);
+	preparePwSrCoeffVec(chebPwSrCoefVec_Eq9_PL, smd, smd->chebDegEq9 + 1, smrpView->N, scale, decryptorPtr, encoderPtr, false);
+	// The cleartext buffers of the sensor measurement (the replicated y fills the slots), the process noise addition and the CUSUM reset (in the compact MRP view) are taken from the session
+	struct sessionPLCP * session = (struct sessionPLCP *) calloc(1, sizeof(struct sessionPLCP));
+	create_SessionPLCP(session, smrpView->n, smrpView->m, dl.slotCount);
+	activeSessionPLCP = session;
+	// uΓ is encrypted once and never updated, thus, its baby-step rotations are hoisted once for all the iterations
+	vector<Ciphertext> uGBabyRots_CP;
+	hoistBabyStepRotationsDGP(&uGBabyRots_CP, &uGuG_CP, &dl, evaluatorPtr, &diag_gal_keys);
+
+	// End of the initialization	
+	clock_t st_Crypto_Matrix_Vec_Init_End = clock(); // # Ciphertext Initialization-End #
+	double cryp_Mat_Vect_Init_Time 		  = (double) (st_Crypto_Matrix_Vec_Init_End - st_Crypto_Matrix_Vec_Init_Start) / CLOCKS_PER_SEC;
+	encPlMatrVectTotalTime 				 += cryp_Mat_Vect_Init_Time;
+	printf("Crypto Matr-Vect Init Total Time-Indiv. Measur.: %f-%f\n", encPlMatrVectTotalTime, cryp_Mat_Vect_Init_Time);
+
+	/* 
+	** ====================================================================== 
+	** ==================== DIAGONAL CRYPTO ONLINE ITERATION LOOP =========== 
+	** ====================================================================== 
+	*/
+	bool isFirstIter = true;
+	for(int k = 0; k < smd->tMax; k++){
+		if(isLoggedPLCP(LOG_LEVEL_SUMMARY)){
+			cout << "=====================" << endl;		
+			cout << "Online Iteration: " << k + 1 << endl;   		
+			cout << "=====================" << endl;		
+		}
+
+		// Receive the encrypted noisy sensor measurement
+		clock_t start_SensMeasurement = clock(); 
+		Ciphertext yy_CP;
+		sense_Encrypt_y_Diagonal(smd, &dl, k, &yy_CP, scale, encryptorPtr, encoderPtr);
+		clock_t end_SensMeasurement = clock();	 	
+		double sens_Meas_Indv  = (double) (end_SensMeasurement - start_SensMeasurement) / CLOCKS_PER_SEC;
+		SensorMeasurementTime += sens_Meas_Indv;	
+		encryptionYTime  	  += sens_Meas_Indv;
+
+		// Define the results of the estimation, control action, prediction, residues
+		Ciphertext secEqRes_CP, thirdEqRes_CP, fourthfifthEqRes_CP, sixthEqRes_CP, sixthEqDiff_CP;
+		clock_t start_Linear_Equations = clock();
+		if(k > 0){
+			isFirstIter = false;
+			// Hoist the baby-step rotations of x̂e[k−1] (shared by Gamma, KG, ACL) and y[k] (shared by L, KL), the rotations of uΓ are hoisted once
+			vector<Ciphertext> xeBabyRots_CP, yBabyRots_CP;
+			hoistBabyStepRotationsDGP(&xeBabyRots_CP, &xexe_CP, &dl, evaluatorPtr, &diag_gal_keys);
+			hoistBabyStepRotationsDGP(&yBabyRots_CP, &yy_CP, &dl, evaluatorPtr, &diag_gal_keys);
+			// Estimation Phase (Equation-2): x̂e[k] = Γx̂e[k−1] + Ly[k] + xΓ
+			diagonalMatrixVectorMultDGP(&secEqRes_CP, &dl, &GAMMA_PL, &xeBabyRots_CP, &LL_PL, &yBabyRots_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, encoderPtr, &diag_gal_keys);
+			addSubtractTwoVector(&secEqRes_CP, &secEqRes_CP, &xGxG_CP, scale, contextPtr, evaluatorPtr, true);
+			// Control Action Phase (Equation-3): u[k] = KG*x̂e[k−1] + KL*y[k] + KxuΓ
+			diagonalMatrixVectorMultDGP(&thirdEqRes_CP, &dl, &KGKG_PL, &xeBabyRots_CP, &KLKL_PL, &yBabyRots_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, encoderPtr, &diag_gal_keys);
+			addSubtractTwoVector(&thirdEqRes_CP, &thirdEqRes_CP, &KxuGKxuG_CP, scale, contextPtr, evaluatorPtr, true);
+			// Prediction Phase (Equation-4-5): x̂p[k] = Acl*x̂e[k − 1] + B*uΓ
+			diagonalMatrixVectorMultDGP(&fourthfifthEqRes_CP, &dl, &ACL_PL, &xeBabyRots_CP, &BB_PL, &uGBabyRots_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, encoderPtr, &diag_gal_keys);
+			// Residues Phase (Equation-6): (y[k] - x̂p[k])^2
+			addSubtractTwoVector(&sixthEqDiff_CP, &yy_CP, &fourthfifthEqRes_CP, scale, contextPtr, evaluatorPtr, false);
+		}else{
+			isFirstIter = true;
+			// Control Action Phase (Equation-3) at the very first iteration: u[0] = uΓ + Kx
+			addSubtractPLCPVector(&thirdEqRes_CP, &uGuG_AS_CP, &KxKx_PL, scale, contextPtr, evaluatorPtr, true);
+			// Residues Phase (Equation-6) at the very first iteration: (y[0] - x̂p[0])^2
+			addSubtractPLCPVector(&sixthEqDiff_CP, &yy_CP, &xpxp_PL, scale, contextPtr, evaluatorPtr, false);
+		}
+		vectorSquaringRowPacking(&sixthEqRes_CP, &sixthEqDiff_CP, scale, contextPtr, evaluatorPtr, relin_keysPtr);
+		clock_t end_Linear_Equations = clock();
+		double Eq2_6_Meas_Indv = (double) (end_Linear_Equations - start_Linear_Equations) / CLOCKS_PER_SEC;
+		Eq2Time += Eq2_6_Meas_Indv;
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("Diagonal Estimation-Control-Prediction-Residues Eq2-6 Measur. Time-Indiv. Measur.: %f-%f\n", Eq2Time, Eq2_6_Meas_Indv);
+
+		// Initial-CUSUM-Alarm Phase (Equation-8-9) and CUSUM-Parametric Sum Phase (Equation-10) through the compact MRP view
+		Ciphertext eigthEqRes_CP, ninthEqRes_CP;
+		clock_t start_8_9_th_Equation = clock();				
+		makePlaintextMatRowPacking(smrpView->One_MRP, scale, &vecOne_PL, encoderPtr);
+		applyEquation_CUSUM_PLCP(&eigthEqRes_CP, &ninthEqRes_CP, smrpView, smd, k, &ss_PL, &vv_PL, 
+								 &TAU_PL, &alpha_Eq8_PL, &beta_Eq8_PL, &alpha_Eq9_PL, &beta_Eq9_PL,
+								 &vecOne_PL, 
+								 &firstChebPowSerTerm_max_PL, chebPwSrCoefVec_Eq8_PL,
+								 &firstChebPowSerTerm_ISub_PL, chebPwSrCoefVec_Eq9_PL,
+								 &sixthEqRes_CP, &ss_CP, scale, 
+								 contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr, isFirstIter);
+		clock_t end_8_9_th_Equation = clock();		
+		double CUSUM_Meas_Indv = (double) (end_8_9_th_Equation - start_8_9_th_Equation) / CLOCKS_PER_SEC;
+		CUSUMTime += CUSUM_Meas_Indv;
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("CUSUM Time-Indiv. Measur.: %f-%f\n", CUSUMTime, CUSUM_Meas_Indv);
+		clock_t start_10_th_Equation = clock();	
+		applyEquation_10_PLCP(&ss_CP, smrpView, &eigthEqRes_CP, &ninthEqRes_CP, &vecOne_last_CP, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, relin_keysPtr, gal_keysPtr);
+		clock_t end_10_th_Equation = clock();
+		double Eq10_Meas_Indv = (double) (end_10_th_Equation - start_10_th_Equation) / CLOCKS_PER_SEC;
+		Eq10Time += Eq10_Meas_Indv;
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("Alarm Computation Eq10 Measur. Time-Indiv. Measur.: %f-%f\n", Eq10Time, Eq10_Meas_Indv);	
+
+		// Refresh Phase (for next iteration): the replicated estimation is already in the input layout, thus, it is only refreshed to restore the levels
+		clock_t start_Last_Secret_Share = clock(); 				
+		if(k > 0){
+			secretSharev2(&secEqRes_CP, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr, scale, (int) (dl.slotCount / dl.D), dl.n, dl.D);
+			xexe_CP = secEqRes_CP;
+		}
+		clock_t end_Last_Secret_Share = clock();	
+		double LastSecretShare_Meas_Indv = (double) (end_Last_Secret_Share - start_Last_Secret_Share) / CLOCKS_PER_SEC;
+		EqLastSecretShareTime 			+= LastSecretShare_Meas_Indv;
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			printf("Last Refresh of x^e Measur. Time-Indiv. Measur.: %f-%f\n", EqLastSecretShareTime, LastSecretShare_Meas_Indv);	
+
+		// Apply process noise phase 	
+		clock_t start_Process_Noise_Addition = clock();
+		applyXVecNoiseAddition(&thirdEqRes_CP, k, smrpView, smd, scale, contextPtr, encryptorPtr, evaluatorPtr, decryptorPtr, encoderPtr);
+		clock_t end_Process_Noise_Addition = clock();
+		double Process_Noise_Addition_Meas_Indv = (double) (end_Process_Noise_Addition - start_Process_Noise_Addition) / CLOCKS_PER_SEC;
+		SensorMeasurementTime += Process_Noise_Addition_Meas_Indv;
+		decryptionUTime 	  += Process_Noise_Addition_Meas_Indv;
+
+		// Print the time measurements
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE)){
+			cout << "Iteration" << k << " Individual Times " << endl;
+			cout << sens_Meas_Indv << "," << Eq2_6_Meas_Indv << "," << CUSUM_Meas_Indv << "," << Eq10_Meas_Indv << "," << LastSecretShare_Meas_Indv << "," << Process_Noise_Addition_Meas_Indv << endl;
+		}
+
+		// ## Four targets: y, u, alarm, s 	
+		extractExpRes(&yy_CP, smrpView, smd, k, smd->n, scale, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, "y"); // Sensor Measurement
+		extractExpRes(&thirdEqRes_CP, smrpView, smd, k, smd->m, scale, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, "u"); // Control
+		extractExpRes(&ninthEqRes_CP, smrpView, smd, k, smd->n, scale, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, "alarm"); // Alarm Appx. Func. (Indicator funct)
+		extractExpRes(&ss_CP, smrpView, smd, k + 1, smd->n, scale, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, "s"); // CUSUM parametric SUM
 	}
+
+	// Free the session, the compact MRP view and the Chebyshev coefficient vectors
+	activeSessionPLCP = NULL;
+	free_SessionPLCP(session);
+	free(session);
+	free_SimulationMatrixDataMRP(smrpView);
+	free(smrpView);
+	delete chebPwSrCoefVec_Eq8_PL;
+	delete chebPwSrCoefVec_Eq9_PL;
 }
 
 /*
@@ -473,9 +1432,19 @@ void ckks_encoder_modify_matrix_row_packing_functional()
 	EncryptionParameters *parmsPtr;
 	EncryptionParameters parms(scheme_type::ckks);
 	parmsPtr = &parms;
-	size_t poly_modulus_degree = 32768; // Determine the polynomial modulus degree		
+	// Take the parameters and the settings of the online loop from the run configuration
+	struct runConfigPLCP *cfg = currentRunConfigPLCP();
+	activeLogLevelPLCP 	 = (enum logLevelPLCP) cfg->logLevel;
+	useResultsWriter 	 = cfg->useResultsWriter;
+	resultsDir 			 = cfg->resultsDir;
+	resultsFormat 		 = (enum resultsFormatPLCP) cfg->resultsFormat;
+	useCheckpointing 	 = cfg->useCheckpointing;
+	resumeFromCheckpoint = cfg->resumeFromCheckpoint;
+	checkpointDir 		 = cfg->checkpointDir;
+	checkpointInterval 	 = cfg->checkpointInterval;
+	size_t poly_modulus_degree = cfg->polyModulusDegree; // Determine the polynomial modulus degree (default: 32768)		
 	cout << "Maximum number of bits: "  << CoeffModulus::MaxBitCount(poly_modulus_degree) << "\n"; // Print maximum bit count for the given poly_modulus degree
-	size_t bitsizesparam = 50; // Determine bitsize parameter w.r.t. the polynomial modulus degree     
+	size_t bitsizesparam = cfg->bitSizeParam; // Determine bitsize parameter w.r.t. the polynomial modulus degree (default: 50)     
 	parms.set_poly_modulus_degree(poly_modulus_degree);	
 	// parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, {60, bitsizesparam, 60})); // # 1
 	// parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, {60, bitsizesparam, bitsizesparam, 60})); // # 2
@@ -484,37 +1453,56 @@ void ckks_encoder_modify_matrix_row_packing_functional()
 	// parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, {60, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, 60})); // # 5 
 	// parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, {60, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, 60})); // # 6 
 	// parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, {60, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, 60})); // # 8
-	parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, {60, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, 60})); // # 9
+	// parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, {60, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, 60})); // # 9
+	// The coefficient modulus is {specialBitSize, numMiddlePrimes x bitsizesparam, specialBitSize} (default: # 9 above)
+	vector<int> coeffModulusBitSizes(cfg->numMiddlePrimes + 2, (int) bitsizesparam);
+	coeffModulusBitSizes.front() = cfg->specialBitSize;
+	coeffModulusBitSizes.back()  = cfg->specialBitSize;
+	parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, coeffModulusBitSizes)); 
 	
 	// Create the SEAL Context and print the context parameters.	
 	SEALContext *contextPtr;	
 	SEALContext context(parms);
 	contextPtr = &context; 
+	if(!context.parameters_set()){
+		printf("Invalid Encryption Parameters: %d-bit coefficient modulus for the polynomial modulus degree %zu (at most %d bits)\n",
+			cfg->specialBitSize * 2 + cfg->numMiddlePrimes * (int) bitsizesparam, poly_modulus_degree, CoeffModulus::MaxBitCount(poly_modulus_degree));
+		return;
+	}
 
 	print_parameters(context);
 	cout << endl;
 	print_line(__LINE__);
 	
-	// 	Create SEAL library homomorphic encryption keys
-	KeyGenerator keygen(context);
-	auto secret_key = keygen.secret_key();
+	// 	Create SEAL library homomorphic encryption keys (or load the stored keys of the checkpoint to resume)
+	SecretKey secret_key;
 	auto *secret_keyPtr = &secret_key; 
 	
 	PublicKey public_key;
-	keygen.create_public_key(public_key);
 	PublicKey *public_keyPtr;
 	public_keyPtr = &public_key;
 
 	RelinKeys relin_keys;
-	keygen.create_relin_keys(relin_keys);
 	RelinKeys *relin_keysPtr;
 	relin_keysPtr = &relin_keys;
 
 	GaloisKeys gal_keys;
-    keygen.create_galois_keys(gal_keys);
 	GaloisKeys *gal_keysPtr;
     gal_keysPtr = &gal_keys; 
 
+	if(!resumeFromCheckpoint || !loadKeysCheckpointPLCP(checkpointDir, cfg->keyStoreDir, parmsPtr, contextPtr, secret_keyPtr, public_keyPtr, relin_keysPtr, gal_keysPtr)){
+		// The state of a checkpoint cannot be decrypted with the new keys
+		resumeFromCheckpoint = false;
+		KeyGenerator keygen(context);
+		secret_key = keygen.secret_key();
+		keygen.create_public_key(public_key);
+		keygen.create_relin_keys(relin_keys);
+		keygen.create_galois_keys(gal_keys);
+		// The secret key only goes into the opt-in key store, never next to the encrypted state
+		if(useCheckpointing && saveKeysCheckpointPLCP(checkpointDir, parmsPtr, public_keyPtr, relin_keysPtr, gal_keysPtr) && cfg->keyStoreDir[0] != '\0')
+			saveSecretKeyStorePLCP(cfg->keyStoreDir, checkpointDir, secret_keyPtr);
+	}
+
 	// Set up an Encryptor, Evaluator, and Decryptor
 	Encryptor *encryptorPtr;
 	Encryptor encryptor(context, public_key);
@@ -20,6 +20,17 @@
 #include "encryptedAppx.h"        // The class containing the functions which does the Chebyshev approximation with different assumptions     
 #include "secretShare.h" 		  // The class containing the functions which does the secret sharing  
 #include "applyPLCPSimulation.h"  // The class containing the crypto application functions for each targeted equation
+#include "tiledMRP.h"             // The class containing the multi-ciphertext tiled MRP layout
+#include "diagonalPacking.h"      // The class containing the diagonal (Halevi-Shoup) packing format
+#include "arenaPLCP.h"            // The class containing the reusable Ciphertext and Plaintext buffers of the online loop
+#include "sessionPLCP.h"          // The class containing the reusable cleartext buffers of the online loop
+#include "streamingPLCP.h"        // The class containing the streaming ingestion of the sensor measurements
+#include "checkpointPLCP.h"       // The class containing the encrypted state checkpoints of the online loop
+#include "constantsPLCP.h"        // The class containing the registry of the encoded constants of the online loop
+#include "extractionPLCP.h"       // The class containing the lean result extraction of the online loop
+#include "resultsWriterPLCP.h"    // The class containing the asynchronous structured results writer of the online loop
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
+#include "sweepPLCP.h"            // The class containing the parameter sweep of the crypto application
 
 /* Import the important selected C libraries */
 #include <iostream>
@@ -47,6 +58,14 @@ SEALContext *contextPtr, auto *secret_keyPtr, PublicKey *public_keyPtr, RelinKey
 GaloisKeys *gal_keysPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, 
 FILE *fp,  double scale,  size_t numberOfIterations);
 
+/* The function for performing the cyberphysical system's functionalities (one after another) in the tiled (multi-ciphertext) MRP format */
+void performTiledMatrixVectorMultiplicationsPlain(SEALContext *contextPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, 
+	Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, struct simulationMatrixData *smd, struct simulationMatrixMRP *smrp, double scale, size_t maxColTileWidth);
+
+/* The function for performing the cyberphysical system's functionalities (one after another) in the diagonal (Halevi-Shoup) packing format */
+void performDiagonalMatrixVectorMultiplicationsPlain(SEALContext *contextPtr, SecretKey *secret_keyPtr, RelinKeys *relin_keysPtr, GaloisKeys *gal_keysPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, 
+	Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, struct simulationMatrixData *smd, struct simulationMatrixMRP *smrp, double scale);
+
 /* The function for setting the configurations of the SEAL crypto application and calling the main system function */
 void ckks_encoder_modify_matrix_row_packing_functional();
 
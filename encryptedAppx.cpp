@@ -17,6 +17,8 @@
 #include "plcpOperations.h"       // The class containing the functions which does Ciphertext-Ciphertext and Plaintext-Ciphertext arithmetic and algebraic operations  	    
 #include "encryptedAppx.h"        // The class containing the functions which does the Chebyshev approximation with different assumptions     
 #include "secretShare.h" 		  // The class containing the functions which does the secret sharing  
+#include "arenaPLCP.h"            // The class containing the reusable Ciphertext and Plaintext buffers of the online loop
+#include "constantsPLCP.h"        // The class containing the registry of the encoded constants of the online loop
 
 /* Import the important selected C libraries*/
 #include <array>
@@ -37,6 +39,217 @@
 using namespace std;
 using namespace seal;
 
+/*
+	The function for composing the affine map of an approximation interval [a, b] onto [-1, 1] (i.e., t = alpha * x - beta)
+	Note: The polynomial is evaluated on t, thus, a caller either multiplies its input with alpha and subtracts beta (one level), or folds alpha
+		  and beta into the linear stage producing the input (e.g., the residues and the CUSUM sum, see foldCUSUMRangeTransformMRP).
+*/
+void chebyshevRangeTransformPLCP(double lowBound, double upBound, double *alpha, double *beta){
+	*alpha = 2 / (upBound - lowBound);
+	*beta  = (lowBound + upBound) / (upBound - lowBound);
+}
+
+/* The names, the degrees and the coefficients of the odd powers (x, x^3, x^5, x^7) of the sign stages (in the order of signStagePLCP) */
+static const char * const signStageNames[] = {"f1", "f3", "g1", "g3", NULL};
+static const int signStageDegrees[] 	   = {3, 7, 3, 7};
+static const double signStageCoeffs[][4]   = {
+	{3.0 / 2, -1.0 / 2, 0, 0},
+	{35.0 / 16, -35.0 / 16, 21.0 / 16, -5.0 / 16},
+	{2126.0 / 1024, -1359.0 / 1024, 0, 0},
+	{4589.0 / 1024, -16577.0 / 1024, 25614.0 / 1024, -12860.0 / 1024}
+};
+
+/*
+	The function for parsing the stages of a composite sign approximation (e.g., "g3,f3", the innermost stage first), the number of the stages is returned (-1 if malformed)
+*/
+int parseSignStagesPLCP(const char *spec, int *stages, int maxStages){
+	char buffer[256];
+	if(strlen(spec) >= sizeof(buffer))
+		return -1;
+	snprintf(buffer, sizeof(buffer), "%s", spec);
+	int numStages 	= 0;
+	char *savePtr 	= NULL;
+	for(char *token = strtok_r(buffer, ", ", &savePtr); token != NULL; token = strtok_r(NULL, ", ", &savePtr)){
+		int stage = -1;
+		for(int s = 0; signStageNames[s] != NULL; s++){
+			if(strcmp(signStageNames[s], token) == 0)
+				stage = s;
+		}
+		if(stage < 0 || numStages == maxStages)
+			return -1;
+		stages[numStages++] = stage;
+	}
+	return (numStages > 0) ? numStages : -1;
+}
+
+/*
+	The function for obtaining the multiplicative depth of a composite sign approximation
+	Note: A degree-3 stage consumes two levels and a degree-7 stage three levels (see evaluateSignStagePLCP)
+*/
+int signStagesDepthPLCP(const int *stages, int numStages){
+	int depth = 0;
+	for(int s = 0; s < numStages; s++)
+		depth += (signStageDegrees[stages[s]] == 3) ? 2 : 3;
+	return depth;
+}
+
+/*
+	The function for obtaining the multiplicative depth of a Chebyshev approximation of the given degree (the polynomials and the coefficient products)
+	Note: T[2i] = 2 * T[i] * T[i] - 1 and T[2i + 1] = 2 * T[i] * T[i + 1] - x reach ceil(log2(degree)) products, the coefficients take one more level
+*/
+int chebyshevDepthPLCP(int degree){
+	int depth = 0;
+	while((1 << depth) < degree)
+		depth++;
+	return depth + 1;
+}
+
+/*
+	The function for evaluating a composite sign approximation on the cleartext (the reference of the encrypted evaluation)
+*/
+double evaluateCompositeSignPLCP(double x, const int *stages, int numStages){
+	for(int s = 0; s < numStages; s++){
+		const double *c = signStageCoeffs[stages[s]];
+		double x2 		= x * x;
+		x = x * (c[0] + x2 * (c[1] + x2 * (c[2] + x2 * c[3])));
+	}
+	return x;
+}
+
+/*
+	The function for multiplying a ciphertext with a scalar into another ciphertext (one level)
+*/
+static void multiplyScalarPLCP(Ciphertext *productPtr, Ciphertext *vecPtr, double value, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr){
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	Plaintext plain_coeff_Local;
+	Plaintext * plaintextCoeffPtr = acquirePlaintextArena(&plain_coeff_Local);
+	*productPtr = *vecPtr;
+	// Take the coefficient from the registry (encoded once) or encode it into the arena plaintext
+	Plaintext * coeffPtr = scalarConstantPLCP(value, productPtr, scale, encoderPtr, plaintextCoeffPtr);
+	adjustScaleandChainParametersPlaintextAndVectors(productPtr, coeffPtr, scale, contextPtr, evaluatorPtr);
+	evaluatorPtr->multiply_plain_inplace(*productPtr, *coeffPtr);
+	evaluatorPtr->rescale_to_next_inplace(*productPtr);
+	releaseArenaPLCP(mark);
+}
+
+/*
+	The function for multiplying a ciphertext with a scalar into another ciphertext without the rescale (i.e., a term of a lazy sum of products)
+*/
+static void multiplyScalarLazyPLCP(Ciphertext *productPtr, Ciphertext *vecPtr, double value, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr){
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	Plaintext plain_coeff_Local;
+	Plaintext * plaintextCoeffPtr = acquirePlaintextArena(&plain_coeff_Local);
+	Plaintext * coeffPtr = scalarConstantPLCP(value, vecPtr, scale, encoderPtr, plaintextCoeffPtr);
+	plnCprAxMultLazy_mrp(productPtr, vecPtr, coeffPtr, scale, contextPtr, evaluatorPtr);
+	releaseArenaPLCP(mark);
+}
+
+/*
+	The function for evaluating c1 * v + c3 * v^3 from v and v^2 (two levels, the coefficient multiplications are parallel to the squaring)
+*/
+static void evaluateOddCubicPLCP(Ciphertext *cubicOutputPtr, Ciphertext *vecPtr, Ciphertext *vecSquarePtr, double c1, double c3, double scale, 
+	SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr){
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	Ciphertext linear_Local, cubicCoeff_Local, cubic_Local;
+	Ciphertext *linearPtr 	  = acquireCiphertextArena(&linear_Local);
+	Ciphertext *cubicCoeffPtr = acquireCiphertextArena(&cubicCoeff_Local);
+	Ciphertext *cubicPtr 	  = acquireCiphertextArena(&cubic_Local);
+	Ciphertext lazySum_Local;
+	Ciphertext *lazySumPtr = acquireCiphertextArena(&lazySum_Local);
+	bool isLazySumEmpty = true;
+	multiplyScalarPLCP(cubicCoeffPtr, vecPtr, c3, scale, contextPtr, evaluatorPtr, encoderPtr);
+	// (c3 * v) * v^2 and c1 * v are summed before a single relinearization and rescale (c1 * v is mod-switched to the level of v^2)
+	matrixVectorMultLazyRowPacking(cubicPtr, cubicCoeffPtr, vecSquarePtr, scale, contextPtr, evaluatorPtr);
+	accumulateLazySumPLCP(lazySumPtr, cubicPtr, &isLazySumEmpty, scale, contextPtr, evaluatorPtr);
+	multiplyScalarLazyPLCP(linearPtr, vecPtr, c1, scale, contextPtr, evaluatorPtr, encoderPtr);
+	accumulateLazySumPLCP(lazySumPtr, linearPtr, &isLazySumEmpty, scale, contextPtr, evaluatorPtr);
+	finalizeLazySumPLCP(cubicOutputPtr, lazySumPtr, evaluatorPtr, relin_keysPtr);
+	releaseArenaPLCP(mark);
+}
+
+/*
+	The function for evaluating a sign stage (i.e., an odd polynomial of degree 3 or 7) with its coefficients multiplied by coeffScale
+	Note: The degree-7 polynomial is split as (c1 * v + c3 * v^3) + v^4 * (c5 * v + c7 * v^3), thus, it consumes three levels instead of four (Horner)
+*/
+static void evaluateSignStagePLCP(Ciphertext *stageOutputPtr, Ciphertext *vecPtr, int stage, double coeffScale, double scale, 
+	SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr){
+	const double *c = signStageCoeffs[stage];
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	Ciphertext square_Local;
+	Ciphertext *squarePtr = acquireCiphertextArena(&square_Local);
+	vectorSquaringRowPacking(squarePtr, vecPtr, scale, contextPtr, evaluatorPtr, relin_keysPtr);
+	if(signStageDegrees[stage] == 3){
+		evaluateOddCubicPLCP(stageOutputPtr, vecPtr, squarePtr, coeffScale * c[0], coeffScale * c[1], scale, contextPtr, evaluatorPtr, encoderPtr, relin_keysPtr);
+	}else{
+		Ciphertext fourth_Local, lowTerms_Local, highTerms_Local, highProd_Local;
+		Ciphertext *fourthPtr 	 = acquireCiphertextArena(&fourth_Local);
+		Ciphertext *lowTermsPtr  = acquireCiphertextArena(&lowTerms_Local);
+		Ciphertext *highTermsPtr = acquireCiphertextArena(&highTerms_Local);
+		Ciphertext *highProdPtr  = acquireCiphertextArena(&highProd_Local);
+		vectorSquaringRowPacking(fourthPtr, squarePtr, scale, contextPtr, evaluatorPtr, relin_keysPtr);
+		evaluateOddCubicPLCP(lowTermsPtr, vecPtr, squarePtr, coeffScale * c[0], coeffScale * c[1], scale, contextPtr, evaluatorPtr, encoderPtr, relin_keysPtr);
+		evaluateOddCubicPLCP(highTermsPtr, vecPtr, squarePtr, coeffScale * c[2], coeffScale * c[3], scale, contextPtr, evaluatorPtr, encoderPtr, relin_keysPtr);
+		matrixVectorMultMatRowPacking(highProdPtr, fourthPtr, highTermsPtr, scale, contextPtr, evaluatorPtr, relin_keysPtr);
+		addSubtractTwoVector(stageOutputPtr, lowTermsPtr, highProdPtr, scale, contextPtr, evaluatorPtr, true);
+	}
+	releaseArenaPLCP(mark);
+}
+
+/*
+	The function for performing the composite sign approximation of u in [-1, 1] (the last stage is multiplied with outScale)
+	Note: Each stage maps [-1, 1] into [-1, 1] and pushes the values away from zero towards -1 or 1, thus, the precision near zero grows with the
+		  number of the stages while every stage only consumes two or three levels (see signStagesDepthPLCP).
+*/
+void makeCompositeSignAppxPLCP(Ciphertext *signOutputPtr, Ciphertext *vecTobeAppx_CP, const int *stages, int numStages, double outScale, double scale, 
+	SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr){
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	Ciphertext stageIn_Local, stageOut_Local;
+	Ciphertext *stageInPtr  = acquireCiphertextArena(&stageIn_Local);
+	Ciphertext *stageOutPtr = acquireCiphertextArena(&stageOut_Local);
+	*stageInPtr = *vecTobeAppx_CP;
+	for(int s = 0; s < numStages; s++){
+		double coeffScale = (s == numStages - 1) ? outScale : 1;
+		evaluateSignStagePLCP(stageOutPtr, stageInPtr, stages[s], coeffScale, scale, contextPtr, evaluatorPtr, encoderPtr, relin_keysPtr);
+		swap(stageInPtr, stageOutPtr);
+	}
+	*signOutputPtr = *stageInPtr;
+	releaseArenaPLCP(mark);
+}
+
+/*
+	The function for performing the max(x, 0) approximation of u = x / bound via the composite sign approximation (i.e., (x + x * sign(x)) / 2)
+*/
+void makeCompositeMaxAppxPLCP(Ciphertext *maxOutputPtr, Ciphertext *vecTobeAppx_CP, double bound, const int *stages, int numStages, double scale, 
+	SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr){
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	Ciphertext sign_Local, halfInput_Local, product_Local;
+	Ciphertext *signPtr 	 = acquireCiphertextArena(&sign_Local);
+	Ciphertext *halfInputPtr = acquireCiphertextArena(&halfInput_Local);
+	Ciphertext *productPtr 	 = acquireCiphertextArena(&product_Local);
+	makeCompositeSignAppxPLCP(signPtr, vecTobeAppx_CP, stages, numStages, 1, scale, contextPtr, evaluatorPtr, encoderPtr, relin_keysPtr);
+	// x / 2 = (bound / 2) * u (parallel to the sign stages)
+	multiplyScalarPLCP(halfInputPtr, vecTobeAppx_CP, bound / 2, scale, contextPtr, evaluatorPtr, encoderPtr);
+	matrixVectorMultMatRowPacking(productPtr, halfInputPtr, signPtr, scale, contextPtr, evaluatorPtr, relin_keysPtr);
+	addSubtractTwoVector(maxOutputPtr, halfInputPtr, productPtr, scale, contextPtr, evaluatorPtr, true);
+	releaseArenaPLCP(mark);
+}
+
+/*
+	The function for performing the Ind(x > 0) approximation of u = x / bound via the composite sign approximation (i.e., (1 + sign(x)) / 2)
+	Note: The 1/2 of the sign is folded into the coefficients of the last stage, thus, the indicator consumes the depth of the sign only
+*/
+void makeCompositeIndAppxPLCP(Ciphertext *indOutputPtr, Ciphertext *vecTobeAppx_CP, const int *stages, int numStages, double scale, 
+	SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr){
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	Plaintext plain_half_Local;
+	Plaintext * plaintextHalfPtr = acquirePlaintextArena(&plain_half_Local);
+	makeCompositeSignAppxPLCP(indOutputPtr, vecTobeAppx_CP, stages, numStages, 0.5, scale, contextPtr, evaluatorPtr, encoderPtr, relin_keysPtr);
+	Plaintext * halfPtr = scalarConstantPLCP(0.5, indOutputPtr, scale, encoderPtr, plaintextHalfPtr);
+	adjustScaleandChainParametersPlaintextAndVectors(indOutputPtr, halfPtr, scale, contextPtr, evaluatorPtr);
+	evaluatorPtr->add_plain_inplace(*indOutputPtr, *halfPtr);
+	releaseArenaPLCP(mark);
+}
+
 /*
 	The function for performing the ciphertext-plaintext-mixed Chebyshev Approximation   
 */
@@ -56,91 +269,57 @@ void makeChebyshevPolynAppxPLCP(
 	RelinKeys *relin_keysPtr, 
 	Decryptor *decryptorPtr){
 
-	// Create Chebyshev Polynomials Array (parallel to the cleartext implementation of the Chebyshev Approximation)		  	
-	vector<Ciphertext> chebyshevPolynomials(numCoeff + 1);
-	chebyshevPolynomials[1] = *vecTobeAppx_CP; // First index becomes zero
+	// Take the Chebyshev Polynomials Array (parallel to the cleartext implementation of the Chebyshev Approximation) and the temporaries from the arena		  	
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	vector<Ciphertext> chebyshevPolynomials_Local;
+	Ciphertext twoTimesResChebyPoly_Local, sumWoutFirstTerms_Local;
+	vector<Ciphertext> * chebyshevPolynomials = acquireCiphertextVecArena(numCoeff + 1, &chebyshevPolynomials_Local);
+	Ciphertext *twoTimesResChebyPolyPtr 	  = acquireCiphertextArena(&twoTimesResChebyPoly_Local);
+	Ciphertext *sumWoutFirstTermsPtr 		  = acquireCiphertextArena(&sumWoutFirstTerms_Local);
+	chebyshevPolynomials->at(1) = *vecTobeAppx_CP; // First index becomes zero
 	
 	// Evaluate the Chebyshev Polynomials for the given u 
 	for(size_t i = 2; i < numCoeff + 1; i++){
 		if(i % 2 == 0){ // Once the index is even 
 			// Create the ciphertext pointer for the targeted chebyshev polynomial   
-			Ciphertext *target_ChebPolyPtr 				 = &chebyshevPolynomials[i];
-			Ciphertext *target_ChebPoly_MultiplicandPtr1 = &chebyshevPolynomials[i/2];
-			Ciphertext *target_ChebPoly_MultiplicandPtr2 = &chebyshevPolynomials[i/2]; 	
+			Ciphertext *target_ChebPolyPtr 				 = &chebyshevPolynomials->at(i);
+			Ciphertext *target_ChebPoly_MultiplicandPtr1 = &chebyshevPolynomials->at(i/2);
+			Ciphertext *target_ChebPoly_MultiplicandPtr2 = &chebyshevPolynomials->at(i/2); 	
 			// Multiply T[n] * T[n]
 			matrixVectorMultMatRowPacking(target_ChebPolyPtr, target_ChebPoly_MultiplicandPtr1, target_ChebPoly_MultiplicandPtr2, scale, contextPtr, evaluatorPtr, relin_keysPtr);
 			// Obtain  2 * T[n] * T[n] by a single addition 						
-			Ciphertext twoTimesResChebyPoly;   
-			Ciphertext *twoTimesResChebyPolyPtr = &twoTimesResChebyPoly;
 			addSubtractTwoVector(twoTimesResChebyPolyPtr, target_ChebPolyPtr, target_ChebPolyPtr, scale, contextPtr, evaluatorPtr, true);			
-			// Make the last subtraction 
-			Ciphertext resChebyPolynomial;  
-			Ciphertext *resChebyPolynomialPtr = &resChebyPolynomial;					
-			addSubtractPLCPVector(resChebyPolynomialPtr, twoTimesResChebyPolyPtr, vectorOnePtr_PL, scale, 	contextPtr,	evaluatorPtr, false); 
-			chebyshevPolynomials[i] = resChebyPolynomial; 
+			// Make the last subtraction (directly into the targeted chebyshev polynomial)
+			addSubtractPLCPVector(target_ChebPolyPtr, twoTimesResChebyPolyPtr, vectorOnePtr_PL, scale, 	contextPtr,	evaluatorPtr, false); 
 		}else{// Once the index is even 	 	
 			// Create the ciphertext pointer for the targeted chebyshev polynomial
-			Ciphertext *target_ChebPolyPtr 					= &chebyshevPolynomials[i];
-			Ciphertext *target_ChebPoly_Multiplicand1Ptr 	= &chebyshevPolynomials[i/2];				
-			Ciphertext *target_ChebPoly_Multiplicand2Ptr 	= &chebyshevPolynomials[i/2 + 1];
+			Ciphertext *target_ChebPolyPtr 					= &chebyshevPolynomials->at(i);
+			Ciphertext *target_ChebPoly_Multiplicand1Ptr 	= &chebyshevPolynomials->at(i/2);				
+			Ciphertext *target_ChebPoly_Multiplicand2Ptr 	= &chebyshevPolynomials->at(i/2 + 1);
 		   	// Multiply T[n] * T[n + 1]
 			matrixVectorMultMatRowPacking(target_ChebPolyPtr, target_ChebPoly_Multiplicand1Ptr, target_ChebPoly_Multiplicand2Ptr, scale, contextPtr, evaluatorPtr, relin_keysPtr);
 			// Obtain 2 * T[n] * T[n + 1] by a single addition
-			Ciphertext twoTimesResChebyPoly;   
-			Ciphertext *twoTimesResChebyPolyPtr = &twoTimesResChebyPoly;
 			addSubtractTwoVector(twoTimesResChebyPolyPtr, target_ChebPolyPtr, target_ChebPolyPtr, scale, contextPtr, evaluatorPtr, true);
-			// Make the last subtraction 
-			Ciphertext resChebyPolynomial;  
-			Ciphertext *resChebyPolynomialPtr = &resChebyPolynomial;
-			addSubtractTwoVector(resChebyPolynomialPtr, twoTimesResChebyPolyPtr, vecTobeAppx_CP, scale, contextPtr, evaluatorPtr, false); 
-			chebyshevPolynomials[i] = resChebyPolynomial;
+			// Make the last subtraction (directly into the targeted chebyshev polynomial)
+			addSubtractTwoVector(target_ChebPolyPtr, twoTimesResChebyPolyPtr, vecTobeAppx_CP, scale, contextPtr, evaluatorPtr, false); 
 		}																																																	
 	}
 
-	// Multiply the obtained Chebyshev Polynomials with the coeffients of the polynomials 
+	// Multiply the obtained Chebyshev Polynomials with the coeffients of the polynomials and add each product on top of each other without 
+	// rescaling the products (the sum is rescaled once, and the shallower products are only mod-switched to the level of the deepest polynomial)
+	Ciphertext lazyProduct_Local, lazySum_Local;
+	Ciphertext *lazyProductPtr = acquireCiphertextArena(&lazyProduct_Local);
+	Ciphertext *lazySumPtr 	   = acquireCiphertextArena(&lazySum_Local);
+	bool isLazySumEmpty = true;
 	for(size_t i = 1; i < numCoeff + 1; i++){ 
-		Ciphertext * respChebTermPtr = & chebyshevPolynomials[i]; 
-		plnCprAxMult_InPlac_mrp(respChebTermPtr, &powSerCoeffArr_PL->at(i), scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);
+		plnCprAxMultLazy_mrp(lazyProductPtr, &chebyshevPolynomials->at(i), &powSerCoeffArr_PL->at(i), scale, contextPtr, evaluatorPtr);
+		accumulateLazySumPLCP(lazySumPtr, lazyProductPtr, &isLazySumEmpty, scale, contextPtr, evaluatorPtr);
 	}
-		
-	// Add each product on top of each other: Call the add_many function implemented in a customized way 	
-	vector <Ciphertext> * chebVectorPtr = & chebyshevPolynomials;  
-	Ciphertext sumWoutFirstTerms;	
-	Ciphertext *sumWoutFirstTermsPtr = &sumWoutFirstTerms; 				
-	addManyVectorsInaRow_PL(sumWoutFirstTermsPtr, chebVectorPtr, numCoeff, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr, relin_keysPtr);		
+	finalizeLazySumPLCP(sumWoutFirstTermsPtr, lazySumPtr, evaluatorPtr, relin_keysPtr);
 				
 	// Do last plaintext-ciphertext addition to add the very first term of the Chebyshev power series 
 	addSubtractPLCPVector(sumOutputPtr, sumWoutFirstTermsPtr, firstPowerSeriesTermPtr_PL, scale, contextPtr,	evaluatorPtr, true);	
-}
-
-/*
-	The function for performing the multiple polynomials addition in the ciphertext-plaintext-mixed setting (actually all the terms except the first term)   
-*/
-void addManyVectorsInaRow_PL(Ciphertext *sumOutputPtr, vector <Ciphertext> * chebVectorPtr, int exactNumCoeff, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, GaloisKeys *gal_keysPtr, RelinKeys *relin_keysPtr){
-		
-	// Find the minimum chain index
-	int min_chain_index = 999;
-	parms_id_type min_parms_id;
-	for(size_t i = 1; i < exactNumCoeff + 1; i++){
-		int chain_index = (*contextPtr->get_context_data(chebVectorPtr->at(i).parms_id())).chain_index();
-		if(chain_index < min_chain_index){
-			min_chain_index = chain_index;
-			min_parms_id 	= chebVectorPtr->at(i).parms_id();
-		} 
-	}	
-
-	// Adjust each chain index to the minimum chain index and scale to the already-setted scale, so that they could be added on top of another 
-	for(size_t i = 1; i < exactNumCoeff + 1; i++){
-    	evaluatorPtr->mod_switch_to_inplace(chebVectorPtr->at(i), min_parms_id);	
-		chebVectorPtr->at(i).scale() = scale;	
-	}
-	
-	// Add each Chebyshev polynomial on top of another     
-	Ciphertext *ChebyshevPtr1 = &chebVectorPtr->at(1);
-	Ciphertext *ChebyshevPtr2 = &chebVectorPtr->at(2);
-    addSubtractTwoVector(sumOutputPtr, ChebyshevPtr1, ChebyshevPtr2, scale, contextPtr, evaluatorPtr, true);
-	for(size_t i = 3; i < exactNumCoeff; i++)
-		evaluatorPtr->add_inplace(*sumOutputPtr, chebVectorPtr->at(i));
+	releaseArenaPLCP(mark);
 }
 
 /*
@@ -161,65 +340,60 @@ void applyChebyshevPolynomials(
 	RelinKeys *relin_keysPtr, 
 	Decryptor *decryptorPtr){
 
-	// Create Chebyshev Polynomials Array (parallel to the cleartext implementation of the Chebyshev Approximation)		  	
-	vector<Ciphertext> chebyshevPolynomials(numCoeff + 1);
-	chebyshevPolynomials[0] = *vectorOnePtr;
-	chebyshevPolynomials[1] = *vectorNotKnownPosNegPtr;
+	// Take the Chebyshev Polynomials Array (parallel to the cleartext implementation of the Chebyshev Approximation) and the temporaries from the arena		  	
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	vector<Ciphertext> chebyshevPolynomials_Local;
+	Ciphertext twoTimesResChebyPoly_Local;
+	Plaintext plain_coeff_Local;
+	vector<Ciphertext> * chebyshevPolynomials = acquireCiphertextVecArena(numCoeff + 1, &chebyshevPolynomials_Local);
+	Ciphertext *twoTimesResChebyPolyPtr 	  = acquireCiphertextArena(&twoTimesResChebyPoly_Local);
+	Plaintext * plaintextCoeffPtr 			  = acquirePlaintextArena(&plain_coeff_Local);
+	chebyshevPolynomials->at(0) = *vectorOnePtr;
+	chebyshevPolynomials->at(1) = *vectorNotKnownPosNegPtr;
 	
 	// Evaluate the Chebyshev Polynomials for the given u 
 	for(size_t i = 2; i < numCoeff + 1; i++){
 		if(i % 2 == 0){// Once the index is even 
 			// Create the ciphertext pointer for the targeted chebyshev polynomial
-			Ciphertext *target_ChebPolyPtr 				 = &chebyshevPolynomials[i];
-			Ciphertext *target_ChebPoly_MultiplicandPtr1 = &chebyshevPolynomials[i/2];
-			Ciphertext *target_ChebPoly_MultiplicandPtr2 = &chebyshevPolynomials[i/2]; 	
+			Ciphertext *target_ChebPolyPtr 				 = &chebyshevPolynomials->at(i);
+			Ciphertext *target_ChebPoly_MultiplicandPtr1 = &chebyshevPolynomials->at(i/2);
+			Ciphertext *target_ChebPoly_MultiplicandPtr2 = &chebyshevPolynomials->at(i/2); 	
 			// Multiply T[n] * T[n]
 			matrixVectorMultMatRowPacking(target_ChebPolyPtr, target_ChebPoly_MultiplicandPtr1, target_ChebPoly_MultiplicandPtr2, scale, contextPtr, evaluatorPtr, relin_keysPtr);
 			// Obtain  2 * T[n] * T[n] by a single addition 						
-			Ciphertext twoTimesResChebyPoly;   
-			Ciphertext *twoTimesResChebyPolyPtr = &twoTimesResChebyPoly;
 			addSubtractTwoVector(twoTimesResChebyPolyPtr, target_ChebPolyPtr, target_ChebPolyPtr, scale, contextPtr, evaluatorPtr, true);			
-			// Make the last subtraction 
-			Ciphertext resChebyPolynomial;  
-			Ciphertext *resChebyPolynomialPtr = &resChebyPolynomial;
-			addSubtractTwoVector(resChebyPolynomialPtr, twoTimesResChebyPolyPtr, vectorOnePtr, scale, 	contextPtr,	evaluatorPtr, false);					
-			chebyshevPolynomials[i] = resChebyPolynomial; 
+			// Make the last subtraction (directly into the targeted chebyshev polynomial)
+			addSubtractTwoVector(target_ChebPolyPtr, twoTimesResChebyPolyPtr, vectorOnePtr, scale, 	contextPtr,	evaluatorPtr, false);					
 		}else{// Once the index is odd 
 			// Create the ciphertext pointer for the targeted chebyshev polynomial	
-			Ciphertext *target_ChebPolyPtr 				 = &chebyshevPolynomials[i];
-			Ciphertext *target_ChebPoly_Multiplicand1Ptr = &chebyshevPolynomials[i/2];				
-			Ciphertext *target_ChebPoly_Multiplicand2Ptr = &chebyshevPolynomials[i/2 + 1];
+			Ciphertext *target_ChebPolyPtr 				 = &chebyshevPolynomials->at(i);
+			Ciphertext *target_ChebPoly_Multiplicand1Ptr = &chebyshevPolynomials->at(i/2);				
+			Ciphertext *target_ChebPoly_Multiplicand2Ptr = &chebyshevPolynomials->at(i/2 + 1);
 		   	// Multiply T[n] * T[n + 1]
 			matrixVectorMultMatRowPacking(target_ChebPolyPtr, target_ChebPoly_Multiplicand1Ptr, target_ChebPoly_Multiplicand2Ptr, scale, contextPtr, evaluatorPtr, relin_keysPtr);
 			// Obtain 2 * T[n] * T[n + 1] by a single addition
-			Ciphertext twoTimesResChebyPoly;   
-			Ciphertext *twoTimesResChebyPolyPtr = &twoTimesResChebyPoly;
 			addSubtractTwoVector(twoTimesResChebyPolyPtr, target_ChebPolyPtr, target_ChebPolyPtr, scale, contextPtr, evaluatorPtr, true);
-			// Make the last subtraction 
-			Ciphertext resChebyPolynomial;  
-			Ciphertext *resChebyPolynomialPtr = &resChebyPolynomial;
-			addSubtractTwoVector(resChebyPolynomialPtr, twoTimesResChebyPolyPtr, vectorNotKnownPosNegPtr, scale, contextPtr, evaluatorPtr, false); // chebyshevPolynomials[1]
-			chebyshevPolynomials[i] = resChebyPolynomial;
+			// Make the last subtraction (directly into the targeted chebyshev polynomial)
+			addSubtractTwoVector(target_ChebPolyPtr, twoTimesResChebyPolyPtr, vectorNotKnownPosNegPtr, scale, contextPtr, evaluatorPtr, false); // chebyshevPolynomials[1]
 		}																																																	
 	}
-	chebyshevPolynomials[0] = *firsCoeffArrPtr;
+	chebyshevPolynomials->at(0) = *firsCoeffArrPtr;
 		
 	// Multiply the Chebyshev Polynomials with the coeffients of the polynomials 
 	for(size_t i = 1; i < numCoeff + 1; i++){
 		double coeff 		= coeffArr[i-1]; 
-		Plaintext plain_coeff; 
-		Plaintext * plaintextCoeffPtr 		= &plain_coeff; 
-		encoderPtr-> encode(coeff, scale, plain_coeff);
-		Ciphertext * respectiveChebyshevPtr = & chebyshevPolynomials[i]; 
-		adjustScaleandChainParametersPlaintextAndVectors(respectiveChebyshevPtr, plaintextCoeffPtr, scale, contextPtr, evaluatorPtr);
-		evaluatorPtr->multiply_plain_inplace(chebyshevPolynomials[i], plain_coeff); 
-		evaluatorPtr->rescale_to_next_inplace(chebyshevPolynomials[i]);
+		Ciphertext * respectiveChebyshevPtr = & chebyshevPolynomials->at(i); 
+		// Take the coefficient from the registry (encoded once) or encode it into the arena plaintext
+		Plaintext * coeffPtr = scalarConstantPLCP(coeff, respectiveChebyshevPtr, scale, encoderPtr, plaintextCoeffPtr);
+		adjustScaleandChainParametersPlaintextAndVectors(respectiveChebyshevPtr, coeffPtr, scale, contextPtr, evaluatorPtr);
+		evaluatorPtr->multiply_plain_inplace(*respectiveChebyshevPtr, *coeffPtr); 
+		evaluatorPtr->rescale_to_next_inplace(*respectiveChebyshevPtr);
 	}
 
 	// Add each product on top of each other
 	// evaluatorPtr->add_many(chebyshevPolynomials, *sumOutputPtr); // BUGGY: DOES NOT WORK DUE TO PARAMETER MISMATCH	 	
-	vector <Ciphertext> * chebVectorPtr = &chebyshevPolynomials;  
-	addManyVectorsInaRow(sumOutputPtr, chebVectorPtr, numCoeff + 1, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr, relin_keysPtr);	
+	addManyVectorsInaRow(sumOutputPtr, chebyshevPolynomials, numCoeff + 1, scale, contextPtr, evaluatorPtr, encoderPtr, gal_keysPtr, relin_keysPtr);	
+	releaseArenaPLCP(mark);
 }
 
 /*
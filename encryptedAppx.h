@@ -33,6 +33,23 @@
 using namespace std;
 using namespace seal;
 
+/* Define the constants */
+#define maxSignStages 8 // Stages of a composite sign approximation
+
+/* The approximation backends of the CUSUM nonlinearities (i.e., Eq8 max and Eq9 indicator) */
+enum cusumAppxBackendPLCP {
+	CUSUM_APPX_CHEBYSHEV,		// Chebyshev power series on the interval [a, b] (see makeChebyshevPolynAppxPLCP)
+	CUSUM_APPX_COMPOSITE_SIGN	// Composition of low-degree odd polynomials approximating sign(x) on [-1, 1] (see makeCompositeSignAppxPLCP)
+};
+
+/* The stages of the composite sign approximation (f: the majority polynomials, g: the faster-converging polynomials of Cheon et al.) */
+enum signStagePLCP {
+	SIGN_STAGE_F1, // (3x - x^3) / 2
+	SIGN_STAGE_F3, // (35x - 35x^3 + 21x^5 - 5x^7) / 16
+	SIGN_STAGE_G1, // (2126x - 1359x^3) / 1024
+	SIGN_STAGE_G3  // (4589x - 16577x^3 + 25614x^5 - 12860x^7) / 1024
+};
+
 /* The function for performing the ciphertext-plaintext-mixed Chebyshev Approximation */
 void applyChebyshevPolynomials(
 	Ciphertext *sumOutputPtr, 
@@ -69,8 +86,32 @@ void makeChebyshevPolynAppxPLCP(
 	RelinKeys *relin_keysPtr, 
 	Decryptor *decryptorPtr);	
 
-/* The function for performing the multiple polynomials addition in the ciphertext-only setting (actually all the terms except the first term)  */	
-void addManyVectorsInaRow_PL(Ciphertext *sumOutputPtr, vector <Ciphertext> * chebVectorPtr, int exactNumCoeff, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, GaloisKeys *gal_keysPtr, RelinKeys *relin_keysPtr);
+/* The function for composing the affine map of an approximation interval [a, b] onto [-1, 1] (i.e., t = alpha * x - beta), which the callers fold into their linear stages */
+void chebyshevRangeTransformPLCP(double lowBound, double upBound, double *alpha, double *beta);
+
+/* The function for parsing the stages of a composite sign approximation (e.g., "g3,f3", the innermost stage first), the number of the stages is returned (-1 if malformed) */
+int parseSignStagesPLCP(const char *spec, int *stages, int maxStages);
+
+/* The function for obtaining the multiplicative depth of a composite sign approximation */
+int signStagesDepthPLCP(const int *stages, int numStages);
+
+/* The function for obtaining the multiplicative depth of a Chebyshev approximation of the given degree (the polynomials and the coefficient products) */
+int chebyshevDepthPLCP(int degree);
+
+/* The function for evaluating a composite sign approximation on the cleartext (the reference of the encrypted evaluation) */
+double evaluateCompositeSignPLCP(double x, const int *stages, int numStages);
+
+/* The function for performing the composite sign approximation of u in [-1, 1] (the last stage is multiplied with outScale) */
+void makeCompositeSignAppxPLCP(Ciphertext *signOutputPtr, Ciphertext *vecTobeAppx_CP, const int *stages, int numStages, double outScale, double scale, 
+	SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr);
+
+/* The function for performing the max(x, 0) approximation of u = x / bound via the composite sign approximation (i.e., (x + x * sign(x)) / 2) */
+void makeCompositeMaxAppxPLCP(Ciphertext *maxOutputPtr, Ciphertext *vecTobeAppx_CP, double bound, const int *stages, int numStages, double scale, 
+	SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr);
+
+/* The function for performing the Ind(x > 0) approximation of u = x / bound via the composite sign approximation (i.e., (1 + sign(x)) / 2) */
+void makeCompositeIndAppxPLCP(Ciphertext *indOutputPtr, Ciphertext *vecTobeAppx_CP, const int *stages, int numStages, double scale, 
+	SEALContext *contextPtr, Evaluator *evaluatorPtr, CKKSEncoder *encoderPtr, RelinKeys *relin_keysPtr);
 
 #endif
 
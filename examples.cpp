@@ -2,12 +2,29 @@
 // Licensed under the MIT license.
 
 #include "examples.h"
+#include "runConfigPLCP.h"
 
 using namespace std;
 using namespace seal;
 
-int main()
+int main(int argc, char *argv[])
 {
+    /*
+    Read the run configuration (the --config file and the --key=value overrides).
+    With --example=N the selected example is run once without the console menu.
+    */
+    static struct runConfigPLCP runConfig;
+    if (!parseRunConfigPLCP(&runConfig, argc, argv))
+    {
+        bool isHelp = false;
+        for (int i = 1; i < argc; i++)
+        {
+            isHelp = isHelp || string(argv[i]) == "--help" || string(argv[i]) == "-h";
+        }
+        return isHelp ? 0 : 1;
+    }
+    activeRunConfigPLCP = &runConfig;
+
     cout << "Microsoft SEAL version: " << SEAL_VERSION << endl;
     while (true)
     {
@@ -24,6 +41,13 @@ int main()
         cout << "| 5. Rotation                | 5_rotation.cpp             |" << endl;
         cout << "| 6. Serialization           | 6_serialization.cpp        |" << endl;
         cout << "| 7. Performance Test        | 7_performance.cpp          |" << endl;
+        cout << "| 8. Cleartext CUSUM Baseline| cleartextCUSUM.cpp         |" << endl;
+        cout << "| 9. Diagonal vs MRP Bench.  | diagonalPacking.cpp        |" << endl;
+        cout << "| 10. Soak Benchmark (RSS)   | sessionPLCP.cpp            |" << endl;
+        cout << "| 11. Parameter Sweep        | sweepPLCP.cpp              |" << endl;
+        cout << "| 12. CUSUM Appx. Backends   | appxBenchmarkPLCP.cpp      |" << endl;
+        cout << "| 13. Complex Slot Packing   | complexPackingPLCP.cpp     |" << endl;
+        cout << "| 14. Tiled vs MRP Check     | tiledMRP.cpp               |" << endl;
         cout << "+----------------------------+----------------------------+" << endl;
 
         /*
@@ -36,30 +60,33 @@ int main()
         cout << "[" << setw(7) << right << megabytes << " MB] "
              << "Total allocation from the memory pool" << endl;
 
-        int selection = 0;
+        int selection = runConfig.exampleSelection;
         bool valid = true;
-        do
+        if (runConfig.exampleSelection == 0)
         {
-            cout << endl << "> Run example (1 ~ 7) or exit (0): ";
-            if (!(cin >> selection))
-            {
-                valid = false;
-            }
-            else if (selection < 0 || selection > 7)
-            {
-                valid = false;
-            }
-            else
+            do
             {
-                valid = true;
-            }
-            if (!valid)
-            {
-                cout << "  [Beep~~] valid option: type 0 ~ 7" << endl;
-                cin.clear();
-                cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            }
-        } while (!valid);
+                cout << endl << "> Run example (1 ~ 14) or exit (0): ";
+                if (!(cin >> selection))
+                {
+                    valid = false;
+                }
+                else if (selection < 0 || selection > 14)
+                {
+                    valid = false;
+                }
+                else
+                {
+                    valid = true;
+                }
+                if (!valid)
+                {
+                    cout << "  [Beep~~] valid option: type 0 ~ 14" << endl;
+                    cin.clear();
+                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                }
+            } while (!valid);
+        }
 
         switch (selection)
         {
@@ -91,9 +118,43 @@ int main()
             example_performance_test();
             break;
 
+        case 8:
+            example_cleartext_cusum();
+            break;
+
+        case 9:
+            example_diagonal_benchmark();
+            break;
+
+        case 10:
+            example_soak_benchmark();
+            break;
+
+        case 11:
+            example_parameter_sweep();
+            break;
+
+        case 12:
+            example_cusum_appx_benchmark();
+            break;
+
+        case 13:
+            example_complex_packing_benchmark();
+            break;
+
+        case 14:
+            example_tiled_layout_check();
+            break;
+
         case 0:
             return 0;
         }
+
+        // The example selected by the run configuration is run once
+        if (runConfig.exampleSelection != 0)
+        {
+            return 0;
+        }
     }
 
     return 0;
@@ -34,6 +34,20 @@ void example_serialization();
 
 void example_performance_test();
 
+void example_cleartext_cusum();
+
+void example_diagonal_benchmark();
+
+void example_soak_benchmark();
+
+void example_parameter_sweep();
+
+void example_cusum_appx_benchmark();
+
+void example_complex_packing_benchmark();
+
+void example_tiled_layout_check();
+
 /*
 Helper function: Prints the name of the example in a fancy banner.
 */
@@ -0,0 +1,364 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the lean result extraction of the online loop
+						  Note that the CKKS decoding cannot be restricted to a subset of the slots (i.e., the inverse transform covers every slot),
+						  thus, a result is decoded once into a reused buffer and only the slots i * N are gathered and assigned.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "extractionPLCP.h"       // The class containing the lean result extraction of the online loop
+#include "resultsWriterPLCP.h"    // The class containing the asynchronous structured results writer of the online loop (i.e., the log level)
+#include "plcpOperations.h"       // The class containing the functions which does Ciphertext-Ciphertext and Plaintext-Ciphertext arithmetic and algebraic operations
+
+/* Import the important selected C libraries*/
+#include <cmath>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* The active extractor used by the online loop */
+struct extractorPLCP *activeExtractorPLCP = NULL;
+
+/*
+	The function for decrypting a result into the given buffers and gathering its row entries
+*/
+static double * decryptGatherIntoPLCP(struct extractorPLCP *ex, Ciphertext *res_CP, Plaintext *plainBuf, vector<double> *decodeBuf, double *gatherBuf){
+	ex->decryptorPtr->decrypt(*res_CP, *plainBuf);
+	ex->encoderPtr->decode(*plainBuf, *decodeBuf);
+	for(int i = 0; i < ex->numRows; i++)
+		gatherBuf[i] = decodeBuf->at(ex->indexMap[i]);
+	return gatherBuf;
+}
+
+/*
+	The function for dividing the gathered entries of a target by the scale its results carry 
+*/
+static void unscaleGatheredPLCP(struct extractorPLCP *ex, double *Res_Ind, int numOfRows, enum resultTargetPLCP target){
+	double targetScale = ex->targetScale[target];
+	if(targetScale == 1)
+		return;
+	for(int i = 0; i < numOfRows; i++)
+		Res_Ind[i] /= targetScale;
+}
+
+/*
+	The function for running the queued reports on the worker thread
+*/
+static void runExtractorWorkerPLCP(struct extractorPLCP *ex){
+	while(true){
+		// Wait for a job (or the stop request after the queue is emptied)
+		unique_lock<mutex> guard(*ex->lock);
+		ex->jobReady->wait(guard, [ex]{ return ex->queueHead != ex->queueTail || ex->isStopping; });
+		if(ex->queueHead == ex->queueTail)
+			return;
+		struct extractionJobPLCP *job = &ex->jobs[ex->queueTail % ex->queueCapacity];
+		guard.unlock();
+
+		// Decrypt, gather and assign the result (the job slot is not reused before the tail is advanced)
+		double *Res_Ind = decryptGatherIntoPLCP(ex, job->cipher, ex->workerPlainBuf, ex->workerDecodeBuf, ex->workerGatherBuf);
+		unscaleGatheredPLCP(ex, Res_Ind, job->numRows, job->target);
+		assignExpResTargetRows(ex->smd, Res_Ind, job->numIter, job->rowOffset, job->numRows, job->target, false);
+
+		// Free the job slot
+		guard.lock();
+		ex->queueTail++;
+		guard.unlock();
+		ex->slotFree->notify_one();
+	}
+}
+
+/*
+	The function for creating an extractor gathering the given number of rows at the given stride
+*/
+void create_ExtractorPLCP(struct extractorPLCP *ex, struct simulationMatrixData *smd, int numRows, int N, bool isReportEnabled, bool isAsync, size_t queueCapacity, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr){
+	ex->numRows  	  = numRows;
+	ex->N 			  = N;
+	ex->smd 		  = smd;
+	ex->decryptorPtr  = decryptorPtr;
+	ex->encoderPtr 	  = encoderPtr;
+
+	// Precompute the gathered slots
+	ex->indexMap = (size_t *) calloc(numRows, sizeof(size_t));
+	for(int i = 0; i < numRows; i++)
+		ex->indexMap[i] = (size_t) i * N;
+
+	// Buffers of the caller thread
+	ex->plainBuf  = new Plaintext();
+	ex->decodeBuf = new vector<double>();
+	ex->gatherBuf = (double *) calloc(numRows, sizeof(double));
+
+	// Reporting (the worker is only started in the asynchronous mode)
+	ex->isReportEnabled = isReportEnabled;
+	ex->isAsync 		= isAsync && isReportEnabled && queueCapacity > 0;
+	ex->queueCapacity 	= ex->isAsync ? queueCapacity : 0;
+	ex->queueHead 		= 0;
+	ex->queueTail 		= 0;
+	ex->isStopping 		= false;
+	for(int t = 0; t < RESULT_TARGET_UNKNOWN; t++)
+		ex->targetScale[t] = 1;
+	ex->contextPtr 		= NULL;
+	ex->evaluatorPtr 	= NULL;
+	ex->downlinkScale 	= 1;
+	ex->downlinkBuf 	= new Ciphertext();
+	ex->jobs 			= NULL;
+	ex->lock 			= NULL;
+	ex->jobReady 		= NULL;
+	ex->slotFree 		= NULL;
+	ex->worker 			= NULL;
+	ex->workerPlainBuf 	= NULL;
+	ex->workerDecodeBuf = NULL;
+	ex->workerGatherBuf = NULL;
+	if(ex->isAsync){
+		ex->jobs = (struct extractionJobPLCP *) calloc(queueCapacity, sizeof(struct extractionJobPLCP));
+		for(size_t j = 0; j < queueCapacity; j++)
+			ex->jobs[j].cipher = new Ciphertext();
+		ex->lock 			= new mutex();
+		ex->jobReady 		= new condition_variable();
+		ex->slotFree 		= new condition_variable();
+		ex->workerPlainBuf 	= new Plaintext();
+		ex->workerDecodeBuf = new vector<double>();
+		ex->workerGatherBuf = (double *) calloc(numRows, sizeof(double));
+		ex->worker 			= new thread(runExtractorWorkerPLCP, ex);
+	}
+
+	// Statistics
+	ex->numDecryptions  = 0;
+	ex->numAsyncReports = 0;
+	ex->numQueueWaits 	= 0;
+}
+
+/*
+	The function for waiting until the worker finished the queued reports
+*/
+void drainExtractorPLCP(struct extractorPLCP *ex){
+	if(!ex->isAsync)
+		return;
+	unique_lock<mutex> guard(*ex->lock);
+	ex->slotFree->wait(guard, [ex]{ return ex->queueHead == ex->queueTail; });
+}
+
+/*
+	The function for finishing the queued reports and freeing the buffers of an extractor
+*/
+void free_ExtractorPLCP(struct extractorPLCP *ex){
+	if(ex->isAsync){
+		// Stop the worker after the queued reports
+		{
+			lock_guard<mutex> guard(*ex->lock);
+			ex->isStopping = true;
+		}
+		ex->jobReady->notify_one();
+		ex->worker->join();
+		delete ex->worker;
+		for(size_t j = 0; j < ex->queueCapacity; j++)
+			delete ex->jobs[j].cipher;
+		free(ex->jobs);
+		delete ex->lock;
+		delete ex->jobReady;
+		delete ex->slotFree;
+		delete ex->workerPlainBuf;
+		delete ex->workerDecodeBuf;
+		free(ex->workerGatherBuf);
+	}
+	delete ex->plainBuf;
+	delete ex->decodeBuf;
+	delete ex->downlinkBuf;
+	free(ex->gatherBuf);
+	free(ex->indexMap);
+}
+
+/*
+	The function for decrypting a result once and gathering its row entries (the returned buffer is reused by the next call)
+*/
+double * decryptGatherPLCP(struct extractorPLCP *ex, Ciphertext *res_CP){
+	ex->numDecryptions++;
+	return decryptGatherIntoPLCP(ex, res_CP, ex->plainBuf, ex->decodeBuf, ex->gatherBuf);
+}
+
+/*
+	The function for reporting the gathered entries of a result into the rows [rowOffset, rowOffset + numOfRows) of the given result vector (synchronous or queued to the worker)
+*/
+static void reportResultRowsPLCP(struct extractorPLCP *ex, Ciphertext *res_CP, enum resultTargetPLCP target, int numIter, int rowOffset, int numOfRows){
+
+	// Mod-switch the result to its lowest level (on the caller thread, the evaluator is not shared with the worker)
+	if(ex->evaluatorPtr != NULL){
+		modSwitchDownlinkPLCP(ex->downlinkBuf, res_CP, false, ex->downlinkScale, ex->contextPtr, ex->evaluatorPtr);
+		res_CP = ex->downlinkBuf;
+	}
+
+	// Decrypt and assign the result on the caller thread (as extractExpRes)
+	if(!ex->isAsync){
+		if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+			cout << "Iteration: " << numIter << endl;
+		double *Res_Ind = decryptGatherPLCP(ex, res_CP);
+		unscaleGatheredPLCP(ex, Res_Ind, numOfRows, target);
+		assignExpResTargetRows(ex->smd, Res_Ind, numIter, rowOffset, numOfRows, target, true);
+		return;
+	}
+
+	// Wait for a free job slot (only the caller advances the head, thus, the slot is owned after the wait)
+	unique_lock<mutex> guard(*ex->lock);
+	if(ex->queueHead - ex->queueTail == ex->queueCapacity){
+		ex->numQueueWaits++;
+		ex->slotFree->wait(guard, [ex]{ return ex->queueHead - ex->queueTail < ex->queueCapacity; });
+	}
+	struct extractionJobPLCP *job = &ex->jobs[ex->queueHead % ex->queueCapacity];
+	guard.unlock();
+
+	// Copy the result into the slot (the allocation of the slot is reused) and queue it
+	*job->cipher  = *res_CP;
+	job->target   = target;
+	job->numIter  = numIter;
+	job->rowOffset = rowOffset;
+	job->numRows  = numOfRows;
+	guard.lock();
+	ex->queueHead++;
+	ex->numAsyncReports++;
+	guard.unlock();
+	ex->jobReady->notify_one();
+}
+
+/*
+	The function for reporting a result into the given result vector (skipped, synchronous or queued to the worker)
+*/
+void reportResultPLCP(struct extractorPLCP *ex, Ciphertext *res_CP, enum resultTargetPLCP target, int numIter){
+
+	// Skip the reporting-only decryption
+	if(!ex->isReportEnabled)
+		return;
+	reportResultRowsPLCP(ex, res_CP, target, numIter, 0, (target == RESULT_TARGET_U) ? ex->smd->m : ex->numRows);
+}
+
+/*
+	The function for reporting the row tiles of a result in the tiled MRP format (each row tile is gathered as a single MRP result into its rows of the result vector)
+	Note: The extractor gathers the rows of a single row tile (i.e., numRows is at most rowsPerTile)
+*/
+void reportTiledResultPLCP(struct extractorPLCP *ex, vector<Ciphertext> *resRowTiles_CP, int rowsPerTile, int numOfRows, enum resultTargetPLCP target, int numIter){
+
+	// Skip the reporting-only decryptions
+	if(!ex->isReportEnabled)
+		return;
+	for(size_t r = 0; r < resRowTiles_CP->size(); r++){
+		int rowOffset  = (int) r * rowsPerTile;
+		int rowsInTile = min(rowsPerTile, numOfRows - rowOffset);
+		if(rowsInTile <= 0)
+			break;
+		reportResultRowsPLCP(ex, &resRowTiles_CP->at(r), target, numIter, rowOffset, min(rowsInTile, ex->numRows));
+	}
+}
+
+/*
+	The function for assigning the scale carried by the results of a target (the gathered entries are divided by it)
+*/
+void setExtractorTargetScalePLCP(struct extractorPLCP *ex, enum resultTargetPLCP target, double scale){
+	if(target < RESULT_TARGET_UNKNOWN && scale != 0)
+		ex->targetScale[target] = scale;
+}
+
+/*
+	The function for mod-switching the reported results to their lowest level before the decryption (i.e., the downlink of the reports)
+*/
+void setExtractorDownlinkPLCP(struct extractorPLCP *ex, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr){
+	ex->contextPtr 	  = contextPtr;
+	ex->evaluatorPtr  = evaluatorPtr;
+	ex->downlinkScale = scale;
+}
+
+/*
+	The function for converting a result vector name (e.g., "y", "alarm") into the target
+*/
+enum resultTargetPLCP resultTargetFromName(const char *matname){
+	if(strcmp(matname, "xe") == 0)
+		return RESULT_TARGET_XE;
+	if(strcmp(matname, "u") == 0)
+		return RESULT_TARGET_U;
+	if(strcmp(matname, "xp") == 0)
+		return RESULT_TARGET_XP;
+	if(strcmp(matname, "residue") == 0)
+		return RESULT_TARGET_RESIDUE;
+	if(strcmp(matname, "sBar") == 0)
+		return RESULT_TARGET_SBAR;
+	if(strcmp(matname, "indInp") == 0)
+		return RESULT_TARGET_INDINP;
+	if(strcmp(matname, "s") == 0)
+		return RESULT_TARGET_S;
+	if(strcmp(matname, "x") == 0)
+		return RESULT_TARGET_X;
+	if(strcmp(matname, "y") == 0)
+		return RESULT_TARGET_Y;
+	if(strcmp(matname, "alarm") == 0)
+		return RESULT_TARGET_ALARM;
+	return RESULT_TARGET_UNKNOWN;
+}
+
+/*
+	The function for assigning the gathered row entries to the given result vector
+*/
+void assignExpResTarget(struct simulationMatrixData *smd, double *Res_Ind, int numIter, int numOfRows, enum resultTargetPLCP target, bool isPrinted){
+	assignExpResTargetRows(smd, Res_Ind, numIter, 0, numOfRows, target, isPrinted);
+}
+
+/*
+	The function for assigning the gathered row entries to the rows [rowOffset, rowOffset + numOfRows) of the given result vector
+*/
+void assignExpResTargetRows(struct simulationMatrixData *smd, double *Res_Ind, int numIter, int rowOffset, int numOfRows, enum resultTargetPLCP target, bool isPrinted){
+
+	// Select the result row once (the alarm is rounded and thresholded as in the CUSUM reset)
+	double *resRow = NULL;
+	switch(target){
+		case RESULT_TARGET_XE: 		resRow = smd->xe_Res[numIter]; 	break;
+		case RESULT_TARGET_U: 		resRow = smd->u_Res[numIter]; 		break;
+		case RESULT_TARGET_XP: 		resRow = smd->xp_Res[numIter]; 	break;
+		case RESULT_TARGET_RESIDUE: resRow = smd->residue_Res[numIter]; break;
+		case RESULT_TARGET_SBAR: 	resRow = smd->sBar_Res[numIter]; 	break;
+		case RESULT_TARGET_INDINP: 	resRow = smd->indInp_Res[numIter]; break;
+		case RESULT_TARGET_S: 		resRow = smd->s_Res[numIter]; 		break;
+		case RESULT_TARGET_X: 		resRow = smd->x_Res[numIter]; 		break;
+		case RESULT_TARGET_Y: 		resRow = smd->y_Res[numIter]; 		break;
+		case RESULT_TARGET_ALARM: 	resRow = smd->alarm_Res[numIter]; 	break;
+		default: 					break;
+	}
+	if(resRow != NULL)
+		resRow += rowOffset;
+	if(target == RESULT_TARGET_ALARM){
+		for(int i = 0; i < numOfRows; i++)
+			resRow[i] = (round(Res_Ind[i]) > 0.4) ? 1 : 0;
+	}else if(resRow != NULL){
+		for(int i = 0; i < numOfRows; i++)
+			resRow[i] = Res_Ind[i];
+	}
+
+	// Print the assigned entries (only at the verbose log level)
+	if(!isPrinted || !isLoggedPLCP(LOG_LEVEL_VERBOSE))
+		return;
+	for(int i = 0; i < numOfRows; i++){
+		if(target == RESULT_TARGET_ALARM)
+			printf("%f ", resRow[i]);
+		else
+			printf("%.11f ", Res_Ind[i]);
+	}
+	printf("\n");
+}
+
+/*
+	The function for printing the usage of an extractor
+*/
+void printExtractorPLCP(struct extractorPLCP *ex){
+	printf("Result Extraction: Reporting %s, Decryptions %zu, Async Reports %zu (Queue Waits %zu)\n",
+		!ex->isReportEnabled ? "Off" : (ex->isAsync ? "Async" : "Sync"), ex->numDecryptions, ex->numAsyncReports, ex->numQueueWaits);
+}
@@ -0,0 +1,131 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the lean result extraction of the online loop (i.e., extractionPLCP.cpp)
+						  A result ciphertext is decrypted once, decoded into a reused buffer, and its row entries (i.e., the slots i * N) are
+						  gathered with a precomputed index map. The reporting targets are selected by an enum, and the reporting-only
+						  decryptions can be disabled or handed to a background worker, so that they leave the critical path.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+#ifndef EXTRACTIONPLCP_H
+#define EXTRACTIONPLCP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+
+/* Import the important selected C libraries*/
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* The reported result vectors (i.e., the result matrices of simulationMatrixData) */
+enum resultTargetPLCP {
+	RESULT_TARGET_XE,
+	RESULT_TARGET_U,
+	RESULT_TARGET_XP,
+	RESULT_TARGET_RESIDUE,
+	RESULT_TARGET_SBAR,
+	RESULT_TARGET_INDINP,
+	RESULT_TARGET_S,
+	RESULT_TARGET_X,
+	RESULT_TARGET_Y,
+	RESULT_TARGET_ALARM,
+	RESULT_TARGET_UNKNOWN
+};
+
+/* Struct for holding a queued reporting job (the ciphertext is a copy, since the loop keeps updating its own) */
+struct extractionJobPLCP {
+	Ciphertext * cipher;             // Preallocated copy of the result ciphertext
+	enum resultTargetPLCP target;    // The reported result vector
+	int numIter;                     // The row of the result vector
+	int rowOffset;                   // The first assigned entry of the row (i.e., the first row of a row tile)
+	int numRows;                     // Number of the assigned entries
+};
+
+/* Main struct for holding the reused decryption buffers, the index map and the reporting worker */
+struct extractorPLCP {
+	int numRows;                     // Number of the gathered rows (i.e., the number of states n)
+	int N;                           // The row segment size of the MRP layout (i.e., the stride of the gathered slots)
+	size_t * indexMap;               // The slot index of each row [numRows] (i.e., i * N)
+	struct simulationMatrixData * smd; // The struct holding the result matrices
+	Decryptor * decryptorPtr;
+	CKKSEncoder * encoderPtr;
+	// Buffers of the caller thread
+	Plaintext * plainBuf;            // Decrypted result
+	vector<double> * decodeBuf;      // Decoded slots (the capacity is kept between the decodes)
+	double * gatherBuf;              // Gathered row entries [numRows]
+	// Reporting
+	bool isReportEnabled;            // false: the reporting-only decryptions are skipped
+	bool isAsync;                    // true: the reporting-only decryptions run on the worker
+	double targetScale[RESULT_TARGET_UNKNOWN]; // The scale carried by each reported result vector (e.g., the folded range transformation), divided out before the assignment
+	// Downlink (the reported results are mod-switched to their lowest level on the caller thread, NULL evaluator: decrypted at their level)
+	SEALContext * contextPtr;
+	Evaluator * evaluatorPtr;
+	double downlinkScale;
+	Ciphertext * downlinkBuf;
+	struct extractionJobPLCP * jobs; // The job ring [queueCapacity]
+	size_t queueCapacity;
+	size_t queueHead, queueTail;     // Number of the queued and the finished jobs (guarded by the lock)
+	bool isStopping;
+	mutex * lock;
+	condition_variable * jobReady, * slotFree;
+	thread * worker;
+	Plaintext * workerPlainBuf;      // Buffers of the worker thread
+	vector<double> * workerDecodeBuf;
+	double * workerGatherBuf;
+	// Statistics
+	size_t numDecryptions;           // Number of the decryptions on the caller thread
+	size_t numAsyncReports;          // Number of the reports handed to the worker
+	size_t numQueueWaits;            // Number of the reports which waited for a free job slot
+};
+
+/* The active extractor used by extractExpRes, applyXVecNoiseAddition and applyEquation_10_PLCP (NULL: the full decode path is used) */
+extern struct extractorPLCP *activeExtractorPLCP;
+
+/* The function for creating an extractor gathering the given number of rows at the given stride */
+void create_ExtractorPLCP(struct extractorPLCP *ex, struct simulationMatrixData *smd, int numRows, int N, bool isReportEnabled, bool isAsync, size_t queueCapacity, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr);
+
+/* The function for finishing the queued reports and freeing the buffers of an extractor */
+void free_ExtractorPLCP(struct extractorPLCP *ex);
+
+/* The function for decrypting a result once and gathering its row entries (the returned buffer is reused by the next call) */
+double * decryptGatherPLCP(struct extractorPLCP *ex, Ciphertext *res_CP);
+
+/* The function for reporting a result into the given result vector (skipped, synchronous or queued to the worker) */
+void reportResultPLCP(struct extractorPLCP *ex, Ciphertext *res_CP, enum resultTargetPLCP target, int numIter);
+
+/* The function for reporting the row tiles of a result in the tiled MRP format (each row tile is gathered as a single MRP result into its rows of the result vector) */
+void reportTiledResultPLCP(struct extractorPLCP *ex, vector<Ciphertext> *resRowTiles_CP, int rowsPerTile, int numOfRows, enum resultTargetPLCP target, int numIter);
+
+/* The function for assigning the scale carried by the results of a target (the gathered entries are divided by it) */
+void setExtractorTargetScalePLCP(struct extractorPLCP *ex, enum resultTargetPLCP target, double scale);
+
+/* The function for mod-switching the reported results to their lowest level before the decryption (i.e., the downlink of the reports) */
+void setExtractorDownlinkPLCP(struct extractorPLCP *ex, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr);
+
+/* The function for waiting until the worker finished the queued reports */
+void drainExtractorPLCP(struct extractorPLCP *ex);
+
+/* The function for converting a result vector name (e.g., "y", "alarm") into the target */
+enum resultTargetPLCP resultTargetFromName(const char *matname);
+
+/* The function for assigning the gathered row entries to the given result vector */
+void assignExpResTarget(struct simulationMatrixData *smd, double *Res_Ind, int numIter, int numOfRows, enum resultTargetPLCP target, bool isPrinted);
+
+/* The function for assigning the gathered row entries to the rows [rowOffset, rowOffset + numOfRows) of the given result vector */
+void assignExpResTargetRows(struct simulationMatrixData *smd, double *Res_Ind, int numIter, int rowOffset, int numOfRows, enum resultTargetPLCP target, bool isPrinted);
+
+/* The function for printing the usage of an extractor */
+void printExtractorPLCP(struct extractorPLCP *ex);
+
+#endif
@@ -39,7 +39,7 @@ using namespace seal;
 /*
 	Function for generating the s vector in MRP for the homomorphic addition (i.e., s vector)  	
 */
-void genVecAddOperMRP_RPL(std::vector<double> *x_add_vector, struct simulationMatrixData *smd, size_t x_vector_row_size, size_t x_vector_repeat, size_t calculated_x_row_sizeVal, char *matname){
+void genVecAddOperMRP_RPL(std::vector<double> *x_add_vector, struct simulationMatrixData *smd, size_t x_vector_row_size, size_t x_vector_repeat, size_t calculated_x_row_sizeVal, const char *matname){
 	
 	// Read and fill the entries (ending with trailing zeros)
 	for (size_t i = 0; i < calculated_x_row_sizeVal * x_vector_repeat; i++){
@@ -57,7 +57,7 @@ void genVecAddOperMRP_RPL(std::vector<double> *x_add_vector, struct simulationMa
 /*
 	The function for generating the x vector of generic Ax multiplication in MRP (i.e., x^e, y, uGamma vectors)
 */
-void genRepXVecMRP_RPL(std::vector<double> *x_vector, struct simulationMatrixData *smd, size_t x_vector_col_size, size_t x_vector_repeat, size_t calculated_x_row_sizeVal, char *matname, bool isPrinted){
+void genRepXVecMRP_RPL(std::vector<double> *x_vector, struct simulationMatrixData *smd, size_t x_vector_col_size, size_t x_vector_repeat, size_t calculated_x_row_sizeVal, const char *matname, bool isPrinted){
 		
 	// Read the x vector (of the generic Ax multiplication) content into the first n indices based on the selected vector name
 	for (size_t i = 0; i < x_vector_col_size; i++){
@@ -86,7 +86,7 @@ void genRepXVecMRP_RPL(std::vector<double> *x_vector, struct simulationMatrixDat
 /*
 	The function for generating the y vector (representing the sensor measurement) as the x vector of generic Ax multiplication in MRP (i.e., y vector)
 */
-void genRepXVecMRP_RPL_v0(std::vector<double> *x_vector, double ** yy, size_t x_vector_col_size, size_t x_vector_repeat, size_t calculated_x_row_sizeVal, char *matname, bool isPrinted){
+void genRepXVecMRP_RPL_v0(std::vector<double> *x_vector, double ** yy, size_t x_vector_col_size, size_t x_vector_repeat, size_t calculated_x_row_sizeVal, const char *matname, bool isPrinted){
 		
 	// Read the entries of y vector
 	for (size_t i = 0; i < x_vector_col_size; i++)
@@ -109,7 +109,7 @@ void genRepXVecMRP_RPL_v0(std::vector<double> *x_vector, double ** yy, size_t x_
 	The function for generating the matrices vector as the A matrix of generic Ax multiplication in MRP (i.e., Gamma, L, ACL, B matrices)
 	Important note: This packing function is valid for n * n, n * m  matrices where m < n (e.g., m = 2, n = 10) 
 */
-void genMatMRP_RPL(std::vector<double> *matPtr, struct simulationMatrixData *smd, size_t mat_row_size, size_t mat_col_size, size_t calculated_x_row_sizeVal, char *matname, bool isPrinted) {
+void genMatMRP_RPL(std::vector<double> *matPtr, struct simulationMatrixData *smd, size_t mat_row_size, size_t mat_col_size, size_t calculated_x_row_sizeVal, const char *matname, bool isPrinted) {
 
 	// Read and fill the entries (ending with trailing zeros)
 	for (size_t i = 0; i < mat_row_size; i++){
@@ -139,12 +139,12 @@ void genMatMRP_RPL(std::vector<double> *matPtr, struct simulationMatrixData *smd
 	The function for generating the matrices vector as the A matrix of generic Ax multiplication in MRP (i.e., KGamma, KL, KMinus)
 	Important note: This packing function is valid for m * n matrices where m < n (e.g., m = 2, n = 10)  
 */
-void genMatforMtimesNMRP_RPL(std::vector<double> *matPtr, struct simulationMatrixData *smd, size_t numCol, size_t numRow, size_t calculated_x_row_sizeVal, char *matname, bool isPrinted) {
+void genMatforMtimesNMRP_RPL(std::vector<double> *matPtr, struct simulationMatrixData *smd, size_t numCol, size_t numRow, size_t calculated_x_row_sizeVal, const char *matname, bool isPrinted) {
 	
-	// Read and fill the entries (ending with trailing zeros)  
-	for (size_t i = 0; i < numCol; i++){
+	// Read and fill the entries (ending with trailing zeros), only the m row segments are packed (i.e., the vector holds numRow * N entries)  
+	for (size_t i = 0; i < numRow; i++){
 		for (size_t j = 0; j < calculated_x_row_sizeVal; j++){
-			if(i < numRow && j < numCol){ // Read the entries of the selected matrices for the number of rows times  
+			if(j < numCol){ // Read the entries of the selected matrices for the number of rows times  
 				if(strcmp(matname, "KG") == 0)
 					matPtr->at(i * calculated_x_row_sizeVal + j) = smd->KGKG[i][j];
 				if(strcmp(matname, "KL") == 0)
@@ -159,13 +159,13 @@ void genMatforMtimesNMRP_RPL(std::vector<double> *matPtr, struct simulationMatri
 
 	// If there is a request for vector content checking, print the vector content 	
 	if(isPrinted)
-		printMatrix(matPtr, numCol, calculated_x_row_sizeVal, matname);	
+		printMatrix(matPtr, numRow, calculated_x_row_sizeVal, matname);	
 }
 
 /*
 	Function for generating the xGamma vector in MRP for homomorphic addition (i.e., xGamma vector)  	
 */
-void genXVecAddOperMRP_RPL(std::vector<double> *x_add_vector, struct simulationMatrixData *smd,  size_t x_vector_row_size, size_t x_vector_repeat, size_t calculated_x_row_sizeVal, char *matname, bool isPrinted){
+void genXVecAddOperMRP_RPL(std::vector<double> *x_add_vector, struct simulationMatrixData *smd,  size_t x_vector_row_size, size_t x_vector_repeat, size_t calculated_x_row_sizeVal, const char *matname, bool isPrinted){
 
 	// Read and fill the entries (ending with trailing zeros)		
 	for(size_t i = 0; i < calculated_x_row_sizeVal * x_vector_repeat; i++){
@@ -187,7 +187,7 @@ void genXVecAddOperMRP_RPL(std::vector<double> *x_add_vector, struct simulationM
 /*
 	Function for generating the vectors in MRP for homomorphic addition (i.e., KxuG, uG, Kx vectors)  	
 */
-void genUVecAddOperMRP_RPL(std::vector<double> *u_add_vector, struct simulationMatrixData *smd, size_t numRow, size_t u_vector_repeat, size_t calculated_u_row_sizeVal, char *matname, bool isPrinted){
+void genUVecAddOperMRP_RPL(std::vector<double> *u_add_vector, struct simulationMatrixData *smd, size_t numRow, size_t u_vector_repeat, size_t calculated_u_row_sizeVal, const char *matname, bool isPrinted){
 
 	// Read and fill the entries (ending with trailing zeros)
 	for (size_t i = 0; i < calculated_u_row_sizeVal * u_vector_repeat; i++){
@@ -220,7 +220,7 @@ void genUVecAddOperMRP_RPL(std::vector<double> *u_add_vector, struct simulationM
 /*
 	Function for generating the vectors in MRP for homomorphic addition (i.e., y, xp, s, v, tau, one, Chebyshev vectors)  	
 */
-void genYVecAddOperMRP_RPL(std::vector<double> *y_add_vector, struct simulationMatrixData *smd, size_t numIter, size_t y_vector_row_size, size_t y_vector_repeat, size_t calculated_y_row_sizeVal, char *matname, bool isPrinted){
+void genYVecAddOperMRP_RPL(std::vector<double> *y_add_vector, struct simulationMatrixData *smd, size_t numIter, size_t y_vector_row_size, size_t y_vector_repeat, size_t calculated_y_row_sizeVal, const char *matname, bool isPrinted){
 	
 	// Read and fill the entries (ending with trailing zeros)	
 	for(size_t i = 0; i < calculated_y_row_sizeVal * y_vector_repeat; i++){
@@ -268,7 +268,7 @@ void genYVecAddOperMRP_RPL(std::vector<double> *y_add_vector, struct simulationM
 /*
 	Function for generating the y vector in MRP for homomorphic addition (i.e., y vector)  	
 */
-void genYVecAddOperMRP_RPL_v0(std::vector<double> *y_add_vector, double ** yy, size_t y_vector_row_size, size_t y_vector_repeat, size_t calculated_y_row_sizeVal, char *matname, bool isPrinted){
+void genYVecAddOperMRP_RPL_v0(std::vector<double> *y_add_vector, double ** yy, size_t y_vector_row_size, size_t y_vector_repeat, size_t calculated_y_row_sizeVal, const char *matname, bool isPrinted){
 
 	// Read and fill the entries (ending with trailing zeros)	
 	for(size_t i = 0; i < calculated_y_row_sizeVal * y_vector_repeat; i++){
@@ -317,6 +317,61 @@ void genRangTransfVecChebApprx(std::vector<double> * Alpha_vector, std::vector<d
 
 }
 
+/*
+	The function for counting the row segments of a matrix in MRP which contain at least one non-zero entry
+	Note: Only reported, the zero row segments of a single ciphertext still take part in its SIMD products
+*/
+int countNonZeroRowSegments(std::vector<double> *matPtr, size_t mat_row_size, size_t calculated_x_row_sizeVal){
+
+	int numNonZeroRowSegments = 0;
+	for (size_t i = 0; i < mat_row_size; i++){
+		for (size_t j = 0; j < calculated_x_row_sizeVal; j++){
+			if(matPtr->at(i * calculated_x_row_sizeVal + j) != 0){
+				numNonZeroRowSegments++;
+				break;
+			}
+		}
+	}
+	return numNonZeroRowSegments;
+}
+
+/*
+	The function for calculating the width of the non-zero part of the row segments of a matrix in MRP (rounded up to a binary power)
+	Note: The rotate-and-sum of a matrix-vector product only needs log2(width) rotations instead of log2(N), since the trailing entries of each row segment are zero
+*/
+int calculateNonZeroRowSegmentWidth(std::vector<double> *matPtr, size_t mat_row_size, size_t calculated_x_row_sizeVal){
+
+	// Find the last non-zero column over all row segments
+	size_t lastNonZeroCol = 0;
+	for (size_t i = 0; i < mat_row_size; i++)
+		for (size_t j = lastNonZeroCol; j < calculated_x_row_sizeVal; j++)
+			if(matPtr->at(i * calculated_x_row_sizeVal + j) != 0)
+				lastNonZeroCol = j;
+
+	// Round the width up to a binary power
+	int nonZeroWidth = 1;
+	while(nonZeroWidth < (int) (lastNonZeroCol + 1))
+		nonZeroWidth = nonZeroWidth * 2;
+	return nonZeroWidth;
+}
+
+/*
+	The function for generating the masks of the homomorphic replication of a rotated and summed vector into the repeated MRP format
+	Note: The row start mask keeps the indices i * N (i.e., the rotate-and-sum results), and the diagonal mask keeps the indices i * N + i (i < n)
+*/
+void genReplicationMasksMRP_RPL(std::vector<double> *rowStartMask, std::vector<double> *diagMask, size_t x_vector_col_size, size_t calculated_x_row_sizeVal, size_t slotCount){
+
+	// Fill the masks with zeros over all slots
+	rowStartMask->assign(slotCount, 0);
+	diagMask->assign(slotCount, 0);
+
+	// Set the row start and the diagonal indices of the first n row segments
+	for (size_t i = 0; i < x_vector_col_size; i++){
+		rowStartMask->at(i * calculated_x_row_sizeVal) 	= 1;
+		diagMask->at(i * calculated_x_row_sizeVal + i) 	= 1;
+	}
+}
+
 /* 
 // Exemplary Column and Row Dimensions of the simulation matrices and vectors when m = 2, n = 10
 
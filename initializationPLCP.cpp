@@ -17,7 +17,10 @@
 #include "applyPLCPSimulation.h"  // 5   - The class containing the crypto application functions for each targeted equation       
 
 /* Import the important selected C libraries */
+#include <atomic>
 #include <iostream>
+#include <thread>
+#include <vector>
 #include <float.h>
 #include <limits.h>
 #include <math.h>
@@ -104,6 +107,50 @@ void encryptXVectorMatRowPacking(vector<double> *x_vector,
 		encryptorPtr->encrypt(plain_x, *x_vector_EncPtr);
 }
 
+/*
+ 	The function for encrypting a vector into Ciphertext directly at the given level (parms_id_zero: the top of the modulus chain)
+	Note: The ciphertext only carries the primes of its level, thus, both the encryption and the uplink ciphertext are smaller
+*/
+void encryptXVectorAtLevelMatRowPacking(vector<double> *x_vector,
+										double scale, 
+										parms_id_type parmsId,
+										Ciphertext *x_vector_EncPtr, 					   
+										Encryptor *encryptorPtr, 
+										CKKSEncoder *encoderPtr){
+		if(parmsId == parms_id_zero){
+			encryptXVectorMatRowPacking(x_vector, scale, x_vector_EncPtr, encryptorPtr, encoderPtr);
+			return;
+		}
+		Plaintext plain_x;
+		encoderPtr->encode(*x_vector, parmsId, scale, plain_x);
+		encryptorPtr->encrypt(plain_x, *x_vector_EncPtr);
+}
+
+/*
+ 	The function for obtaining the parms_id of the level numLevels below the given level (the last level if the chain ends)
+*/
+parms_id_type parmsIdBelowPLCP(SEALContext *contextPtr, parms_id_type parmsId, int numLevels){
+	auto contextData = contextPtr->get_context_data(parmsId);
+	for(int l = 0; l < numLevels && contextData->next_context_data(); l++)
+		contextData = contextData->next_context_data();
+	return contextData->parms_id();
+}
+
+/*
+ 	The function for obtaining the (uncompressed) byte size of a ciphertext, i.e., the bytes sent between the parties
+*/
+size_t ciphertextBytesPLCP(Ciphertext *cipherPtr){
+	return cipherPtr->size() * cipherPtr->poly_modulus_degree() * cipherPtr->coeff_modulus_size() * sizeof(uint64_t);
+}
+
+/*
+ 	The function for obtaining the (uncompressed) byte size of a ciphertext at the top of the modulus chain
+*/
+size_t topLevelCiphertextBytesPLCP(SEALContext *contextPtr, Ciphertext *cipherPtr){
+	size_t topCoeffModulusSize = contextPtr->first_context_data()->parms().coeff_modulus().size();
+	return cipherPtr->size() * cipherPtr->poly_modulus_degree() * topCoeffModulusSize * sizeof(uint64_t);
+}
+
 /*
  	The function for encrypting a matrix into Ciphertext 
 */
@@ -116,3 +163,99 @@ void encryptMatrixMatRowPacking(vector<double> *matPtr,
 	encoderPtr->encode(*matPtr, scale, plain_x);
 	encryptorPtr->encrypt(plain_x, *mat_EncPtr);
 }
+
+/*
+ 	The function for creating an empty encoding batch 
+*/
+void create_EncodingBatchPLCP(struct encodingBatchPLCP *batch){
+	batch->jobs = new vector<struct encodingJobPLCP>();
+}
+
+/*
+ 	The function for freeing an encoding batch (the targets are not owned by the batch) 
+*/
+void free_EncodingBatchPLCP(struct encodingBatchPLCP *batch){
+	delete batch->jobs;
+}
+
+/*
+ 	The function for adding the encoding of a vector into Plaintext to the batch 
+*/
+void addPlaintextEncodingBatch(struct encodingBatchPLCP *batch, vector<double> *x_vector, Plaintext *plain_xePtr){
+	struct encodingJobPLCP job = {ENCODING_JOB_PLAINTEXT, x_vector, 0, plain_xePtr, NULL};
+	batch->jobs->push_back(job);
+}
+
+/*
+ 	The function for adding the encryption of a vector into Ciphertext to the batch 
+*/
+void addCiphertextEncodingBatch(struct encodingBatchPLCP *batch, vector<double> *x_vector, Ciphertext *x_vector_EncPtr){
+	struct encodingJobPLCP job = {ENCODING_JOB_CIPHERTEXT, x_vector, 0, NULL, x_vector_EncPtr};
+	batch->jobs->push_back(job);
+}
+
+/*
+ 	The function for adding the power series coefficient vector in plaintext to the batch (the batch counterpart of preparePwSrCoeffVec, the coefficients are multiplied with coeffScale, e.g., the scale of the folded CUSUM sum)
+*/
+void addPwSrCoeffVecEncodingBatch(struct encodingBatchPLCP *batch, vector<Plaintext> * powerSeriesCoeffVec_PL, struct simulationMatrixData *smd, size_t chebyshevDegree, bool isMaxFunc, double coeffScale){
+	for (size_t i = 1; i < chebyshevDegree; i++){
+		double powSerCoeff = coeffScale * (isMaxFunc ? smd->eq8maxAppx_PS_Coeff_D12_y_10_u_2[i][0] : smd->eq9ISubAppx_PS_Coeff_D12_y_10_u_2[i][0]);
+		struct encodingJobPLCP job = {ENCODING_JOB_SCALAR, NULL, powSerCoeff, &powerSeriesCoeffVec_PL->at(i), NULL};
+		batch->jobs->push_back(job);
+	}
+}
+
+/*
+ 	The function for running the jobs of the batch on the worker threads and emptying the batch 
+	Note: The jobs are independent and the encoder and the encryptor are safe to share between the threads. The encryptions are taken first
+		  since they are the longest jobs, the workers then take the next unprocessed job, so that the load stays balanced.
+*/
+void runEncodingBatchPLCP(struct encodingBatchPLCP *batch, double scale, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr, int numThreads){
+
+	// Order the jobs (the encryptions first)
+	int numJobs = (int) batch->jobs->size();
+	vector<int> order;
+	order.reserve(numJobs);
+	for(int j = 0; j < numJobs; j++)
+		if(batch->jobs->at(j).kind == ENCODING_JOB_CIPHERTEXT)
+			order.push_back(j);
+	for(int j = 0; j < numJobs; j++)
+		if(batch->jobs->at(j).kind != ENCODING_JOB_CIPHERTEXT)
+			order.push_back(j);
+
+	// Run a single job
+	auto runJob = [&](int j){
+		struct encodingJobPLCP *job = &batch->jobs->at(j);
+		if(job->kind == ENCODING_JOB_PLAINTEXT)
+			makePlaintextMatRowPacking(job->source, scale, job->plainTarget, encoderPtr);
+		else if(job->kind == ENCODING_JOB_SCALAR)
+			encoderPtr->encode(job->value, scale, *job->plainTarget);
+		else
+			encryptXVectorMatRowPacking(job->source, scale, job->cipherTarget, encryptorPtr, encoderPtr);
+	};
+
+	// Do not create more workers than the jobs
+	if(numThreads < 1)
+		numThreads = 1;
+	if(numThreads > numJobs)
+		numThreads = numJobs;
+
+	// Distribute the jobs over the workers (sequential for a single worker)
+	if(numThreads <= 1){
+		for(int t = 0; t < numJobs; t++)
+			runJob(order[t]);
+	}else{
+		atomic<int> nextJob(0);
+		vector<thread> workers;
+		for(int w = 0; w < numThreads; w++){
+			workers.emplace_back([&](){
+				int t;
+				while((t = nextJob++) < numJobs)
+					runJob(order[t]);
+			});
+		}
+		for(size_t w = 0; w < workers.size(); w++)
+			workers[w].join();
+	}
+	batch->jobs->clear();
+}
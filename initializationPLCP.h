@@ -23,6 +23,7 @@
 #include <array>
 #include <cmath>
 #include <iostream>
+#include <thread>
 #include <vector>
 #include <float.h>
 #include <limits.h>
@@ -54,6 +55,27 @@ struct simulationMatrixPLCP{
 	seal:: Plaintext * xGxG_PL;  // 2nd Equation-Part3
 };
 
+/* The kinds of the offline encoding jobs */
+enum encodingJobKindPLCP {
+	ENCODING_JOB_PLAINTEXT,  // Encode an MRP vector into a Plaintext
+	ENCODING_JOB_SCALAR,     // Encode a scalar into a Plaintext (i.e., a Chebyshev power series coefficient)
+	ENCODING_JOB_CIPHERTEXT  // Encode and encrypt an MRP vector into a Ciphertext
+};
+
+/* Struct for holding an offline encoding job (the cleartext source and the target) */
+struct encodingJobPLCP {
+	enum encodingJobKindPLCP kind;
+	vector<double> * source;   // The MRP vector (not used for the scalars)
+	double value;              // The scalar (only used for the scalars)
+	Plaintext * plainTarget;   // The target of the plaintext and the scalar jobs
+	Ciphertext * cipherTarget; // The target of the ciphertext jobs
+};
+
+/* Main struct for holding a batch of the independent offline encodings and encryptions (each target is added once) */
+struct encodingBatchPLCP {
+	vector<struct encodingJobPLCP> * jobs;
+};
+
 /* The function for preparing the power series coefficient vector in plaintext */
 void preparePwSrCoeffVec(vector<Plaintext> * powerSeriesCoeffVec_PL, struct simulationMatrixData *smd, size_t chebyshevDegree, size_t calcRowSize, double scale, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, bool isMaxFunc);
 
@@ -66,7 +88,37 @@ void makePlaintextMatRowPacking(std::vector<double> *x_vector, double scale, sea
 /* The function for encrypting a vector into Ciphertext */
 void encryptXVectorMatRowPacking(vector<double> *x_vector,double scale, Ciphertext *x_vector_EncPtr, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr);
 
+/* The function for encrypting a vector into Ciphertext directly at the given level (parms_id_zero: the top of the modulus chain) */
+void encryptXVectorAtLevelMatRowPacking(vector<double> *x_vector, double scale, parms_id_type parmsId, Ciphertext *x_vector_EncPtr, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr);
+
+/* The function for obtaining the parms_id of the level numLevels below the given level (the last level if the chain ends) */
+parms_id_type parmsIdBelowPLCP(SEALContext *contextPtr, parms_id_type parmsId, int numLevels);
+
+/* The function for obtaining the (uncompressed) byte size of a ciphertext, i.e., the bytes sent between the parties */
+size_t ciphertextBytesPLCP(Ciphertext *cipherPtr);
+
+/* The function for obtaining the (uncompressed) byte size of a ciphertext at the top of the modulus chain */
+size_t topLevelCiphertextBytesPLCP(SEALContext *contextPtr, Ciphertext *cipherPtr);
+
 /* The function for encrypting a matrix into Ciphertext */
 void encryptMatrixMatRowPacking(vector<double> *matPtr, double scale, Ciphertext *mat_EncPtr, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr);
 
+/* The function for creating an empty encoding batch */
+void create_EncodingBatchPLCP(struct encodingBatchPLCP *batch);
+
+/* The function for freeing an encoding batch (the targets are not owned by the batch) */
+void free_EncodingBatchPLCP(struct encodingBatchPLCP *batch);
+
+/* The function for adding the encoding of a vector into Plaintext to the batch */
+void addPlaintextEncodingBatch(struct encodingBatchPLCP *batch, vector<double> *x_vector, Plaintext *plain_xePtr);
+
+/* The function for adding the encryption of a vector into Ciphertext to the batch */
+void addCiphertextEncodingBatch(struct encodingBatchPLCP *batch, vector<double> *x_vector, Ciphertext *x_vector_EncPtr);
+
+/* The function for adding the power series coefficient vector in plaintext to the batch (the batch counterpart of preparePwSrCoeffVec, the coefficients are multiplied with coeffScale) */
+void addPwSrCoeffVecEncodingBatch(struct encodingBatchPLCP *batch, vector<Plaintext> * powerSeriesCoeffVec_PL, struct simulationMatrixData *smd, size_t chebyshevDegree, bool isMaxFunc, double coeffScale);
+
+/* The function for running the jobs of the batch on the worker threads and emptying the batch */
+void runEncodingBatchPLCP(struct encodingBatchPLCP *batch, double scale, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr, int numThreads);
+
 #endif
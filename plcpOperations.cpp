@@ -16,6 +16,9 @@
 #include "encryptedAppx.h"        // The class containing the functions which does the Chebyshev approximation with different assumptions     
 #include "secretShare.h" 		  // The class containing the functions which does the secret sharing  
 #include "printCont.h" 			  // The class containing the printing functions for control purposes  
+#include "arenaPLCP.h"            // The class containing the reusable Ciphertext and Plaintext buffers of the online loop
+#include "constantsPLCP.h"        // The class containing the registry of the encoded constants of the online loop
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
 
 /* Import the important selected C libraries*/
 #include <iostream>
@@ -97,12 +100,12 @@ void plnCprAxMult_mrp(
 	Evaluator *evaluatorPtr,
 	RelinKeys *relin_keysPtr){
 		
-	// Adjust the scales if needed
+	// Take the copy of a registered constant at the level of the ciphertext and adjust the scales if needed
+	pln = levelConstantPLCP(pln, cpr);
 	adjustScaleandChainParametersPlaintextAndVectors(cpr, pln, scale, contextPtr, evaluatorPtr);
 
-	// Do the encrypted multiplication	
+	// Do the encrypted multiplication (a plaintext product keeps two polynomials, thus, it is not relinearized)	
 	evaluatorPtr->multiply_plain(*cpr, *pln, *res);
-	evaluatorPtr->relinearize_inplace(*res, *relin_keysPtr);
 	evaluatorPtr->rescale_to_next_inplace(*res);
 
 }
@@ -120,16 +123,38 @@ void plnCprAxMult_InPlac_mrp(
 	Evaluator *evaluatorPtr,
 	RelinKeys *relin_keysPtr){
 		
-	// Adjust the scales if needed
+	// Take the copy of a registered constant at the level of the ciphertext and adjust the scales if needed
+	pln = levelConstantPLCP(pln, res);
 	adjustScaleandChainParametersPlaintextAndVectors(res, pln, scale, contextPtr, evaluatorPtr);
 
-	// Do the encrypted multiplication	
+	// Do the encrypted multiplication (a plaintext product keeps two polynomials, thus, it is not relinearized)	
 	evaluatorPtr->multiply_plain_inplace(*res, *pln);
-	evaluatorPtr->relinearize_inplace(*res, *relin_keysPtr);
 	evaluatorPtr->rescale_to_next_inplace(*res);
 
 }
 
+/*
+	The function for performing a not-in-place homomorphic multiplication with Plaintext&Ciphertext without the rescale (i.e., a term of a lazy sum of products)
+	Note: The product keeps the level of the ciphertext and the scale of scale * scale until finalizeLazySumPLCP rescales the whole sum once
+*/
+void plnCprAxMultLazy_mrp(
+	Ciphertext *res, 
+	Ciphertext *cpr,
+	Plaintext *pln,
+	double scale, 
+	SEALContext *contextPtr,
+	Evaluator *evaluatorPtr){
+		
+	// Take the copy of a registered constant at the level of the ciphertext and adjust the scales if needed
+	pln = levelConstantPLCP(pln, cpr);
+	adjustScaleandChainParametersPlaintextAndVectors(cpr, pln, scale, contextPtr, evaluatorPtr);
+
+	// Do the encrypted multiplication (the terms of a sum share the same scale, so that they could be added before the rescale)
+	evaluatorPtr->multiply_plain(*cpr, *pln, *res);
+	res->scale() = scale * scale;
+
+}
+
 /*
 	The function for performing an not-in-place homomorphic addition or subtraction with Plaintext&Ciphertext       
 */
@@ -142,7 +167,8 @@ void addSubtractPLCPVector(
 	Evaluator *evaluatorPtr, 
 	bool isAddition){
 
-	// Adjust the scales if needed
+	// Take the copy of a registered constant at the level of the ciphertext and adjust the scales if needed
+	v_2_Pln = levelConstantPLCP(v_2_Pln, v_1_Ciph);
 	adjustScaleandChainParametersPlaintextAndVectors(v_1_Ciph, v_2_Pln, scale, contextPtr, evaluatorPtr);
 	
 	// Perform the selected operation
@@ -176,39 +202,78 @@ void rotateVector(
 	GaloisKeys *gal_keysPtr, 
 	RelinKeys *relin_keysPtr){
 
-	// Find the binary power
-	int powerBinary = findBinaryPower(indexVectorLength);
+	// Take the rotation buffer from the arena, and accumulate the rotations directly in the output (instead of a ciphertext per rotation step)
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	Ciphertext rotated_result_Local;
+	Ciphertext *rotated_resultPtr = acquireCiphertextArena(&rotated_result_Local);
+	if(indexVectorLength == 1)
+		*sum_Output = *v_to_Rotate;
+	for(int steps = indexVectorLength/2; steps >= 1; steps = steps / 2){
+		if(steps == indexVectorLength/2){
+			// Rotate the input vector and add it to the rotated one at the first step 
+			evaluatorPtr->rotate_vector(*v_to_Rotate, steps, *gal_keysPtr, *rotated_resultPtr);
+			evaluatorPtr->add(*v_to_Rotate, *rotated_resultPtr, *sum_Output);
+		}else{
+			// Rotate the prior sum and add the new rotated vector on top of it
+			evaluatorPtr->rotate_vector(*sum_Output, steps, *gal_keysPtr, *rotated_resultPtr);
+			evaluatorPtr->add_inplace(*sum_Output, *rotated_resultPtr);
+		}
+	}
+	releaseArenaPLCP(mark);
+}
 
-	// Create the vector of Ciphertexts for the rotation operation 
-	vector<Ciphertext> rotations_output(powerBinary + 1);
-	rotations_output[0] = *v_to_Rotate;
-	int rotOutputInd = 0; 
-	for(size_t steps = indexVectorLength/2; steps >= 1; steps = steps / 2){
-		
-		// Rotate the prior ciphertext   	
-		Ciphertext rotated_result;
-		Ciphertext *rotated_resultPtr = &rotated_result;
-		evaluatorPtr->rotate_vector(rotations_output[rotOutputInd], steps, *gal_keysPtr, rotated_result);
-		
-		// Prepare the previous rotated vector 
-		Ciphertext previousRotation; 
-		Ciphertext *previousRotationPtr = &previousRotation;
-		previousRotation = rotations_output[rotOutputInd];
-	
-		// Add the new rotated vector and the previous rotated vector: 
-		// Addition:  rotations_output[rotOutputInd] + rotated_result
-		Ciphertext rotated_added_result;
-		Ciphertext *rotated_added_resultPtr = &rotated_added_result;					
-		addSubtractTwoVector(rotated_added_resultPtr, rotated_resultPtr, previousRotationPtr, scale, contextPtr, evaluatorPtr, true);
-		
-		// Assign the obtained sum	
-		rotations_output[++rotOutputInd] = rotated_added_result; 
+
+/*
+	The function for replicating a rotated and summed vector (i.e., the entry i at the index i * N) homomorphically into the repeated MRP format 
+	(i.e., the entries 0 ... n - 1 at the indices i * N ... i * N + n - 1 of every row segment), so that it is directly usable as the x vector of the next iteration
+	Note: 1) The row start indices i * N are masked, 2) each entry is spread over its own row segment with the right rotations (1, 2, ..., N / 2),
+		  3) only the diagonal indices i * N + i are kept, 4) each diagonal entry is spread over all row segments with the rotations of N, 2N, ..., slot_count / 2.
+		  Two levels and log2(slot_count) rotations are consumed, and the masks are copied before use since the chain adjustment mod-switches them in place.
+*/
+void replicateVectorMRP(
+	Ciphertext *rep_Output, 
+	Ciphertext *v_to_Replicate,
+	Plaintext *rowStartMask_PL,
+	Plaintext *diagMask_PL,
+	double scale, 	
+	int calculatedRowSize, 
+	SEALContext *contextPtr,		
+	Evaluator *evaluatorPtr,
+	Decryptor *decryptorPtr, 
+	CKKSEncoder *encoderPtr,
+	GaloisKeys *gal_keysPtr, 
+	RelinKeys *relin_keysPtr){
+
+	// Take the mask copies and the rotation buffer from the arena
+	struct arenaMarkPLCP mark = markArenaPLCP();
+	Plaintext rowStartMask_Local, diagMask_Local;
+	Ciphertext rotated_result_Local;
+	Plaintext *rowStartMask 	= acquirePlaintextArena(&rowStartMask_Local);
+	Plaintext *diagMask 		= acquirePlaintextArena(&diagMask_Local);
+	Ciphertext *rotated_result  = acquireCiphertextArena(&rotated_result_Local);
+	*rowStartMask = *rowStartMask_PL;
+	*diagMask 	  = *diagMask_PL;
+
+	// Keep only the rotate-and-sum results at the row start indices
+	plnCprAxMult_mrp(rep_Output, v_to_Replicate, rowStartMask, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);
+
+	// Spread each entry over its own row segment (i.e., right rotations)
+	for(int steps = 1; steps < calculatedRowSize; steps = steps * 2){
+		evaluatorPtr->rotate_vector(*rep_Output, -steps, *gal_keysPtr, *rotated_result);
+		evaluatorPtr->add_inplace(*rep_Output, *rotated_result);
 	}
 
-	// Assign the concluding summation to the output variable 
-	*sum_Output = rotations_output[powerBinary]; 
-}
+	// Keep only the diagonal indices (i.e., the entry i at the index i * N + i)
+	plnCprAxMult_InPlac_mrp(rep_Output, diagMask, scale, decryptorPtr, encoderPtr, contextPtr, evaluatorPtr, relin_keysPtr);
 
+	// Spread each diagonal entry over all row segments (i.e., the rotations of the multiples of N)
+	int slotCount = encoderPtr->slot_count();
+	for(int steps = calculatedRowSize; steps < slotCount; steps = steps * 2){
+		evaluatorPtr->rotate_vector(*rep_Output, steps, *gal_keysPtr, *rotated_result);
+		evaluatorPtr->add_inplace(*rep_Output, *rotated_result);
+	}
+	releaseArenaPLCP(mark);
+}
 
 /*
 	The function for equalizing the chain indexes and scales of two ciphertexts to make a homomorphic operation (e.g., Addition, multiplication, etc.)      
@@ -264,6 +329,66 @@ void matrixVectorMultMatRowPacking(
 
 }
 
+/*
+	The function for performing a not-in-place homomorphic multiplication with Ciphertext&Ciphertext without the relinearization and the rescale (i.e., a term of a lazy sum of products)
+	Note: The product keeps three polynomials and the scale of scale * scale until finalizeLazySumPLCP relinearizes and rescales the whole sum once
+*/
+void matrixVectorMultLazyRowPacking(
+	Ciphertext *matrixVecMultRes, 
+	Ciphertext *matrixCipher,
+	Ciphertext *vectorCipher,
+	double scale, 
+	SEALContext *contextPtr,
+	Evaluator *evaluatorPtr){
+		
+	// Adjust the scales if needed
+	adjustScaleandChainParametersTwoVectors(matrixCipher, vectorCipher, matrixVecMultRes, scale, contextPtr, evaluatorPtr);
+
+	// Do the encrypted multiplication	
+	evaluatorPtr->multiply(*matrixCipher, *vectorCipher, *matrixVecMultRes);
+	matrixVecMultRes->scale() = scale * scale;
+
+}
+
+/*
+	The function for adding a product of plnCprAxMultLazy_mrp or matrixVectorMultLazyRowPacking into a lazy sum of products
+	Note: The products of the shallower inputs are mod-switched to the level of the sum (a mod-switch does not need the rescale),
+		  and a sum with a three-polynomial term keeps three polynomials until it is finalized
+*/
+void accumulateLazySumPLCP(
+	Ciphertext *lazySum, 
+	Ciphertext *lazyTerm,
+	bool *isSumEmpty,
+	double scale, 
+	SEALContext *contextPtr,
+	Evaluator *evaluatorPtr){
+
+	// The first term becomes the sum
+	if(*isSumEmpty){
+		*lazySum 	= *lazyTerm;
+		*isSumEmpty = false;
+		return;
+	}
+
+	// Adjust the chain indexes (the scales are scale * scale) and add the term
+	adjustScaleandChainParametersTwoVectors(lazySum, lazyTerm, lazySum, scale * scale, contextPtr, evaluatorPtr);
+	evaluatorPtr->add_inplace(*lazySum, *lazyTerm);
+}
+
+/*
+	The function for finalizing a lazy sum of products with a single relinearization (only if a term is a Ciphertext&Ciphertext product) and a single rescale
+*/
+void finalizeLazySumPLCP(
+	Ciphertext *sumRes, 
+	Ciphertext *lazySum,
+	Evaluator *evaluatorPtr,
+	RelinKeys *relin_keysPtr){
+
+	if(lazySum->size() > 2)
+		evaluatorPtr->relinearize_inplace(*lazySum, *relin_keysPtr);
+	evaluatorPtr->rescale_to_next(*lazySum, *sumRes);
+}
+
 /*
 	The function for performing a in-place homomorphic squaring operation with a ciphertext       
 */
@@ -326,10 +451,9 @@ void addThreeVector(Ciphertext *matrixVecAddRes,
 	v_2_Ciph->scale() = scale;	
 	v_3_Ciph->scale() = scale; 	
 
-	// Make the addition operation
-	Ciphertext matrixVecAddRes_Temp;
-	evaluatorPtr->add(*v_1_Ciph, *v_2_Ciph, matrixVecAddRes_Temp);
-	evaluatorPtr->add(matrixVecAddRes_Temp, *v_3_Ciph, *matrixVecAddRes);
+	// Make the addition operation (accumulated in the result, without a temporary ciphertext)
+	evaluatorPtr->add(*v_1_Ciph, *v_2_Ciph, *matrixVecAddRes);
+	evaluatorPtr->add_inplace(*matrixVecAddRes, *v_3_Ciph);
 }
 
 /*
@@ -352,3 +476,60 @@ void addSubtractTwoVector(Ciphertext *matrixVecAddRes,
 	else
 		evaluatorPtr->sub(*v_1_Ciph, *v_2_Ciph, *matrixVecAddRes); // Make subtraction operation
 }	
+
+/* The accounting of the outbound ciphertexts of the online loop */
+struct downlinkStatsPLCP downlinkStatsPLCP_Active = {0, 0, 0};
+
+/*
+	The function for obtaining the chain index of the lowest level whose modulus holds the scale and the magnitude of the values sent to the key holder (masked: the values carry the secret sharing masks)
+*/
+int downlinkChainIndexPLCP(bool isMasked, double scale, SEALContext *contextPtr){
+	struct runConfigPLCP *cfg = currentRunConfigPLCP();
+	int magnitudeBits = isMasked ? max(cfg->numRandBits, cfg->downlinkMagnitudeBits) + 1 : cfg->downlinkMagnitudeBits;
+	int neededBits 	  = (int) ceil(log2(scale)) + magnitudeBits + 1; // The scale, the magnitude and the sign bit
+
+	// Walk down the chain while the next level still holds the needed bits
+	auto contextData = contextPtr->first_context_data();
+	while(contextData->next_context_data() && contextData->next_context_data()->total_coeff_modulus_bit_count() >= neededBits)
+		contextData = contextData->next_context_data();
+	return (int) contextData->chain_index();
+}
+
+/*
+	The function for mod-switching a ciphertext in place down to the given chain index (kept if it is already at or below it, -1: kept)
+*/
+void modSwitchToChainIndexPLCP(Ciphertext *cipher_CP, int chainIndex, SEALContext *contextPtr, Evaluator *evaluatorPtr){
+	auto contextData = contextPtr->get_context_data(cipher_CP->parms_id());
+	if(chainIndex < 0 || (int) contextData->chain_index() <= chainIndex)
+		return;
+	while((int) contextData->chain_index() > chainIndex)
+		contextData = contextData->next_context_data();
+	evaluatorPtr->mod_switch_to_inplace(*cipher_CP, contextData->parms_id());
+}
+
+/*
+	The function for mod-switching an outbound ciphertext to the lowest level holding the scale and the magnitude of its values (masked: the values carry the secret sharing masks)
+	Note: The mod-switch drops the primes without dividing the values (i.e., unlike the rescale), thus, the precision is kept as long as the remaining modulus holds scale * |value| 
+*/
+void modSwitchDownlinkPLCP(Ciphertext *res_CP, Ciphertext *cipher_CP, bool isMasked, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr){
+	size_t unswitchedBytes = ciphertextBytesPLCP(cipher_CP);
+
+	// Copy and mod-switch the ciphertext (the caller keeps its ciphertext at its level)
+	if(res_CP != cipher_CP)
+		*res_CP = *cipher_CP;
+	if(currentRunConfigPLCP()->useDownlinkModSwitch)
+		modSwitchToChainIndexPLCP(res_CP, downlinkChainIndexPLCP(isMasked, scale, contextPtr), contextPtr, evaluatorPtr);
+
+	// Record the outbound bytes
+	downlinkStatsPLCP_Active.numCiphertexts++;
+	downlinkStatsPLCP_Active.bytes 			 += ciphertextBytesPLCP(res_CP);
+	downlinkStatsPLCP_Active.unswitchedBytes += unswitchedBytes;
+}
+
+/*
+	The function for printing the communication accounting of the outbound ciphertexts
+*/
+void printDownlinkStatsPLCP(struct downlinkStatsPLCP *stats){
+	printf("Downlink: Ciphertexts %zu, Bytes %zu (Unswitched %zu, Ratio %f)\n", stats->numCiphertexts, stats->bytes, stats->unswitchedBytes,
+		stats->unswitchedBytes > 0 ? (double) stats->bytes / stats->unswitchedBytes : 1.0);
+}
@@ -58,6 +58,9 @@ void plnCprAxMult_InPlac_mrp(
 	SEALContext *contextPtr,
 	Evaluator *evaluatorPtr,
 	RelinKeys *relin_keysPtr);
+/* The function for performing a not-in-place homomorphic multiplication with Plaintext&Ciphertext without the rescale (i.e., a term of a lazy sum of products) */
+void plnCprAxMultLazy_mrp(Ciphertext *res, Ciphertext *cpr, Plaintext *pln, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr);
+
 /* The function for performing an not-in-place homomorphic addition or subtraction with Plaintext&Ciphertext */
 void addSubtractPLCPVector(
 	Ciphertext *matrixVecAddRes, 
@@ -96,6 +99,21 @@ void rotateVector(
 	GaloisKeys *gal_keysPtr, 
 	RelinKeys *relin_keysPtr);
 
+/* The function for replicating a rotated and summed vector (i.e., the entry i at the index i * N) homomorphically into the repeated MRP format of the next iteration */
+void replicateVectorMRP(
+	Ciphertext *rep_Output, 
+	Ciphertext *v_to_Replicate,
+	Plaintext *rowStartMask_PL,
+	Plaintext *diagMask_PL,
+	double scale, 	
+	int calculatedRowSize, 
+	SEALContext *contextPtr,		
+	Evaluator *evaluatorPtr,
+	Decryptor *decryptorPtr, 
+	CKKSEncoder *encoderPtr,
+	GaloisKeys *gal_keysPtr, 
+	RelinKeys *relin_keysPtr);
+
 /* The function for performing a not-in-place homomorphic multiplication with Ciphertext&Ciphertext */
 void matrixVectorMultMatRowPacking(
 	Ciphertext *matrixVecMultRes, 
@@ -106,6 +124,15 @@ void matrixVectorMultMatRowPacking(
 	Evaluator *evaluatorPtr,
 	RelinKeys *relin_keysPtr);
 
+/* The function for performing a not-in-place homomorphic multiplication with Ciphertext&Ciphertext without the relinearization and the rescale (i.e., a term of a lazy sum of products) */
+void matrixVectorMultLazyRowPacking(Ciphertext *matrixVecMultRes, Ciphertext *matrixCipher, Ciphertext *vectorCipher, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr);
+
+/* The function for adding a lazy product into a lazy sum of products (the first term becomes the sum) */
+void accumulateLazySumPLCP(Ciphertext *lazySum, Ciphertext *lazyTerm, bool *isSumEmpty, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr);
+
+/* The function for finalizing a lazy sum of products with a single relinearization (if needed) and a single rescale */
+void finalizeLazySumPLCP(Ciphertext *sumRes, Ciphertext *lazySum, Evaluator *evaluatorPtr, RelinKeys *relin_keysPtr);
+
 /* The function for performing a in-place homomorphic squaring operation with a ciphertext */
 void vectorSquaringRowPacking(
 	Ciphertext *vectorCipherSquareRes,	
@@ -134,4 +161,32 @@ void addSubtractTwoVector(Ciphertext *matrixVecAddRes,
 	Evaluator *evaluatorPtr, 
 	bool isAddition);
 
+
+// ##################################################################################
+// ##################################################################################
+// ############################DOWNLINK##############################################
+// ##################################################################################
+// ##################################################################################
+/* Main struct for holding the communication accounting of the ciphertexts sent to the key holder (i.e., decrypted by the client) */
+struct downlinkStatsPLCP {
+	size_t numCiphertexts;  // Number of the outbound ciphertexts
+	size_t bytes;           // Their (uncompressed) bytes after the mod-switch
+	size_t unswitchedBytes; // Their bytes at the level they were computed at
+};
+
+/* The accounting of the outbound ciphertexts of the online loop */
+extern struct downlinkStatsPLCP downlinkStatsPLCP_Active;
+
+/* The function for obtaining the chain index of the lowest level whose modulus holds the scale and the magnitude of the values sent to the key holder (masked: the values carry the secret sharing masks) */
+int downlinkChainIndexPLCP(bool isMasked, double scale, SEALContext *contextPtr);
+
+/* The function for mod-switching a ciphertext in place down to the given chain index (kept if it is already at or below it, -1: kept) */
+void modSwitchToChainIndexPLCP(Ciphertext *cipher_CP, int chainIndex, SEALContext *contextPtr, Evaluator *evaluatorPtr);
+
+/* The function for mod-switching an outbound ciphertext to the lowest level holding the scale and the magnitude of its values (masked: the values carry the secret sharing masks) */
+void modSwitchDownlinkPLCP(Ciphertext *res_CP, Ciphertext *cipher_CP, bool isMasked, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr);
+
+/* The function for printing the communication accounting of the outbound ciphertexts */
+void printDownlinkStatsPLCP(struct downlinkStatsPLCP *stats);
+
 # endif
@@ -16,6 +16,7 @@
 #include "plcpOperations.h"       // The class containing the functions which does Ciphertext-Ciphertext and Plaintext-Ciphertext arithmetic and algebraic operations  	    
 #include "encryptedAppx.h"        // The class containing the functions which does the Chebyshev approximation with different assumptions     
 #include "secretShare.h" 		  // The class containing the functions which does the secret sharing  
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
 
 /* Import the important selected C libraries */
 #include <array>
@@ -111,6 +112,21 @@ void create_SimulationMatrixDataMRP(struct simulationMatrixData *smd, struct sim
 	// Assign Chebyshev Appx. Degress for 8th and 9th equation
 	smrp->chebDegEq8 = smd->chebDegEq8;
 	smrp->chebDegEq9 = smd->chebDegEq9;
+	// The range transformations are applied before the Chebyshev evaluations unless they are folded (see foldCUSUMRangeTransformMRP)
+	smrp->isRangeFolded = false;
+	smrp->residueScale  = 1;
+	smrp->sScale 		= 1;
+	// The Chebyshev approximations are used unless the composite sign approximation is selected (see assignCUSUMAppxBackendMRP)
+	smrp->appxBackendEq8 = CUSUM_APPX_CHEBYSHEV;
+	smrp->appxBackendEq9 = CUSUM_APPX_CHEBYSHEV;
+	// The alarm is decrypted and rounded in Eq10 unless the homomorphic reset is selected
+	smrp->isResetHomomorphic = false;
+	smrp->rowStartMask_PL 	 = NULL;
+	// The sums are rotated at their level unless the rotation levels are planned by the online loop
+	smrp->isRotationLevelPlanned = false;
+	smrp->rotFloorEq2 			 = -1;
+	smrp->rotFloorEq3 			 = -1;
+	smrp->rotFloorEq4_5 		 = -1;
 
 	/* 
 	** =============================================================== 
@@ -128,12 +144,13 @@ void create_SimulationMatrixDataMRP(struct simulationMatrixData *smd, struct sim
 	smrp->yy_MRP 	= new std::vector<double>(smrp->N * smrp->n); // 2nd equation (Estimation)
 	
 	// 3rd Equation			
-	smrp->KGKG_MRP 		= new std::vector<double>(smrp->N * smrp->n); // 3rd equation (Control Action) // Precomputed: -1 * K * Gamma, Dim = [m][n]
-	smrp->KLKL_MRP 		= new std::vector<double>(smrp->N * smrp->n); // 3rd equation (Control Action) // Precomputed: -1 * K * L, Dim = [m][n]   	
-	smrp->KxuGKxuG_MRP  = new std::vector<double>(smrp->N * smrp->n); // 3rd equation (Control Action) // Precomputed: -1 * (K * xG) + uG, Dim = [m][1] 
+	// Note: The (m x n) matrices and the m-dimensional vectors only hold the m row segments (i.e., m * N entries)
+	smrp->KGKG_MRP 		= new std::vector<double>(smrp->N * smrp->m); // 3rd equation (Control Action) // Precomputed: -1 * K * Gamma, Dim = [m][n]
+	smrp->KLKL_MRP 		= new std::vector<double>(smrp->N * smrp->m); // 3rd equation (Control Action) // Precomputed: -1 * K * L, Dim = [m][n]   	
+	smrp->KxuGKxuG_MRP  = new std::vector<double>(smrp->N * smrp->m); // 3rd equation (Control Action) // Precomputed: -1 * (K * xG) + uG, Dim = [m][1] 
 	smrp->uGuG_MRP 	= new std::vector<double>(smrp->N * smrp->n); // 3rd Equation (Prediction) // Precompute: ...,  Dim = [m][1] (for the very first iteration)
-	smrp->KxKx_MRP    = new std::vector<double>(smrp->N * smrp->n); // 3rd equation (Control Action) // Precomputed: K * x^e (for the very first iteration)
-	smrp->uGuG_AS_MRP = new std::vector<double>(smrp->N * smrp->n); // 3rd Equation (Prediction) // Precompute: ...,  Dim = [m][1] (for the very first iteration)
+	smrp->KxKx_MRP    = new std::vector<double>(smrp->N * smrp->m); // 3rd equation (Control Action) // Precomputed: K * x^e (for the very first iteration)
+	smrp->uGuG_AS_MRP = new std::vector<double>(smrp->N * smrp->m); // 3rd Equation (Prediction) // Precompute: ...,  Dim = [m][1] (for the very first iteration)
 
 	// 4-5th Equation
 	smrp->BB_MRP 	= new std::vector<double>(smrp->N * smrp->n); // 4-5th Equation (Prediction) // Plain-Known: B,  Dim = [n][m]   	
@@ -164,6 +181,56 @@ void create_SimulationMatrixDataMRP(struct simulationMatrixData *smd, struct sim
 
 }
 
+/*
+	The function for releasing the MRP vectors of the simulation matrices (the not-created vectors are NULL and skipped by delete, thus, the MRP views are also released)
+*/
+void free_SimulationMatrixDataMRP(struct simulationMatrixMRP *smrp){
+
+	// Release the system matrices and vectors
+	delete smrp->AA_MRP;
+	delete smrp->BB_MRP;
+	delete smrp->CC_MRP;
+	delete smrp->FF_MRP;
+	delete smrp->WW_MRP;
+	delete smrp->VV_MRP;
+	delete smrp->KK_MRP;
+	delete smrp->LL_MRP;
+	delete smrp->xrxr_MRP;
+	delete smrp->urur_MRP;
+	delete smrp->GAMMA_MRP;
+	delete smrp->xGxG_MRP;
+	delete smrp->uGuG_MRP;
+	delete smrp->uGuG_AS_MRP;
+	delete smrp->vv_MRP;
+	delete smrp->TAU_MRP;
+	delete smrp->ALARMSYS_MRP;
+	delete smrp->ss_MRP;
+	delete smrp->xx_MRP;
+	delete smrp->xexe_MRP;
+	delete smrp->xpxp_MRP;
+	delete smrp->yy_MRP;
+	delete smrp->yyAS_MRP;
+	// Release the pre-computed matrices
+	delete smrp->KGKG_MRP;
+	delete smrp->KLKL_MRP;
+	delete smrp->KxuGKxuG_MRP;
+	delete smrp->ACL_MRP;
+	delete smrp->KK_Minus_MRP;
+	delete smrp->KxKx_MRP;
+	// Release the Chebyshev Approximation vectors
+	delete smrp->alpEq8_MRP;
+	delete smrp->betEq8_MRP;
+	delete smrp->alpEq9_MRP;
+	delete smrp->betEq9_MRP;
+	delete smrp->One_MRP;
+	delete smrp->chebPowSerFT_Eq8_MRP;
+	delete smrp->chebPowSerFT_Eq9_MRP;
+	delete smrp->chebPowSer_Coeff_Eq8_MRP;
+	delete smrp->chebPowSer_Coeff_Eq9_MRP;
+	delete smrp->ACLCols_MRP;
+	delete smrp->BBCols_MRP;
+}
+
 /*
 	The function for generating the the simulation matrices in MRP based on the simulation data 
 */
@@ -178,9 +245,9 @@ void assignValMatrixDataMRP(struct simulationMatrixData *smd, struct simulationM
 	// 3rd Equation
 	genMatforMtimesNMRP_RPL(smrp->KGKG_MRP, smd, smrp->n, smrp->m, smrp->N, "KG", false); // Precomputed Matrix KG 
 	genMatforMtimesNMRP_RPL(smrp->KLKL_MRP, smd, smrp->n, smrp->m, smrp->N, "KL", false); // Precomputed Matrix KL 
- 	genUVecAddOperMRP_RPL(smrp->KxuGKxuG_MRP, smd, smrp->m, smrp->n, smrp->N, "Kxug", false); // Precomputed Vector KxuG  
-	genUVecAddOperMRP_RPL(smrp->KxKx_MRP, smd, smrp->m, smrp->n, smrp->N, "Kx", false); // Precomputed Vector KxuG	
-	genUVecAddOperMRP_RPL(smrp->uGuG_AS_MRP, smd, smrp->m, smrp->n, smrp->N, "uG", false); // Precomputed Vector KxuG
+ 	genUVecAddOperMRP_RPL(smrp->KxuGKxuG_MRP, smd, smrp->m, smrp->m, smrp->N, "Kxug", false); // Precomputed Vector KxuG  
+	genUVecAddOperMRP_RPL(smrp->KxKx_MRP, smd, smrp->m, smrp->m, smrp->N, "Kx", false); // Precomputed Vector KxuG	
+	genUVecAddOperMRP_RPL(smrp->uGuG_AS_MRP, smd, smrp->m, smrp->m, smrp->N, "uG", false); // Precomputed Vector KxuG
 	
 	// 4-5th Equation
 	genMatMRP_RPL(smrp->ACL_MRP, smd, smrp->n, smrp->n, smrp->N, "ACL", false);
@@ -206,4 +273,134 @@ void assignValMatrixDataMRP(struct simulationMatrixData *smd, struct simulationM
 	// Chebyshev Appx. - 9th Equation
 	genRangTransfVecChebApprx(smrp->alpEq9_MRP, smrp->betEq9_MRP, smrp->alpbetLowBouEq9, smrp->alpbetUpBouEq9, smrp->N, smrp->n); // alpha, beta
 	genYVecAddOperMRP_RPL(smrp->chebPowSerFT_Eq9_MRP, smd, 0, smrp->n, smrp->n, smrp->N, "chb_2nd_T_D_12_m_2_n_10", false);
+
+	// Sparsity detection: the rotate-and-sum of each equation only covers the non-zero part of the row segments of its matrices
+	// Note: The zero row segments are only reported, since they share the single ciphertext with the non-zero ones and still take part in its SIMD products
+	//		 (only the tiled format skips the work of its zero tiles, see tiledMatrixVectorMultMRP)
+	smrp->rotLenEq2   = max(calculateNonZeroRowSegmentWidth(smrp->GAMMA_MRP, smrp->n, smrp->N), calculateNonZeroRowSegmentWidth(smrp->LL_MRP, smrp->n, smrp->N));
+	smrp->rotLenEq3   = max(calculateNonZeroRowSegmentWidth(smrp->KGKG_MRP, smrp->m, smrp->N), calculateNonZeroRowSegmentWidth(smrp->KLKL_MRP, smrp->m, smrp->N));
+	smrp->rotLenEq4_5 = max(calculateNonZeroRowSegmentWidth(smrp->ACL_MRP, smrp->n, smrp->N), calculateNonZeroRowSegmentWidth(smrp->BB_MRP, smrp->n, smrp->N));
+	printf("MRP Sparsity (reported only): Non-zero row segments Gamma %d/%d, L %d/%d, KG %d/%d, KL %d/%d, ACL %d/%d, B %d/%d\n",
+		countNonZeroRowSegments(smrp->GAMMA_MRP, smrp->n, smrp->N), smrp->n, countNonZeroRowSegments(smrp->LL_MRP, smrp->n, smrp->N), smrp->n,
+		countNonZeroRowSegments(smrp->KGKG_MRP, smrp->m, smrp->N), smrp->m, countNonZeroRowSegments(smrp->KLKL_MRP, smrp->m, smrp->N), smrp->m,
+		countNonZeroRowSegments(smrp->ACL_MRP, smrp->n, smrp->N), smrp->n, countNonZeroRowSegments(smrp->BB_MRP, smrp->n, smrp->N), smrp->n);
+	printf("MRP Sparsity: Rotation lengths Eq2 %d, Eq3 %d, Eq4-5 %d (N = %d)\n", smrp->rotLenEq2, smrp->rotLenEq3, smrp->rotLenEq4_5, smrp->N);
+}
+
+/*
+	The function for folding the range transformations of the Eq8 and Eq9 Chebyshev evaluations into the prediction, the residues and the CUSUM vectors
+	Note: Eq8 evaluates alpha8 * (r + s - v) - beta8 and Eq9 evaluates alpha9 * (s - tau) - beta9, each with a plaintext multiplication (one level) before
+		  the polynomial. Instead, 1) sqrt(alpha8) is carried by y and x^p (i.e., the residue is alpha8 * r), 2) s is kept as alpha9 * s (the Eq8
+		  coefficients produce it directly), 3) v and tau carry the betas, and 4) the alpha8 / alpha9 conversion of s is applied to the fresh s (off
+		  the critical path). The alpha vectors also zeroed the partial sums of the rotate-and-sum in the other slots, thus, x^p takes the columns of
+		  A - LC and B at the row segment starts (see applyEquation_4_5_Folded_PLCP) and Eq10 zeroes the other slots of s. 
+		  The results carrying the scales (y, x^p, r, s) are unscaled by the extractor.
+*/
+void foldCUSUMRangeTransformMRP(struct simulationMatrixMRP *smrp){
+
+	// Compose the range transformations of the approximation intervals
+	double alpha8, beta8, alpha9, beta9;
+	chebyshevRangeTransformPLCP(smrp->alpbetLowBouEq8, smrp->alpbetUpBouEq8, &alpha8, &beta8);
+	chebyshevRangeTransformPLCP(smrp->alpbetLowBouEq9, smrp->alpbetUpBouEq9, &alpha9, &beta9);
+	smrp->residueScale = sqrt(alpha8);
+	smrp->sScale 	   = alpha9;
+
+	// Split A - LC and B into their columns (only the row segment starts are kept, so that the rotated columns sum up at i * N)
+	smrp->ACLCols_MRP = new std::vector<std::vector<double>>(smrp->n, std::vector<double>(smrp->N * smrp->n));
+	smrp->BBCols_MRP  = new std::vector<std::vector<double>>(smrp->m, std::vector<double>(smrp->N * smrp->n));
+	for(int i = 0; i < smrp->n; i++){
+		size_t rowStart = (size_t) i * smrp->N;
+		for(int k = 0; k < smrp->n; k++)
+			smrp->ACLCols_MRP->at(k).at(rowStart) = smrp->residueScale * smrp->ACL_MRP->at(rowStart + k);
+		for(int k = 0; k < smrp->m; k++)
+			smrp->BBCols_MRP->at(k).at(rowStart) = smrp->residueScale * smrp->BB_MRP->at(rowStart + k);
+		// Residues (the very first prediction)
+		smrp->xpxp_MRP->at(rowStart) *= smrp->residueScale;
+		// CUSUM vectors 
+		smrp->vv_MRP->at(rowStart) 				 = alpha8 * smrp->vv_MRP->at(rowStart) + beta8;
+		smrp->TAU_MRP->at(rowStart) 			 = alpha9 * smrp->TAU_MRP->at(rowStart) + beta9;
+		smrp->ss_MRP->at(rowStart) 				*= alpha9;
+		smrp->chebPowSerFT_Eq8_MRP->at(rowStart) *= alpha9;
+		smrp->alpEq8_MRP->at(rowStart) 			 = alpha8 / alpha9;
+	}
+	smrp->isRangeFolded = true;
+	printf("Folded Range Transformation: Eq8 alpha-beta %f-%f, Eq9 alpha-beta %f-%f\n", alpha8, beta8, alpha9, beta9);
+}
+
+/*
+	The function for assigning the approximation backends of Eq8 and Eq9 from the run configuration (the alpha and beta vectors of the composite backend are rewritten)
+	Note: The composite sign approximation takes u = x / B with B = max(|a|, |b|) of the interval (instead of the Chebyshev map onto [-1, 1]), thus, 
+		  the alpha vector carries 1 / B at the row segment starts and the beta vector is zero (i.e., the same plaintext multiplication as the Chebyshev
+		  backend). The folded range transformation assumes the Chebyshev maps, therefore, it is only applied if both equations use the Chebyshev backend.
+*/
+void assignCUSUMAppxBackendMRP(struct simulationMatrixMRP *smrp, struct runConfigPLCP *cfg){
+
+	// Parse the stages of the selected composite approximations (a malformed stage list falls back to the Chebyshev backend)
+	smrp->appxBackendEq8   = cfg->appxBackendEq8;
+	smrp->appxBackendEq9   = cfg->appxBackendEq9;
+	smrp->numSignStagesEq8 = parseSignStagesPLCP(cfg->signStagesEq8, smrp->signStagesEq8, maxSignStages);
+	smrp->numSignStagesEq9 = parseSignStagesPLCP(cfg->signStagesEq9, smrp->signStagesEq9, maxSignStages);
+	if(smrp->appxBackendEq8 == CUSUM_APPX_COMPOSITE_SIGN && smrp->numSignStagesEq8 < 0){
+		fprintf(stderr, "CUSUM Appx.: the Eq8 sign stages '%s' are malformed, the Chebyshev approximation is used\n", cfg->signStagesEq8);
+		smrp->appxBackendEq8 = CUSUM_APPX_CHEBYSHEV;
+	}
+	if(smrp->appxBackendEq9 == CUSUM_APPX_COMPOSITE_SIGN && smrp->numSignStagesEq9 < 0){
+		fprintf(stderr, "CUSUM Appx.: the Eq9 sign stages '%s' are malformed, the Chebyshev approximation is used\n", cfg->signStagesEq9);
+		smrp->appxBackendEq9 = CUSUM_APPX_CHEBYSHEV;
+	}
+	smrp->signBoundEq8 = max(fabs(smrp->alpbetLowBouEq8), fabs(smrp->alpbetUpBouEq8));
+	smrp->signBoundEq9 = max(fabs(smrp->alpbetLowBouEq9), fabs(smrp->alpbetUpBouEq9));
+
+	// Rewrite the range transformations of the composite approximations
+	for(int i = 0; i < smrp->n; i++){
+		size_t rowStart = (size_t) i * smrp->N;
+		if(smrp->appxBackendEq8 == CUSUM_APPX_COMPOSITE_SIGN){
+			smrp->alpEq8_MRP->at(rowStart) = 1 / smrp->signBoundEq8;
+			smrp->betEq8_MRP->at(rowStart) = 0;
+		}
+		if(smrp->appxBackendEq9 == CUSUM_APPX_COMPOSITE_SIGN){
+			smrp->alpEq9_MRP->at(rowStart) = 1 / smrp->signBoundEq9;
+			smrp->betEq9_MRP->at(rowStart) = 0;
+		}
+	}
+	if(smrp->appxBackendEq8 == CUSUM_APPX_COMPOSITE_SIGN)
+		printf("CUSUM Appx.: Eq8 composite sign %s (depth %d + 1), B = %f\n", cfg->signStagesEq8, signStagesDepthPLCP(smrp->signStagesEq8, smrp->numSignStagesEq8), smrp->signBoundEq8);
+	if(smrp->appxBackendEq9 == CUSUM_APPX_COMPOSITE_SIGN)
+		printf("CUSUM Appx.: Eq9 composite sign %s (depth %d), B = %f\n", cfg->signStagesEq9, signStagesDepthPLCP(smrp->signStagesEq9, smrp->numSignStagesEq9), smrp->signBoundEq9);
+}
+
+/*
+	The function for planning the levels of the homomorphic CUSUM reset (false if s cannot end above the floor, the levels a fresh s consumes per iteration otherwise)
+	Note: s̄ is anchored to the residues (i.e., two levels below the top of x^e), not to s, thus, a refreshed s at the top of the chain still ends at 
+		  the top - 2 - Eq8 - reset levels. The refresh of s decrypts s + mask, so that level must hold the masked values (i.e., the floor), and the refresh
+		  can only be skipped if the next iteration from that level stays above the floor as well.
+*/
+bool planHomomorphicResetMRP(struct simulationMatrixMRP *smrp, int topChainIndex, int floorChainIndex, int *sLevelsPerIter){
+
+	// The levels of the stages (the range transformation is a plaintext product unless it is folded, the folded reset masks s̄ with a plaintext product)
+	int residueLevels = 2; // The prediction product and the squaring of Eq6
+	int rangeLevels   = smrp->isRangeFolded ? 0 : 1;
+	int appxEq8 	  = (smrp->appxBackendEq8 == CUSUM_APPX_COMPOSITE_SIGN) ? signStagesDepthPLCP(smrp->signStagesEq8, smrp->numSignStagesEq8) + 1 : chebyshevDepthPLCP(smrp->chebDegEq8);
+	int appxEq9 	  = (smrp->appxBackendEq9 == CUSUM_APPX_COMPOSITE_SIGN) ? signStagesDepthPLCP(smrp->signStagesEq9, smrp->numSignStagesEq9) : chebyshevDepthPLCP(smrp->chebDegEq9);
+	int eq8FromR 	  = rangeLevels + appxEq8;
+	int eq8FromS 	  = 1 + appxEq8; // The range transformation, or the conversion of alpha9 * s into alpha8 * s if it is folded
+	int eq9FromS 	  = rangeLevels + appxEq9;
+	int resetLevels   = smrp->isRangeFolded ? 2 : 1;
+
+	// The chain index of s[k + 1] after a refreshed s[k] (i.e., s at the top)
+	int sChainIndex = min(topChainIndex - residueLevels - eq8FromR, topChainIndex - max(eq8FromS, eq9FromS)) - resetLevels;
+	printf("Homomorphic Reset Plan: Top %d, Residues %d, Eq8 %d, Eq9 %d, Reset %d levels, s ends at %d (floor %d)\n", 
+		topChainIndex, residueLevels, eq8FromR, eq9FromS, resetLevels, sChainIndex, floorChainIndex);
+	if(sChainIndex < floorChainIndex){
+		printf("Homomorphic Reset Plan: the modulus chain is %d level(s) short of holding the masked s above the floor, increase num_middle_primes or "
+			"disable homomorphic_reset\n", floorChainIndex - sChainIndex);
+		return false;
+	}
+
+	// The refresh is skipped when the next iteration from s[k + 1] stays above the floor (the levels of a fresh s are the conservative budget)
+	*sLevelsPerIter = topChainIndex - sChainIndex;
+	if(sChainIndex - *sLevelsPerIter < floorChainIndex)
+		printf("Homomorphic Reset Plan: the refresh of s can never be skipped (it needs %d more level(s)), s is refreshed every iteration\n", 
+			floorChainIndex - (sChainIndex - *sLevelsPerIter));
+	return true;
 }
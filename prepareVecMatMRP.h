@@ -19,6 +19,7 @@
 #include "plcpOperations.h"       // The class containing the functions which does Ciphertext-Ciphertext and Plaintext-Ciphertext arithmetic and algebraic operations  	    
 #include "encryptedAppx.h"        // The class containing the functions which does the Chebyshev approximation with different assumptions     
 #include "secretShare.h" 		  // The class containing the functions which does the secret sharing  
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
 
 /* Import the important selected C libraries*/
 #include <array>
@@ -49,6 +50,10 @@ struct simulationMatrixMRP{
 	int m; // Inputs
 	int n; // States
 	int N; // Encypted Row Size	
+	// Rotation lengths of the rotate-and-sum operations (i.e., the binary-power width of the non-zero row segment entries, N for dense matrices)
+	int rotLenEq2;   // Estimation (Gamma, L)
+	int rotLenEq3;   // Control Action (KG, KL)
+	int rotLenEq4_5; // Prediction (ACL, B)
 	// System matrices and vectors
 	std::vector<double> * AA_MRP;
  	std::vector<double> * BB_MRP; 
@@ -113,6 +118,34 @@ struct simulationMatrixMRP{
 	std::vector<double> * chebPowSer_Coeff_Eq8_MRP; // Chebyshev Equation-8 Vector
 	std::vector<double> * chebPowSer_Coeff_Eq9_MRP; // Chebyshev Equation-9 Vector
 
+	// Folded range transformation (the affine maps of the Chebyshev evaluations are absorbed by the linear stages, see foldCUSUMRangeTransformMRP)
+	bool isRangeFolded;
+	double residueScale; // sqrt(alpha) of Eq8 carried by the prediction and the sensor measurement (i.e., the residues are alpha * r)
+	double sScale;		 // alpha of Eq9 carried by the CUSUM parametric sum (i.e., s is kept as alpha * s)
+	std::vector<std::vector<double>> * ACLCols_MRP; // The columns of A - LC at the row segment starts, scaled by residueScale [n][N * n]
+	std::vector<std::vector<double>> * BBCols_MRP;	// The columns of B at the row segment starts, scaled by residueScale [m][N * n]
+
+	// Approximation backends of the CUSUM nonlinearities (see cusumAppxBackendPLCP, the calloc'd views keep the Chebyshev backend)
+	int appxBackendEq8;
+	int appxBackendEq9;
+	// Composite sign approximation stages and the bounds B of the inputs (i.e., the polynomial is evaluated on x / B)
+	int signStagesEq8[maxSignStages];
+	int signStagesEq9[maxSignStages];
+	int numSignStagesEq8;
+	int numSignStagesEq9;
+	double signBoundEq8;
+	double signBoundEq9;
+
+	// CUSUM reset of Eq10 (see applyEquation_10_PLCP, the calloc'd views keep the decryption-based reset)
+	bool isResetHomomorphic;
+	Plaintext * rowStartMask_PL; // The ones vector at the row segment starts, registered in the constants registry (NULL: encoded per iteration)
+
+	// The chain indexes the sums are mod-switched down to before the rotate-and-sum, i.e., the lowest levels serving their consumers (-1: kept at their level)
+	bool isRotationLevelPlanned; // false: the sums are rotated at their level (the calloc'd views keep it)
+	int rotFloorEq2;
+	int rotFloorEq3;
+	int rotFloorEq4_5;
+
 };
 
 /* Constructor (function) of the class */
@@ -124,9 +157,21 @@ void calculateVectorSize(size_t x_vector_row_size, size_t * calculated_x_row_siz
 /* The function for creating the simulation matrices to convert  the simulation matrix data into MRP  */
 void create_SimulationMatrixDataMRP(struct simulationMatrixData *smd, struct simulationMatrixMRP *smrp);
 
+/* The function for releasing the MRP vectors of the simulation matrices (the struct itself is not released) */
+void free_SimulationMatrixDataMRP(struct simulationMatrixMRP *smrp);
+
 /* The function for generating the the simulation matrices in MRP based on the simulation data */
 void assignValMatrixDataMRP(struct simulationMatrixData *smd, struct simulationMatrixMRP *smrp);
 
+/* The function for folding the range transformations of the Eq8 and Eq9 Chebyshev evaluations into the prediction, the residues and the CUSUM vectors */
+void foldCUSUMRangeTransformMRP(struct simulationMatrixMRP *smrp);
+
+/* The function for assigning the approximation backends of Eq8 and Eq9 from the run configuration (the alpha and beta vectors of the composite backend are rewritten) */
+void assignCUSUMAppxBackendMRP(struct simulationMatrixMRP *smrp, struct runConfigPLCP *cfg);
+
+/* The function for planning the levels of the homomorphic CUSUM reset (false if s cannot end above the floor, the levels a fresh s consumes per iteration otherwise) */
+bool planHomomorphicResetMRP(struct simulationMatrixMRP *smrp, int topChainIndex, int floorChainIndex, int *sLevelsPerIter);
+
 #endif
 
 /* 
@@ -56,7 +56,7 @@ void printScalesAndModulus(
 /* 
 	The function for printing a raw (cleartext) vector content for the tracking purposes   
 */
-void printVector(std::vector <double> *x_vector, size_t x_vector_row_size, size_t x_vector_repeat, char* vectorname){
+void printVector(std::vector <double> *x_vector, size_t x_vector_row_size, size_t x_vector_repeat, const char* vectorname){
 
 	printf("Input %s vector: \n", vectorname);
 	printf("Row size of %s vector: %d \n", vectorname, x_vector_row_size); 
@@ -71,7 +71,7 @@ void printVector(std::vector <double> *x_vector, size_t x_vector_row_size, size_
 /* 
 	The function for printing a raw (cleartext) matrix content for the tracking purposes  
 */
-void printMatrix(std::vector<double> *matPtr, size_t mat_row_size, size_t mat_col_size, char *matname){
+void printMatrix(std::vector<double> *matPtr, size_t mat_row_size, size_t mat_col_size, const char *matname){
 
 	printf("Input %s matrix: \n", matname);
 	for(size_t j = 0; j < mat_row_size * mat_col_size; j++){
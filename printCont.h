@@ -12,10 +12,10 @@
 void printScalesAndModulus( seal::Ciphertext *x3_encrypted, seal::Ciphertext *x1_encrypted, seal::Ciphertext *x2_encrypted, seal::SEALContext *contextPtr);
 
 /* The function for printing a raw (cleartext) vector content for the tracking purposes */
-void printVector(std::vector <double> *x_vector, size_t x_vector_row_size, size_t x_vector_repeat, char* vectorname);
+void printVector(std::vector <double> *x_vector, size_t x_vector_row_size, size_t x_vector_repeat, const char* vectorname);
 
 /* The function for printing a raw (cleartext) matrix content for the tracking purposes */
-void printMatrix(std::vector<double> *matPtr, size_t mat_row_size, size_t mat_col_size, char *matname);
+void printMatrix(std::vector<double> *matPtr, size_t mat_row_size, size_t mat_col_size, const char *matname);
 
 /* The function for printing the application beginner banner for the tracking purposes */
 void printAppBeginner();
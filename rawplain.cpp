@@ -10,6 +10,7 @@
 #include "examples.h"  // The class for the console menu and guiding the user to the preferred application   
 #include "rawplain.h"  // The class which reads and stores the plain matrices
 #include "printCont.h" // The class containing the printing functions for control purposes 
+#include "runConfigPLCP.h" // The class containing the run configuration of the application
 
 /* Import the important selected C libraries*/
 #include <iostream>
@@ -85,6 +86,7 @@ void assDimToSmd(struct simulationMatrixData *smd, char * DimFolderDir, int numI
 	smd->tMax = numIter; 
 	printf("m: %d\n", param[0]);
 	printf("n: %d\n", param[1]);
+	free(param);
 }
 
 /*
@@ -141,7 +143,7 @@ void readYData(struct simulationMatrixData *smd, char * directory){
 /*
 	The function for checking the content of the y vector 
 */
-void readYMCheck(struct simulationMatrixData *smd, char * matname, int dim1, int dim2){
+void readYMCheck(struct simulationMatrixData *smd, const char * matname, int dim1, int dim2){
 	// Print the matrix name 
 	printf("Matrix '%s' read from the file shared by Luis- Sanity Check \n", matname);
 	// Print the content of the y vector 	
@@ -158,7 +160,7 @@ void readYMCheck(struct simulationMatrixData *smd, char * matname, int dim1, int
 /*
 	The function for checking the content of the almost each vector and matrix except the  
 */
-void readMCheck(struct simulationMatrixData *smd, char * matname, int dim1, int dim2){
+void readMCheck(struct simulationMatrixData *smd, const char * matname, int dim1, int dim2){
 
 	// Print the beginner banner of the matrix content  	
 	printf("Matrix '%s' read from the file shared by Luis- Sanity Check \n", matname);	
@@ -217,7 +219,7 @@ void readMCheck(struct simulationMatrixData *smd, char * matname, int dim1, int
 /*
 	The function for reading and filling the simulation vectors and matrices  
 */
-void readMatrix(struct simulationMatrixData *smd, char * dataPath, char * matname, int dim1, int dim2){  
+void readMatrix(struct simulationMatrixData *smd, char * dataPath, const char * matname, int dim1, int dim2){  
 	
 	// Define the file pointer 
 	FILE * fp;
@@ -292,7 +294,8 @@ void readMatrix(struct simulationMatrixData *smd, char * dataPath, char * matnam
     	}	
 	}
 
-	// Close the selected file
+	// Release the line buffer of getline and close the selected file
+	free(line);
 	fclose(fp);
 }
 
@@ -341,7 +344,7 @@ void printExperimentalResult(struct simulationMatrixData *smd){
 /*
 	The function for reading and assigning the values of the initial raw (cleartext) vectors and matrices 
 */
-void assignValMatrixDatabyFileRead(struct simulationMatrixData *smd, char * folderPath){
+void assignValMatrixDatabyFileRead(struct simulationMatrixData *smd, const char * folderPath){
 	
 	// Concatenate the folderPath with the specific matrix file path 
 	// Create the vector and matrix file paths  	 	
@@ -451,16 +454,16 @@ void create_SimulationMatrixData(struct simulationMatrixData *smd){
 	// Define folder paths 
 	char * folderPath_y10_u2 	= "./all_data/y10_u2";
 	char * folderPath_y20_u4 	= "./all_data/y20_u4";
-	char * folderPath_y50_u10 	= "./all_data/y50_u10";
 
-	// Assign m, n dimensions  	
+	// Assign m, n dimensions (the plant and the run length are taken from the run configuration)  	
 	// assDimToSmd(smd, folderPath_y10_u2, 120); // Change here based on the used matrices
 	// assDimToSmd(smd, folderPath_y20_u4, 120); // Change here based on the used matrices	
-	assDimToSmd(smd, folderPath_y50_u10, 120); // Change here based on the used matrices
+	struct runConfigPLCP *cfg = currentRunConfigPLCP();
+	assDimToSmd(smd, cfg->dataPath, cfg->numIter); // Default: ./all_data/y50_u10, 120 iterations
 		
 	// Assign Chebyshev Approximation Degrees 
-	smd->chebDegEq8 = 16;
-	smd->chebDegEq9 = 16; 	
+	smd->chebDegEq8 = cfg->chebDegEq8;
+	smd->chebDegEq9 = cfg->chebDegEq9; 	
 	
 	// Print the dimensions 
 	printf("m: %d \n", smd->m);		
@@ -586,6 +589,75 @@ void create_SimulationMatrixData(struct simulationMatrixData *smd){
 	}
 }
 
+/*
+	The function for releasing a double pointer matrix with the given row dimension (the not-created rows and matrices are skipped)   
+*/
+void freeMatrix(double ** matrix, int rowDm){
+
+	// Skip the not-created matrix (e.g., F and W are not read)
+	if(matrix == NULL)
+		return;
+	// Release the rows and the matrix itself	
+	for(int i = 0; i < rowDm; i++)
+		free(matrix[i]);
+	free(matrix);
+}
+
+/*
+	The function for releasing the simulation matrix data created by create_SimulationMatrixData (the struct itself is not released)   
+*/
+void free_SimulationMatrixData(struct simulationMatrixData *smd){
+
+	// Release the (m x n) and the m-dimensional matrices and vectors 
+	freeMatrix(smd->KK, smd->m);
+	freeMatrix(smd->urur, smd->m);
+	freeMatrix(smd->uGuG, smd->m);
+	freeMatrix(smd->KGKG, smd->m);
+	freeMatrix(smd->KLKL, smd->m);
+	freeMatrix(smd->KxuGKxuG, smd->m);
+	freeMatrix(smd->KxKx, smd->m);
+	// Release the (n x n), (n x m) and the n-dimensional matrices and vectors
+	freeMatrix(smd->AA, smd->n);
+	freeMatrix(smd->BB, smd->n);
+	freeMatrix(smd->CC, smd->n);
+	freeMatrix(smd->FF, smd->n);
+	freeMatrix(smd->WW, smd->n);
+	freeMatrix(smd->VV, smd->n);
+	freeMatrix(smd->LL, smd->n);
+	freeMatrix(smd->xrxr, smd->n);
+	freeMatrix(smd->GAMMA, smd->n);
+	freeMatrix(smd->xGxG, smd->n);
+	freeMatrix(smd->vv, smd->n);
+	freeMatrix(smd->TAU, smd->n);
+	freeMatrix(smd->ALARMSYS, smd->n);
+	freeMatrix(smd->ss, smd->n);
+	freeMatrix(smd->xx, smd->n);
+	freeMatrix(smd->xexe, smd->n);
+	freeMatrix(smd->xpxp, smd->n);
+	freeMatrix(smd->ACL, smd->n);
+	// Release the recorded sensor measurements and the noise vectors
+	freeMatrix(smd->yy, 2000);
+	freeMatrix(smd->xNoise, 201);
+	freeMatrix(smd->yNoise, 201);
+	// Release the Chebyshev Approximation arrays
+	freeMatrix(smd->One, smd->n);
+	freeMatrix(smd->eq8maxAppx_PS_FT_D12_y_10_u_2, smd->n);
+	freeMatrix(smd->eq9ISubAppx_PS_FT_D12_y_10_u_2, smd->n);
+	freeMatrix(smd->eq8maxAppx_PS_Coeff_D12_y_10_u_2, smd->chebDegEq8 + 1);
+	freeMatrix(smd->eq9ISubAppx_PS_Coeff_D12_y_10_u_2, smd->chebDegEq9 + 1);
+	// Release the experimental result vectors
+	freeMatrix(smd->xe_Res, smd->tMax + 1);
+	freeMatrix(smd->u_Res, smd->tMax + 1);
+	freeMatrix(smd->xp_Res, smd->tMax + 1);
+	freeMatrix(smd->residue_Res, smd->tMax + 1);
+	freeMatrix(smd->sBar_Res, smd->tMax + 1);
+	freeMatrix(smd->indInp_Res, smd->tMax + 1);
+	freeMatrix(smd->alarm_Res, smd->tMax + 1);
+	freeMatrix(smd->s_Res, smd->tMax + 1);
+	freeMatrix(smd->x_Res, smd->tMax + 1);
+	freeMatrix(smd->y_Res, smd->tMax + 1);
+}
+
 /*
 	The function for initializing the remaining (not-read from the records received) vectors including the sensor measurement vector y 
 	Status: Possibly not-used 
@@ -605,6 +677,34 @@ void initRemainVec(struct simulationMatrixData *smd){
 	}	
 } 
 
+/*
+	The function for computing the Chebyshev interpolation coefficients of the max (RELU) or the indicator (x > 0) function on [a, b]
+	Note: The degree + 1 Chebyshev nodes are used, which reproduces the tabulated coefficients (e.g., psCfAr_D16_Max for [-5, 25])
+*/
+void computeChebyshevCoeffs(double **coeffs, int degree, double lowBound, double upBound, bool isMaxFunction){
+	int numNodes = degree + 1;
+	for(int k = 0; k < numNodes; k++){
+		double sum = 0;
+		for(int j = 0; j < numNodes; j++){
+			double theta = M_PI * (j + 0.5) / numNodes;
+			double x 	 = lowBound + (upBound - lowBound) * (cos(theta) + 1) / 2;
+			double fx 	 = isMaxFunction ? ((x > 0) ? x : 0) : ((x > 0) ? 1 : 0);
+			sum 		+= fx * cos(k * theta);
+		}
+		coeffs[k][0] = sum * ((k == 0) ? 1 : 2) / numNodes;
+	}
+}
+
+/*
+	The function for assigning the interval [a, b] and the mapping into [-1, 1] (i.e., alpha = 2 / (b - a), beta + 1 = (a + b) / (b - a))
+*/
+static void assignChebyshevInterval(double *lowBound, double *upBound, double *alpha, double *beta, double a, double b){
+	*lowBound = a;
+	*upBound  = b;
+	*alpha 	  = 2 / (b - a);
+	*beta 	  = (a + b) / (b - a);
+}
+
 /*
 	The function for assigning the Chebyshev Approximation constants and arrays for the 8th Equation (Max Function) and 9th Equation (Subtraction-based Indicator Function) 
 */
@@ -635,18 +735,29 @@ void assignCUSUMChebyshevAppxParams(struct simulationMatrixData *smd){
 	smd->alpEq9 			= 0.0555555556;	 // alpha    
 	smd->betEq9 			= -0.7222222222; // beta + 1
 
-	// Assign the Chebyshev Coefficient array of max-8th Equation  
-	for(int i = 0; i < smd->chebDegEq8 + 1; i++)
-	 smd->eq8maxAppx_PS_Coeff_D12_y_10_u_2[i][0]  = psCfAr_D16_Max[i];
+	// Assign the Chebyshev Coefficient array of max-8th Equation (the tabulated coefficients unless the run configuration changes the degree or the interval)
+	struct runConfigPLCP *cfg = currentRunConfigPLCP();
+	if(cfg->chebDegEq8 == 16 && cfg->lowBoundEq8 == smd->alpbetLowBouEq8 && cfg->upBoundEq8 == smd->alpbetUpBouEq8){
+		for(int i = 0; i < smd->chebDegEq8 + 1; i++)
+		 smd->eq8maxAppx_PS_Coeff_D12_y_10_u_2[i][0]  = psCfAr_D16_Max[i];
+	}else{
+		assignChebyshevInterval(&smd->alpbetLowBouEq8, &smd->alpbetUpBouEq8, &smd->alpEq8, &smd->betEq8, cfg->lowBoundEq8, cfg->upBoundEq8);
+		computeChebyshevCoeffs(smd->eq8maxAppx_PS_Coeff_D12_y_10_u_2, smd->chebDegEq8, cfg->lowBoundEq8, cfg->upBoundEq8, true);
+	}
 	
 	// Assign the Chebyshev Coefficient array of max-9th Equation
-	for(int i = 0; i < smd->chebDegEq9 + 1; i++)
-	 smd->eq9ISubAppx_PS_Coeff_D12_y_10_u_2[i][0] = psCfAr_D16_ISub[i];
+	if(cfg->chebDegEq9 == 16 && cfg->lowBoundEq9 == smd->alpbetLowBouEq9 && cfg->upBoundEq9 == smd->alpbetUpBouEq9){
+		for(int i = 0; i < smd->chebDegEq9 + 1; i++)
+		 smd->eq9ISubAppx_PS_Coeff_D12_y_10_u_2[i][0] = psCfAr_D16_ISub[i];
+	}else{
+		assignChebyshevInterval(&smd->alpbetLowBouEq9, &smd->alpbetUpBouEq9, &smd->alpEq9, &smd->betEq9, cfg->lowBoundEq9, cfg->upBoundEq9);
+		computeChebyshevCoeffs(smd->eq9ISubAppx_PS_Coeff_D12_y_10_u_2, smd->chebDegEq9, cfg->lowBoundEq9, cfg->upBoundEq9, false);
+	}
 	
 	// Assign the content of the First Term array
 	for(int i = 0; i < smd->n; i++){	
-	 	smd->eq8maxAppx_PS_FT_D12_y_10_u_2[i][0]  = psCfAr_D16_Max[0];
-  		smd->eq9ISubAppx_PS_FT_D12_y_10_u_2[i][0] = psCfAr_D16_ISub[0]; 
+	 	smd->eq8maxAppx_PS_FT_D12_y_10_u_2[i][0]  = smd->eq8maxAppx_PS_Coeff_D12_y_10_u_2[0][0];
+  		smd->eq9ISubAppx_PS_FT_D12_y_10_u_2[i][0] = smd->eq9ISubAppx_PS_Coeff_D12_y_10_u_2[0][0]; 
 	}
 }
 
@@ -103,11 +103,14 @@ struct simulationMatrixData {
 /* The function for creating the simulation matrix data with the empty slots */
 void create_SimulationMatrixData(struct simulationMatrixData *smd);
 
+/* The function for releasing the simulation matrix data created by create_SimulationMatrixData (the struct itself is not released) */
+void free_SimulationMatrixData(struct simulationMatrixData *smd);
+
 /* The function for assigning the column and row dimensions for the simulation (i.e., m and n respectively) */
 void assDimToSmd(struct simulationMatrixData *smd, char * DimFolderDir, int numIter);
 
 /* The function for reading and assigning the values of the initial raw (cleartext) vectors and matrices */
-void assignValMatrixDatabyFileRead(struct simulationMatrixData *smd, char * folderPath);
+void assignValMatrixDatabyFileRead(struct simulationMatrixData *smd, const char * folderPath);
 
 /* The function for initializing the remaining (not-read from the records received) vectors including the sensor measurement vector y 
    Status: Possibly not-used */
@@ -116,6 +119,9 @@ void initRemainVec(struct simulationMatrixData *smd);
 /* The function for assigning the Chebyshev Approximation constants and arrays for the 8th Equation (Max Function) and 9th Equation (Subtraction-based Indicator Function) */
 void assignCUSUMChebyshevAppxParams(struct simulationMatrixData *smd);
 
+/* The function for computing the Chebyshev interpolation coefficients of the max (RELU) or the indicator (x > 0) function on [a, b] */
+void computeChebyshevCoeffs(double **coeffs, int degree, double lowBound, double upBound, bool isMaxFunction);
+
 // ==== ==== ==== ==== ==== ==== ==== ==== ==== ====== 
 // ==== ==== Functions for Reading Data ==== ==== ==== 
 // ==== ==== ==== ==== ==== ==== ==== ==== ==== ======
@@ -123,13 +129,13 @@ void assignCUSUMChebyshevAppxParams(struct simulationMatrixData *smd);
 void readFile(double **data, std::string input, int *size);
 
 /* The function for reading and filling the simulation vectors and matrices  */
-void readMatrix(struct simulationMatrixData *smd, char * dataPath, char * matname, int dim1, int dim2); 
+void readMatrix(struct simulationMatrixData *smd, char * dataPath, const char * matname, int dim1, int dim2); 
 
 /* The function for reading and filling the recorded y vector data */
 void readYData(struct simulationMatrixData *smd, char * directory);
 
 /* The function for checking the content of the y vector */
-void readYMCheck(struct simulationMatrixData *smd, char * matname, int dim1, int dim2);
+void readYMCheck(struct simulationMatrixData *smd, const char * matname, int dim1, int dim2);
 
 /* The function for printing the experimental result (both the sensor and CUSUM statistics) */
 void printExperimentalResult(struct simulationMatrixData *smd);
@@ -149,6 +155,9 @@ void matrixAdditionThree(double ** result,  double ** vect1, double ** vect2, do
 /* The function for copying a result vector to a target vector */
 void assignResult(double ** result, double ** target, int rowDm, int colDm);
 
+/* The function for releasing a double pointer matrix with the given row dimension (the not-created rows and matrices are skipped) */
+void freeMatrix(double ** matrix, int rowDm);
+
 /* The function for printing a matrix content */
 void printMatrix(double **matrix, int rowDm, int colDm);
 
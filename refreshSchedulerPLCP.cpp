@@ -0,0 +1,90 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the level-budget-driven refresh scheduling of the recurrent ciphertexts
+						  Note that a refresh is never skipped before the levels of an iteration are measured, thus, the first iterations refresh as before.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "refreshSchedulerPLCP.h" // The class containing the level-budget-driven refresh scheduling of the recurrent ciphertexts
+#include "resultsWriterPLCP.h"    // The class containing the asynchronous structured results writer of the online loop (i.e., the log level)
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/*
+	The function for creating an empty refresh scheduler
+*/
+void create_RefreshSchedulerPLCP(struct refreshSchedulerPLCP *rs, SEALContext *contextPtr){
+	rs->contextPtr = contextPtr;
+	rs->numEntries = 0;
+}
+
+/*
+	The function for registering a recurrent ciphertext with the floor of its dependent results (returns its entry, -1: the scheduler is full)
+*/
+int registerRefreshEntryPLCP(struct refreshSchedulerPLCP *rs, const char *name, int floorChainIndex){
+	if(rs->numEntries == maxRefreshEntries)
+		return -1;
+	struct refreshEntryPLCP *e = &rs->entries[rs->numEntries];
+	e->name 			= name;
+	e->startChainIndex 	= -1;
+	e->levelsPerIter 	= -1;
+	e->floorChainIndex 	= floorChainIndex;
+	e->numRefreshes 	= 0;
+	e->numSkipped 		= 0;
+	return rs->numEntries++;
+}
+
+/*
+	The function for recording the chain index of a recurrent ciphertext at the start of an iteration
+*/
+void beginRefreshIterationPLCP(struct refreshSchedulerPLCP *rs, int entry, Ciphertext *cipher_CP){
+	rs->entries[entry].startChainIndex = (int) rs->contextPtr->get_context_data(cipher_CP->parms_id())->chain_index();
+}
+
+/*
+	The function for recording the chain index of the deepest result depending on a recurrent ciphertext in the current iteration
+	Note: The largest consumption is kept, so that a deeper iteration (e.g., an approximation reaching a lower level) is covered afterwards
+*/
+void recordRefreshConsumptionPLCP(struct refreshSchedulerPLCP *rs, int entry, int deepestChainIndex){
+	struct refreshEntryPLCP *e = &rs->entries[entry];
+	if(e->startChainIndex < 0)
+		return;
+	e->levelsPerIter = max(e->levelsPerIter, e->startChainIndex - deepestChainIndex);
+}
+
+/*
+	The function for deciding whether the next value of a recurrent ciphertext needs the refresh (i.e., its remaining levels cannot fit the next iteration above the floor)
+*/
+bool isRefreshNeededPLCP(struct refreshSchedulerPLCP *rs, int entry, Ciphertext *cipher_CP){
+	struct refreshEntryPLCP *e = &rs->entries[entry];
+	int chainIndex 			   = (int) rs->contextPtr->get_context_data(cipher_CP->parms_id())->chain_index();
+	bool isNeeded 			   = e->levelsPerIter < 0 || chainIndex - e->levelsPerIter < e->floorChainIndex;
+	if(isNeeded)
+		e->numRefreshes++;
+	else
+		e->numSkipped++;
+	if(isLoggedPLCP(LOG_LEVEL_VERBOSE))
+		printf("Refresh %s: Chain Index %d, Levels per Iteration %d, Floor %d, %s\n", e->name, chainIndex, e->levelsPerIter, e->floorChainIndex, isNeeded ? "Refreshed" : "Skipped");
+	return isNeeded;
+}
+
+/*
+	The function for printing the refreshes and the skipped refreshes of each recurrent ciphertext
+*/
+void printRefreshSchedulerPLCP(struct refreshSchedulerPLCP *rs){
+	for(int i = 0; i < rs->numEntries; i++){
+		struct refreshEntryPLCP *e = &rs->entries[i];
+		printf("Refresh Scheduler %s: Refreshes %d, Skipped %d (Levels per Iteration %d, Floor %d)\n", e->name, e->numRefreshes, e->numSkipped, e->levelsPerIter, e->floorChainIndex);
+	}
+}
@@ -0,0 +1,66 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the level-budget-driven refresh scheduling of the recurrent ciphertexts (i.e., refreshSchedulerPLCP.cpp)
+						  The chain index of each recurrent ciphertext (e.g., the replicated x^e, the homomorphically reset s) is recorded at the start of
+						  an iteration, and the levels consumed down to its deepest dependent result are measured per iteration. The interactive refresh
+						  (i.e., the secret share round-trip) is only triggered when the remaining levels cannot fit the next iteration above the floor,
+						  the lowest level whose modulus still holds the masked values decrypted at the end of an iteration.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+#ifndef REFRESHSCHEDULERPLCP_H
+#define REFRESHSCHEDULERPLCP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Define the constants */
+#define maxRefreshEntries 4 // Recurrent ciphertexts of a scheduler
+
+/* Main struct for holding the level budget of a recurrent ciphertext */
+struct refreshEntryPLCP {
+	const char * name;
+	int startChainIndex;   // The chain index at the start of the current iteration
+	int levelsPerIter;     // The most levels consumed by an iteration down to the deepest dependent result (-1: not measured yet)
+	int floorChainIndex;   // The lowest chain index the deepest dependent result may reach
+	int numRefreshes;
+	int numSkipped;
+};
+
+/* Main struct for holding the recurrent ciphertexts of the online loop */
+struct refreshSchedulerPLCP {
+	SEALContext * contextPtr;
+	int numEntries;
+	struct refreshEntryPLCP entries[maxRefreshEntries];
+};
+
+/* The function for creating an empty refresh scheduler */
+void create_RefreshSchedulerPLCP(struct refreshSchedulerPLCP *rs, SEALContext *contextPtr);
+
+/* The function for registering a recurrent ciphertext with the floor of its dependent results (returns its entry, -1: the scheduler is full) */
+int registerRefreshEntryPLCP(struct refreshSchedulerPLCP *rs, const char *name, int floorChainIndex);
+
+/* The function for recording the chain index of a recurrent ciphertext at the start of an iteration */
+void beginRefreshIterationPLCP(struct refreshSchedulerPLCP *rs, int entry, Ciphertext *cipher_CP);
+
+/* The function for recording the chain index of the deepest result depending on a recurrent ciphertext in the current iteration */
+void recordRefreshConsumptionPLCP(struct refreshSchedulerPLCP *rs, int entry, int deepestChainIndex);
+
+/* The function for deciding whether the next value of a recurrent ciphertext needs the refresh (i.e., its remaining levels cannot fit the next iteration above the floor) */
+bool isRefreshNeededPLCP(struct refreshSchedulerPLCP *rs, int entry, Ciphertext *cipher_CP);
+
+/* The function for printing the refreshes and the skipped refreshes of each recurrent ciphertext */
+void printRefreshSchedulerPLCP(struct refreshSchedulerPLCP *rs);
+
+#endif
@@ -0,0 +1,211 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the asynchronous structured results writer of the online loop
+						  The records are formatted and written by the writer thread only, thus, the online loop neither formats the values nor
+						  waits for the file system (unless the ring is full, which is counted as a stall of the ring).
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "streamingPLCP.h"        // The class containing the streaming ingestion of the sensor measurements (i.e., the SPSC ring)
+#include "resultsWriterPLCP.h"    // The class containing the asynchronous structured results writer of the online loop
+
+/* Import the important selected C libraries*/
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Define the constants */
+#define resultsPathLength 512
+#define numResultFields 7 // iter, y, u, alarm, s, residue, timings
+
+/* The console verbosity of the online loop (the original console output by default) */
+enum logLevelPLCP activeLogLevelPLCP = LOG_LEVEL_VERBOSE;
+
+/* The names and the timing columns of the results files */
+static const char * resultFieldNames[numResultFields] = {"iter", "y", "u", "alarm", "s", "residue", "timings"};
+static const char * resultTimingNames[numResultTimings] = {"sensor", "eq2", "eq3", "eq4_5", "eq6", "cusum", "eq10", "lastSecretShare", "processNoise"};
+
+/*
+	The function for checking whether the messages of the given log level are printed
+*/
+bool isLoggedPLCP(enum logLevelPLCP level){
+	return activeLogLevelPLCP >= level;
+}
+
+/*
+	The function for obtaining the number of the doubles of each field of a record
+*/
+static void resultFieldWidths(struct resultsWriterPLCP *rw, int *widths){
+	int fieldWidths[numResultFields] = {1, rw->n, rw->m, rw->n, rw->n, rw->n, numResultTimings};
+	memcpy(widths, fieldWidths, sizeof(fieldWidths));
+}
+
+/*
+	The function for writing the popped records into the results files on the writer thread
+*/
+static void runResultsWriterPLCP(struct resultsWriterPLCP *rw){
+
+	// Open the results files
+	char path[resultsPathLength];
+	int widths[numResultFields];
+	resultFieldWidths(rw, widths);
+	FILE * files[numResultFields] = {NULL};
+	int numFiles = (rw->format == RESULTS_FORMAT_CSV) ? 1 : numResultFields;
+	for(int f = 0; f < numFiles; f++){
+		if(rw->format == RESULTS_FORMAT_CSV)
+			snprintf(path, resultsPathLength, "%s/results.csv", rw->dirPath);
+		else
+			snprintf(path, resultsPathLength, "%s/%s.bin", rw->dirPath, resultFieldNames[f]);
+		files[f] = fopen(path, (rw->format == RESULTS_FORMAT_CSV) ? "w" : "wb");
+		if(files[f] == NULL){
+			fprintf(stderr, "Results Writer: %s could not be opened\n", path);
+			rw->hasFailed->store(true);
+		}
+	}
+
+	// Write the CSV header (e.g., iter,y0,...,u0,...,t_sensor,...)
+	if(rw->format == RESULTS_FORMAT_CSV && files[0] != NULL){
+		long headerBytes = fprintf(files[0], "iter");
+		for(int f = 1; f < numResultFields - 1; f++)
+			for(int i = 0; i < widths[f]; i++)
+				headerBytes += fprintf(files[0], ",%s%d", resultFieldNames[f], i);
+		for(int t = 0; t < numResultTimings; t++)
+			headerBytes += fprintf(files[0], ",t_%s", resultTimingNames[t]);
+		headerBytes += fprintf(files[0], "\n");
+		rw->bytesWritten->fetch_add(headerBytes > 0 ? headerBytes : 0);
+	}
+
+	// Write the records until the ring is closed and drained (the records are still popped after a failure, so the loop is never blocked)
+	double * record = rw->writeRecord;
+	while(popStreamRingPLCP(rw->ring, record)){
+		if(rw->hasFailed->load())
+			continue;
+		size_t recordBytes = 0;
+		if(rw->format == RESULTS_FORMAT_CSV){
+			long lineBytes = fprintf(files[0], "%d", (int) record[0]);
+			for(int j = 1; j < rw->recordWidth; j++)
+				lineBytes += fprintf(files[0], ",%.11f", record[j]);
+			lineBytes += fprintf(files[0], "\n");
+			if(lineBytes < 0)
+				rw->hasFailed->store(true);
+			recordBytes = (lineBytes > 0) ? lineBytes : 0;
+		}else{
+			double * field = record;
+			for(int f = 0; f < numResultFields; f++){
+				if(fwrite(field, sizeof(double), widths[f], files[f]) != (size_t) widths[f])
+					rw->hasFailed->store(true);
+				recordBytes += widths[f] * sizeof(double);
+				field += widths[f];
+			}
+		}
+		rw->bytesWritten->fetch_add(recordBytes);
+		rw->numWritten->fetch_add(1);
+	}
+
+	// Close the results files
+	for(int f = 0; f < numFiles; f++)
+		if(files[f] != NULL && fclose(files[f]) != 0)
+			rw->hasFailed->store(true);
+}
+
+/*
+	The function for creating the results writer and starting its thread (the directory is created if it is missing)
+*/
+void create_ResultsWriterPLCP(struct resultsWriterPLCP *rw, const char *dirPath, enum resultsFormatPLCP format, int n, int m, size_t capacity){
+	rw->n 			  = n;
+	rw->m 			  = m;
+	rw->recordWidth   = 1 + 4 * n + m + numResultTimings;
+	rw->format 		  = format;
+	rw->dirPath 	  = dirPath;
+	rw->ring 		  = (struct streamRingPLCP *) calloc(1, sizeof(struct streamRingPLCP));
+	create_StreamRingPLCP(rw->ring, rw->recordWidth, capacity);
+	rw->record 		  = (double *) calloc(rw->recordWidth, sizeof(double));
+	rw->writeRecord   = (double *) calloc(rw->recordWidth, sizeof(double));
+	rw->stopRequested = new atomic<bool>(false);
+	rw->numPushed 	  = 0;
+	rw->numWritten 	  = new atomic<size_t>(0);
+	rw->bytesWritten  = new atomic<size_t>(0);
+	rw->hasFailed 	  = new atomic<bool>(false);
+	mkdir(dirPath, 0755);
+	rw->writer 		  = new thread(runResultsWriterPLCP, rw);
+}
+
+/*
+	The function for closing the ring and waiting until the writer thread wrote the pushed records
+*/
+void closeResultsWriterPLCP(struct resultsWriterPLCP *rw){
+	if(rw->writer == NULL)
+		return;
+	rw->ring->isClosed->store(true, memory_order_release);
+	rw->writer->join();
+	delete rw->writer;
+	rw->writer = NULL;
+}
+
+/*
+	The function for closing the results writer and freeing the ring
+*/
+void free_ResultsWriterPLCP(struct resultsWriterPLCP *rw){
+	closeResultsWriterPLCP(rw);
+	free_StreamRingPLCP(rw->ring);
+	free(rw->ring);
+	free(rw->record);
+	free(rw->writeRecord);
+	delete rw->stopRequested;
+	delete rw->numWritten;
+	delete rw->bytesWritten;
+	delete rw->hasFailed;
+}
+
+/*
+	The function for copying a result row into the staging record (zeros for a NULL row)
+*/
+static double * stageResultRow(double *dest, double *row, int width){
+	if(row != NULL)
+		memcpy(dest, row, width * sizeof(double));
+	else
+		memset(dest, 0, width * sizeof(double));
+	return dest + width;
+}
+
+/*
+	The function for pushing the record of an iteration from the given result rows (NULL rows are written as zeros)
+*/
+void pushResultsRecordPLCP(struct resultsWriterPLCP *rw, int numIter, double *y, double *u, double *alarm, double *s, double *residue, double *timings){
+
+	// Stage the record
+	double * dest = rw->record;
+	*dest++ = numIter;
+	dest = stageResultRow(dest, y, rw->n);
+	dest = stageResultRow(dest, u, rw->m);
+	dest = stageResultRow(dest, alarm, rw->n);
+	dest = stageResultRow(dest, s, rw->n);
+	dest = stageResultRow(dest, residue, rw->n);
+	stageResultRow(dest, timings, numResultTimings);
+
+	// Push the record (waits while the ring is full)
+	if(pushStreamRingPLCP(rw->ring, rw->record, rw->stopRequested))
+		rw->numPushed++;
+}
+
+/*
+	The function for printing the results writer statistics
+*/
+void printResultsWriterPLCP(struct resultsWriterPLCP *rw){
+	printf("Results Writer: %s in %s, Records Pushed-Written %zu-%zu, Bytes %zu, Ring Full Stalls %zu, Failed %d\n",
+		(rw->format == RESULTS_FORMAT_CSV) ? "CSV" : "Binary", rw->dirPath, rw->numPushed, rw->numWritten->load(),
+		rw->bytesWritten->load(), rw->ring->numFullStalls->load(), rw->hasFailed->load() ? 1 : 0);
+}
@@ -0,0 +1,94 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the asynchronous structured results writer of the online loop (i.e., resultsWriterPLCP.cpp)
+						  The online loop only pushes a fixed-size record per iteration (i.e., y, u, alarm, s, the residues and the phase timings) into
+						  an SPSC ring, and a background thread writes the records into a CSV file or columnar binary files (a file per field).
+						  The console verbosity of the loop is selected by the log level.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+						  # SPSC: Single-producer single-consumer
+*/
+
+#ifndef RESULTSWRITERPLCP_H
+#define RESULTSWRITERPLCP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "streamingPLCP.h"        // The class containing the streaming ingestion of the sensor measurements (i.e., the SPSC ring)
+
+/* Import the important selected C libraries*/
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Define the constants */
+#define numResultTimings 9 // Phase timings of a record (i.e., sensor, Eq2, Eq3, Eq4_5, Eq6, CUSUM, Eq10, last secret share, process noise)
+
+/* The console verbosity of the online loop
+   QUIET  : only the errors and the final statistics
+   SUMMARY: the iteration banners and the periodic statistics
+   VERBOSE: every phase timing and every extracted value (i.e., the original console output) */
+enum logLevelPLCP {
+	LOG_LEVEL_QUIET,
+	LOG_LEVEL_SUMMARY,
+	LOG_LEVEL_VERBOSE
+};
+
+/* The file formats of the results writer
+   CSV   : results.csv with a header line and a line per iteration
+   BINARY: a file per field (iter.bin, y.bin, u.bin, alarm.bin, s.bin, residue.bin, timings.bin) with the doubles of a record per iteration */
+enum resultsFormatPLCP {
+	RESULTS_FORMAT_CSV,
+	RESULTS_FORMAT_BINARY
+};
+
+/* Main struct for holding the record ring and the background writer of the results */
+struct resultsWriterPLCP {
+	int n;                          // Number of the states (i.e., the entries of y, alarm, s and the residues)
+	int m;                          // Number of the inputs (i.e., the entries of u)
+	int recordWidth;                // Doubles of a record (1 + 4 * n + m + numResultTimings)
+	enum resultsFormatPLCP format;  // The file format
+	const char * dirPath;           // The results directory
+	struct streamRingPLCP * ring;   // The records pushed by the online loop
+	double * record;                // Staging record of the online loop [recordWidth]
+	double * writeRecord;           // Record popped by the writer [recordWidth]
+	atomic<bool> * stopRequested;   // Stop flag of the ring push (not set, since the writer keeps popping after a failure)
+	thread * writer;                // The writer thread (NULL: closed)
+	// Statistics
+	size_t numPushed;               // Number of the pushed records (online loop only)
+	atomic<size_t> * numWritten;    // Number of the written records
+	atomic<size_t> * bytesWritten;  // Bytes written into the results files
+	atomic<bool> * hasFailed;       // A results file could not be opened or written
+};
+
+/* The console verbosity of the online loop */
+extern enum logLevelPLCP activeLogLevelPLCP;
+
+/* The function for checking whether the messages of the given log level are printed */
+bool isLoggedPLCP(enum logLevelPLCP level);
+
+/* The function for creating the results writer and starting its thread (the directory is created if it is missing) */
+void create_ResultsWriterPLCP(struct resultsWriterPLCP *rw, const char *dirPath, enum resultsFormatPLCP format, int n, int m, size_t capacity);
+
+/* The function for closing the ring and waiting until the writer thread wrote the pushed records */
+void closeResultsWriterPLCP(struct resultsWriterPLCP *rw);
+
+/* The function for closing the results writer and freeing the ring */
+void free_ResultsWriterPLCP(struct resultsWriterPLCP *rw);
+
+/* The function for pushing the record of an iteration from the given result rows (NULL rows are written as zeros) */
+void pushResultsRecordPLCP(struct resultsWriterPLCP *rw, int numIter, double *y, double *u, double *alarm, double *s, double *residue, double *timings);
+
+/* The function for printing the results writer statistics */
+void printResultsWriterPLCP(struct resultsWriterPLCP *rw);
+
+#endif
@@ -0,0 +1,456 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the run configuration of the application
+						  Every key is described once in the key table (i.e., the name, the type and the field), thus, the configuration file,
+						  the command line, the printing and the usage share the same list.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+/* Import the other classes' header files*/
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <cstddef>
+#include <ctype.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Call main namespaces */
+using namespace std;
+
+/* Define the constants */
+#define runConfigLineLength 1024
+
+/* The value types of the keys */
+enum runConfigTypePLCP {
+	RUN_CONFIG_INT,
+	RUN_CONFIG_SIZE,
+	RUN_CONFIG_DOUBLE,
+	RUN_CONFIG_BOOL,
+	RUN_CONFIG_STRING
+};
+
+/* Struct for holding a key of the run configuration */
+struct runConfigKeyPLCP {
+	const char * key;
+	enum runConfigTypePLCP type;
+	size_t offset;                 // The offset of the field in runConfigPLCP
+	const char * const * names;    // The names of the integer values (NULL: numbers only)
+	const char * help;
+};
+
+/* The names of the enumerated values (in the order of logLevelPLCP, resultsFormatPLCP, cusumAppxBackendPLCP and streamSourcePLCP) */
+static const char * const logLevelNames[] 	   = {"quiet", "summary", "verbose", NULL};
+static const char * const resultsFormatNames[] = {"csv", "binary", NULL};
+static const char * const appxBackendNames[]   = {"chebyshev", "composite", NULL};
+static const char * const streamSourceNames[]  = {"stdin", "fifo", "tail_binary", NULL};
+
+/* The keys of the run configuration */
+static const struct runConfigKeyPLCP runConfigKeys[] = {
+	{"data_path", 			RUN_CONFIG_STRING, offsetof(struct runConfigPLCP, dataPath), 			 NULL, "The folder of the plant matrices"},
+	{"num_iter", 			RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, numIter), 			 NULL, "Number of the online iterations"},
+	{"poly_modulus_degree", RUN_CONFIG_SIZE,   offsetof(struct runConfigPLCP, polyModulusDegree), 	 NULL, "The CKKS polynomial modulus degree"},
+	{"bit_size", 			RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, bitSizeParam), 		 NULL, "Bit size of the middle primes and of the scale"},
+	{"special_bit_size", 	RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, specialBitSize), 		 NULL, "Bit size of the first and the last primes"},
+	{"num_middle_primes", 	RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, numMiddlePrimes), 	 NULL, "Number of the middle primes"},
+	{"num_rand_bits", 		RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, numRandBits), 		 NULL, "Bit size of the secret sharing masks"},
+	{"cheb_deg_eq8", 		RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, chebDegEq8), 			 NULL, "Degree of the Eq8 (max) approximation"},
+	{"cheb_deg_eq9", 		RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, chebDegEq9), 			 NULL, "Degree of the Eq9 (indicator) approximation"},
+	{"low_bound_eq8", 		RUN_CONFIG_DOUBLE, offsetof(struct runConfigPLCP, lowBoundEq8), 		 NULL, "Lower bound a of the Eq8 interval"},
+	{"up_bound_eq8", 		RUN_CONFIG_DOUBLE, offsetof(struct runConfigPLCP, upBoundEq8), 			 NULL, "Upper bound b of the Eq8 interval"},
+	{"low_bound_eq9", 		RUN_CONFIG_DOUBLE, offsetof(struct runConfigPLCP, lowBoundEq9), 		 NULL, "Lower bound a of the Eq9 interval"},
+	{"up_bound_eq9", 		RUN_CONFIG_DOUBLE, offsetof(struct runConfigPLCP, upBoundEq9), 			 NULL, "Upper bound b of the Eq9 interval"},
+	{"appx_eq8", 			RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, appxBackendEq8), 		 appxBackendNames, "chebyshev or composite (sign) approximation of Eq8"},
+	{"appx_eq9", 			RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, appxBackendEq9), 		 appxBackendNames, "chebyshev or composite (sign) approximation of Eq9"},
+	{"sign_stages_eq8", 	RUN_CONFIG_STRING, offsetof(struct runConfigPLCP, signStagesEq8), 		 NULL, "The composite sign stages of Eq8 (f1, f3, g1, g3)"},
+	{"sign_stages_eq9", 	RUN_CONFIG_STRING, offsetof(struct runConfigPLCP, signStagesEq9), 		 NULL, "The composite sign stages of Eq9 (f1, f3, g1, g3)"},
+	{"folded_range_transform", RUN_CONFIG_BOOL, offsetof(struct runConfigPLCP, useFoldedRangeTransform), NULL, "Fold the Chebyshev range transformations into the linear stages"},
+	{"diagonal_packing", 	RUN_CONFIG_BOOL,   offsetof(struct runConfigPLCP, useDiagonalPacking), 	 NULL, "Run the online loop in the diagonal (Halevi-Shoup) packing format"},
+	{"homomorphic_replication", RUN_CONFIG_BOOL, offsetof(struct runConfigPLCP, useHomomorphicReplication), NULL, "Replicate x^e homomorphically instead of the re-arranging secret share"},
+	{"constants_registry", 	RUN_CONFIG_BOOL,   offsetof(struct runConfigPLCP, useConstantsRegistry), NULL, "Reuse the per-level copies of the registered constants"},
+	{"complex_tile_packing", RUN_CONFIG_BOOL,  offsetof(struct runConfigPLCP, useComplexTilePacking), NULL, "Pair the row tiles of the tiled layout in the complex slots"},
+	{"tiled_col_tile_width", RUN_CONFIG_SIZE,  offsetof(struct runConfigPLCP, tiledColTileWidth), 	 NULL, "Run the tiled layout with the given column tile width (0: only on the MRP overflow)"},
+	{"streaming", 			RUN_CONFIG_BOOL,   offsetof(struct runConfigPLCP, useStreamingIngestion), NULL, "Drive the online loop with the streamed y vectors"},
+	{"stream_source", 		RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, streamSource), 		 streamSourceNames, "stdin, fifo or tail_binary"},
+	{"stream_path", 		RUN_CONFIG_STRING, offsetof(struct runConfigPLCP, streamPath), 			 NULL, "The FIFO or the tailed binary file of the stream"},
+	{"stream_ring_capacity", RUN_CONFIG_SIZE,  offsetof(struct runConfigPLCP, streamRingCapacity), 	 NULL, "The y vectors buffered between the source and the online loop"},
+	{"homomorphic_reset", 	RUN_CONFIG_BOOL,   offsetof(struct runConfigPLCP, useHomomorphicReset),  NULL, "Reset the CUSUM sum of Eq10 without decrypting the alarm"},
+	{"level_targeted_sensing", RUN_CONFIG_BOOL, offsetof(struct runConfigPLCP, useLevelTargetedSensing), NULL, "Encrypt y at the level where the server first uses it"},
+	{"downlink_mod_switch", RUN_CONFIG_BOOL,   offsetof(struct runConfigPLCP, useDownlinkModSwitch), NULL, "Mod-switch the decrypted ciphertexts to their lowest level"},
+	{"downlink_magnitude_bits", RUN_CONFIG_INT, offsetof(struct runConfigPLCP, downlinkMagnitudeBits), NULL, "Bit size bound of the unmasked decrypted values"},
+	{"rotation_level_planning", RUN_CONFIG_BOOL, offsetof(struct runConfigPLCP, useRotationLevelPlanning), NULL, "Rotate the linear sums at the lowest levels serving their consumers"},
+	{"num_threads", 		RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, numThreads), 			 NULL, "Worker threads (0: the hardware concurrency)"},
+	{"example", 			RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, exampleSelection), 	 NULL, "The example run without the console menu (0: the menu)"},
+	{"log_level", 			RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, logLevel), 			 logLevelNames, "quiet, summary or verbose"},
+	{"result_reporting", 	RUN_CONFIG_BOOL,   offsetof(struct runConfigPLCP, useResultReporting), 	 NULL, "Decrypt the reported y, u, alarm and s"},
+	{"async_reporting", 	RUN_CONFIG_BOOL,   offsetof(struct runConfigPLCP, useAsyncReporting), 	 NULL, "Decrypt the reported results on a background worker"},
+	{"results_writer", 		RUN_CONFIG_BOOL,   offsetof(struct runConfigPLCP, useResultsWriter), 	 NULL, "Write the records of the iterations"},
+	{"results_dir", 		RUN_CONFIG_STRING, offsetof(struct runConfigPLCP, resultsDir), 			 NULL, "The results directory"},
+	{"results_format", 		RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, resultsFormat), 		 resultsFormatNames, "csv or binary"},
+	{"checkpointing", 		RUN_CONFIG_BOOL,   offsetof(struct runConfigPLCP, useCheckpointing), 	 NULL, "Write the encrypted state checkpoints"},
+	{"resume", 				RUN_CONFIG_BOOL,   offsetof(struct runConfigPLCP, resumeFromCheckpoint), NULL, "Resume from the last checkpoint"},
+	{"checkpoint_dir", 		RUN_CONFIG_STRING, offsetof(struct runConfigPLCP, checkpointDir), 		 NULL, "The checkpoint directory"},
+	{"key_store_dir", 		RUN_CONFIG_STRING, offsetof(struct runConfigPLCP, keyStoreDir), 		 NULL, "The secret key store for resuming (empty: not stored)"},
+	{"checkpoint_interval", RUN_CONFIG_INT,    offsetof(struct runConfigPLCP, checkpointInterval), 	 NULL, "Iterations between the checkpoints"},
+	{"sweep_file", 			RUN_CONFIG_STRING, offsetof(struct runConfigPLCP, sweepPath), 			 NULL, "The grid file of the parameter sweep"},
+	{"sweep_output", 		RUN_CONFIG_STRING, offsetof(struct runConfigPLCP, sweepOutput), 		 NULL, "The CSV file of the sweep points"}
+};
+static const size_t numRunConfigKeys = sizeof(runConfigKeys) / sizeof(runConfigKeys[0]);
+
+/* The run configuration set by main */
+struct runConfigPLCP *activeRunConfigPLCP = NULL;
+
+/*
+	The function for assigning the default run configuration
+*/
+void defaultRunConfigPLCP(struct runConfigPLCP *cfg){
+	memset(cfg, 0, sizeof(struct runConfigPLCP));
+	snprintf(cfg->dataPath, runConfigValueLength, "%s", "./all_data/y50_u10");
+	cfg->numIter 			  = 120;
+	cfg->polyModulusDegree 	  = 32768;
+	cfg->bitSizeParam 		  = 50;
+	cfg->specialBitSize 	  = 60;
+	cfg->numMiddlePrimes 	  = 9;
+	cfg->numRandBits 		  = 20;
+	cfg->chebDegEq8 		  = 16;
+	cfg->chebDegEq9 		  = 16;
+	cfg->lowBoundEq8 		  = -5;
+	cfg->upBoundEq8 		  = 25;
+	cfg->lowBoundEq9 		  = -31;
+	cfg->upBoundEq9 		  = 5;
+	cfg->appxBackendEq8 	  = 0; // Chebyshev
+	cfg->appxBackendEq9 	  = 0; // Chebyshev
+	snprintf(cfg->signStagesEq8, runConfigValueLength, "%s", "g3,f1");
+	snprintf(cfg->signStagesEq9, runConfigValueLength, "%s", "g3,f1");
+	cfg->useFoldedRangeTransform = false;
+	cfg->useDiagonalPacking   = false;
+	cfg->useHomomorphicReplication = false;
+	cfg->useConstantsRegistry = true;
+	cfg->useComplexTilePacking = false;
+	cfg->tiledColTileWidth 	  = 0;
+	cfg->useStreamingIngestion = false;
+	cfg->streamSource 		  = 0; // stdin
+	snprintf(cfg->streamPath, runConfigValueLength, "%s", "./all_data/y_stream.bin");
+	cfg->streamRingCapacity   = 64;
+	cfg->useHomomorphicReset  = false;
+	cfg->useLevelTargetedSensing = true;
+	cfg->useDownlinkModSwitch = true;
+	cfg->downlinkMagnitudeBits = 20;
+	cfg->useRotationLevelPlanning = true;
+	cfg->numThreads 		  = 0;
+	cfg->exampleSelection 	  = 0;
+	cfg->logLevel 			  = 2; // Verbose
+	cfg->useResultReporting   = true;
+	cfg->useAsyncReporting 	  = false;
+	cfg->useResultsWriter 	  = false;
+	snprintf(cfg->resultsDir, runConfigValueLength, "%s", "./results");
+	cfg->resultsFormat 		  = 0; // CSV
+	cfg->useCheckpointing 	  = false;
+	cfg->resumeFromCheckpoint = false;
+	snprintf(cfg->checkpointDir, runConfigValueLength, "%s", "./checkpoint");
+	cfg->keyStoreDir[0] 	  = '\0'; // The secret key is not stored
+	cfg->checkpointInterval   = 10;
+	snprintf(cfg->sweepPath, runConfigValueLength, "%s", "./sweep.cfg");
+	snprintf(cfg->sweepOutput, runConfigValueLength, "%s", "./sweep_results.csv");
+}
+
+/*
+	The function for obtaining the active run configuration (the defaults if main did not set one)
+*/
+struct runConfigPLCP * currentRunConfigPLCP(){
+	static struct runConfigPLCP defaultConfig;
+	static bool isDefaultAssigned = false;
+	if(activeRunConfigPLCP != NULL)
+		return activeRunConfigPLCP;
+	if(!isDefaultAssigned){
+		defaultRunConfigPLCP(&defaultConfig);
+		isDefaultAssigned = true;
+	}
+	return &defaultConfig;
+}
+
+/*
+	The function for removing the leading and the trailing white spaces in place
+*/
+static char * trimRunConfigToken(char *token){
+	while(isspace((unsigned char) *token))
+		token++;
+	char *end = token + strlen(token);
+	while(end > token && isspace((unsigned char) end[-1]))
+		end--;
+	*end = '\0';
+	return token;
+}
+
+/*
+	The function for assigning a single key (false if the key is unknown or the value is malformed)
+*/
+bool setRunConfigValuePLCP(struct runConfigPLCP *cfg, const char *key, const char *value){
+
+	// Find the key
+	const struct runConfigKeyPLCP *entry = NULL;
+	for(size_t i = 0; i < numRunConfigKeys; i++){
+		if(strcmp(runConfigKeys[i].key, key) == 0){
+			entry = &runConfigKeys[i];
+			break;
+		}
+	}
+	if(entry == NULL){
+		fprintf(stderr, "Run Config: unknown key '%s'\n", key);
+		return false;
+	}
+
+	// Parse the value into the field
+	char *field = (char *) cfg + entry->offset;
+	char *end 	= NULL;
+	errno 		= 0;
+	switch(entry->type){
+		case RUN_CONFIG_INT:
+			// The named values are accepted as well (e.g., log_level = quiet)
+			if(entry->names != NULL){
+				for(int v = 0; entry->names[v] != NULL; v++){
+					if(strcmp(entry->names[v], value) == 0){
+						*(int *) field = v;
+						return true;
+					}
+				}
+			}
+			*(int *) field = (int) strtol(value, &end, 10);
+			break;
+		case RUN_CONFIG_SIZE:
+			*(size_t *) field = (size_t) strtoull(value, &end, 10);
+			break;
+		case RUN_CONFIG_DOUBLE:
+			*(double *) field = strtod(value, &end);
+			break;
+		case RUN_CONFIG_BOOL:
+			if(strcmp(value, "1") == 0 || strcmp(value, "true") == 0 || strcmp(value, "on") == 0)
+				*(bool *) field = true;
+			else if(strcmp(value, "0") == 0 || strcmp(value, "false") == 0 || strcmp(value, "off") == 0)
+				*(bool *) field = false;
+			else{
+				fprintf(stderr, "Run Config: '%s' is not a boolean for '%s'\n", value, key);
+				return false;
+			}
+			return true;
+		case RUN_CONFIG_STRING:
+			if(strlen(value) >= runConfigValueLength){
+				fprintf(stderr, "Run Config: the value of '%s' is too long\n", key);
+				return false;
+			}
+			snprintf(field, runConfigValueLength, "%s", value);
+			return true;
+	}
+
+	// Reject the numbers with a trailing garbage (e.g., 12x)
+	if(end == value || *end != '\0' || errno != 0){
+		fprintf(stderr, "Run Config: '%s' is not a valid number for '%s'\n", value, key);
+		return false;
+	}
+	return true;
+}
+
+/*
+	The function for reading a configuration file of key = value lines (# starts a comment)
+*/
+bool loadRunConfigFilePLCP(struct runConfigPLCP *cfg, const char *path){
+
+	// Open the configuration file
+	FILE *fp = fopen(path, "r");
+	if(fp == NULL){
+		fprintf(stderr, "Run Config: %s could not be opened\n", path);
+		return false;
+	}
+
+	// Assign each line (every malformed line is reported, then the reading fails)
+	char line[runConfigLineLength];
+	int lineNum = 0;
+	bool isValid = true;
+	while(fgets(line, runConfigLineLength, fp) != NULL){
+		lineNum++;
+		char *comment = strchr(line, '#');
+		if(comment != NULL)
+			*comment = '\0';
+		char *content = trimRunConfigToken(line);
+		if(*content == '\0')
+			continue;
+		char *separator = strchr(content, '=');
+		if(separator == NULL){
+			fprintf(stderr, "Run Config: %s:%d is not a key = value line\n", path, lineNum);
+			isValid = false;
+			continue;
+		}
+		*separator = '\0';
+		if(!setRunConfigValuePLCP(cfg, trimRunConfigToken(content), trimRunConfigToken(separator + 1))){
+			fprintf(stderr, "Run Config: at %s:%d\n", path, lineNum);
+			isValid = false;
+		}
+	}
+	fclose(fp);
+	return isValid;
+}
+
+/*
+	The function for building the run configuration from the defaults, the --config file and the --key=value overrides (false on an error or --help)
+	Note: The configuration file is read first wherever --config appears, thus, the command line always overrides the file
+*/
+bool parseRunConfigPLCP(struct runConfigPLCP *cfg, int argc, char *argv[]){
+
+	// Start from the defaults and read the configuration file
+	defaultRunConfigPLCP(cfg);
+	for(int i = 1; i < argc; i++){
+		if(strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0){
+			printRunConfigUsagePLCP(argv[0]);
+			return false;
+		}
+		const char *configPath = NULL;
+		if(strncmp(argv[i], "--config=", 9) == 0)
+			configPath = argv[i] + 9;
+		else if(strcmp(argv[i], "--config") == 0 && i + 1 < argc)
+			configPath = argv[++i];
+		if(configPath != NULL && !loadRunConfigFilePLCP(cfg, configPath))
+			return false;
+	}
+
+	// Apply the overrides (--key=value or --key value)
+	for(int i = 1; i < argc; i++){
+		if(strncmp(argv[i], "--", 2) != 0){
+			fprintf(stderr, "Run Config: unexpected argument '%s'\n", argv[i]);
+			return false;
+		}
+		char arg[runConfigLineLength];
+		snprintf(arg, runConfigLineLength, "%s", argv[i] + 2);
+		char *separator   = strchr(arg, '=');
+		const char *value = NULL;
+		if(separator != NULL){
+			*separator = '\0';
+			value 	   = separator + 1;
+		}else if(i + 1 < argc){
+			value = argv[++i];
+		}else{
+			fprintf(stderr, "Run Config: missing value of '--%s'\n", arg);
+			return false;
+		}
+		if(strcmp(arg, "config") == 0)
+			continue;
+		if(!setRunConfigValuePLCP(cfg, arg, value))
+			return false;
+	}
+	return validateRunConfigPLCP(cfg);
+}
+
+/*
+	The function for checking the consistency of the run configuration (false if a value is out of its range)
+	Note: The security level of the CKKS parameters is checked by SEAL when the context is created
+*/
+bool validateRunConfigPLCP(struct runConfigPLCP *cfg){
+	bool isValid = true;
+	size_t degree = cfg->polyModulusDegree;
+	if(degree < 1024 || degree > 32768 || (degree & (degree - 1)) != 0){
+		fprintf(stderr, "Run Config: poly_modulus_degree must be a power of two in [1024, 32768]\n");
+		isValid = false;
+	}
+	if(cfg->bitSizeParam < 20 || cfg->bitSizeParam > 60 || cfg->specialBitSize < cfg->bitSizeParam || cfg->specialBitSize > 60){
+		fprintf(stderr, "Run Config: bit_size must be in [20, 60] and special_bit_size in [bit_size, 60]\n");
+		isValid = false;
+	}
+	if(cfg->numMiddlePrimes < 1){
+		fprintf(stderr, "Run Config: num_middle_primes must be positive\n");
+		isValid = false;
+	}
+	if(cfg->numRandBits < 1 || cfg->numRandBits > 30){
+		fprintf(stderr, "Run Config: num_rand_bits must be in [1, 30]\n");
+		isValid = false;
+	}
+	if(cfg->downlinkMagnitudeBits < 1 || cfg->downlinkMagnitudeBits > 40){
+		fprintf(stderr, "Run Config: downlink_magnitude_bits must be in [1, 40]\n");
+		isValid = false;
+	}
+	if(cfg->chebDegEq8 < 2 || cfg->chebDegEq9 < 2){
+		fprintf(stderr, "Run Config: the Chebyshev degrees must be at least 2\n");
+		isValid = false;
+	}
+	if(cfg->lowBoundEq8 >= cfg->upBoundEq8 || cfg->lowBoundEq9 >= cfg->upBoundEq9){
+		fprintf(stderr, "Run Config: the lower bounds must be below the upper bounds\n");
+		isValid = false;
+	}
+	if(cfg->numIter < 1 || cfg->numThreads < 0 || cfg->checkpointInterval < 1){
+		fprintf(stderr, "Run Config: num_iter and checkpoint_interval must be positive, num_threads must not be negative\n");
+		isValid = false;
+	}
+	if(cfg->appxBackendEq8 < 0 || cfg->appxBackendEq8 > 1 || cfg->appxBackendEq9 < 0 || cfg->appxBackendEq9 > 1){
+		fprintf(stderr, "Run Config: appx_eq8 and appx_eq9 must be chebyshev or composite\n");
+		isValid = false;
+	}
+	if(cfg->exampleSelection < 0 || cfg->exampleSelection > 14){
+		fprintf(stderr, "Run Config: example must be in [0, 14]\n");
+		isValid = false;
+	}
+	if((cfg->tiledColTileWidth & (cfg->tiledColTileWidth - 1)) != 0){
+		fprintf(stderr, "Run Config: tiled_col_tile_width must be 0 or a power of two\n");
+		isValid = false;
+	}
+	if(cfg->tiledColTileWidth > 0 && cfg->useFoldedRangeTransform){
+		fprintf(stderr, "Run Config: tiled_col_tile_width does not support folded_range_transform\n");
+		isValid = false;
+	}
+	if(cfg->tiledColTileWidth > 0 && (cfg->appxBackendEq8 != 0 || cfg->appxBackendEq9 != 0)){
+		fprintf(stderr, "Run Config: tiled_col_tile_width only supports the chebyshev appx_eq8 and appx_eq9\n");
+		isValid = false;
+	}
+	if(cfg->tiledColTileWidth > 0 && cfg->useHomomorphicReset){
+		fprintf(stderr, "Run Config: tiled_col_tile_width does not support homomorphic_reset\n");
+		isValid = false;
+	}
+	if(cfg->streamSource < 0 || cfg->streamSource > 2 || cfg->streamRingCapacity < 1){
+		fprintf(stderr, "Run Config: stream_source must be stdin, fifo or tail_binary and stream_ring_capacity must be positive\n");
+		isValid = false;
+	}
+	if(cfg->logLevel < 0 || cfg->logLevel > 2 || cfg->resultsFormat < 0 || cfg->resultsFormat > 1){
+		fprintf(stderr, "Run Config: log_level or results_format is out of range\n");
+		isValid = false;
+	}
+	return isValid;
+}
+
+/*
+	The function for printing the run configuration as a configuration file
+*/
+void printRunConfigPLCP(struct runConfigPLCP *cfg, FILE *fp){
+	for(size_t i = 0; i < numRunConfigKeys; i++){
+		const struct runConfigKeyPLCP *entry = &runConfigKeys[i];
+		char *field = (char *) cfg + entry->offset;
+		switch(entry->type){
+			case RUN_CONFIG_INT:
+				if(entry->names != NULL)
+					fprintf(fp, "%s = %s\n", entry->key, entry->names[*(int *) field]);
+				else
+					fprintf(fp, "%s = %d\n", entry->key, *(int *) field);
+				break;
+			case RUN_CONFIG_SIZE:	fprintf(fp, "%s = %zu\n", entry->key, *(size_t *) field); 			  break;
+			case RUN_CONFIG_DOUBLE:	fprintf(fp, "%s = %.17g\n", entry->key, *(double *) field); 		  break;
+			case RUN_CONFIG_BOOL:	fprintf(fp, "%s = %s\n", entry->key, *(bool *) field ? "true" : "false"); break;
+			case RUN_CONFIG_STRING:	fprintf(fp, "%s = %s\n", entry->key, field); 						  break;
+		}
+	}
+}
+
+/*
+	The function for printing the usage and the keys
+*/
+void printRunConfigUsagePLCP(const char *programName){
+	printf("Usage: %s [--config=FILE] [--key=value ...]\n", programName);
+	printf("The configuration file has a key = value line per key (# starts a comment), the command line overrides the file\n");
+	printf("Keys (default value):\n");
+	struct runConfigPLCP defaults;
+	defaultRunConfigPLCP(&defaults);
+	for(size_t i = 0; i < numRunConfigKeys; i++)
+		printf("  --%-20s %s\n", runConfigKeys[i].key, runConfigKeys[i].help);
+	printf("Defaults:\n");
+	printRunConfigPLCP(&defaults, stdout);
+}
@@ -0,0 +1,116 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the run configuration of the application (i.e., runConfigPLCP.cpp)
+						  The plant data path, the CKKS parameters, the Chebyshev degrees and bounds, the run length, the thread count and the
+						  settings of the online loop are read from a configuration file (key = value lines) and overridden by the command line
+						  (--key=value), so that a parameter sweep does not need a recompilation per data point.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+#ifndef RUNCONFIGPLCP_H
+#define RUNCONFIGPLCP_H
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+
+/* Define the constants */
+#define runConfigValueLength 512
+
+/* Main struct for holding the run configuration (the defaults are the values the application was tuned with) */
+struct runConfigPLCP {
+	// Plant and run length
+	char dataPath[runConfigValueLength];       // The folder of the plant matrices (i.e., Dim.txt, A.txt, ...)
+	int numIter;                               // Number of the online iterations (i.e., tMax)
+	// CKKS parameters
+	size_t polyModulusDegree;                  // The polynomial modulus degree
+	int bitSizeParam;                          // Bit size of the middle primes and of the scale
+	int specialBitSize;                        // Bit size of the first and the last primes
+	int numMiddlePrimes;                       // Number of the middle primes (i.e., the multiplicative depth)
+	int numRandBits;                           // Bit size of the random masks of the secret sharing
+	// Chebyshev approximations of the CUSUM stage
+	int chebDegEq8;                            // Degree of the max (RELU) approximation
+	int chebDegEq9;                            // Degree of the subtraction-based indicator approximation
+	double lowBoundEq8, upBoundEq8;            // The approximation interval [a, b] of Eq8
+	double lowBoundEq9, upBoundEq9;            // The approximation interval [a, b] of Eq9
+	// Approximation backends of the CUSUM stage (see cusumAppxBackendPLCP)
+	int appxBackendEq8;                        // 0: Chebyshev, 1: composite sign
+	int appxBackendEq9;
+	char signStagesEq8[runConfigValueLength];  // The stages of the composite sign approximation (e.g., g3,f1, the innermost stage first)
+	char signStagesEq9[runConfigValueLength];
+	bool useFoldedRangeTransform;              // Fold the Chebyshev range transformations into the linear stages (one level less, n - 1 rotations in Eq4-5)
+	// Backends of the online loop
+	bool useDiagonalPacking;                   // The diagonal (Halevi-Shoup) packing format instead of the MRP
+	bool useHomomorphicReplication;            // Replicate x^e in the server instead of the re-arranging secret share (refreshed only at the masked downlink level)
+	bool useConstantsRegistry;                 // Take the per-level copies of the registered constants instead of encoding them again
+	bool useComplexTilePacking;                // Pair the row tiles of the tiled layout in the complex slots (M_r + i * M_r+1) in the linear stages
+	size_t tiledColTileWidth;                  // The column tile width of the tiled layout (0: the tiled layout only runs when the MRP layout overflows)
+	// Streaming ingestion (the online loop is driven by the live y vectors instead of the simulated plant)
+	bool useStreamingIngestion;
+	int streamSource;                          // See streamSourcePLCP
+	char streamPath[runConfigValueLength];     // The FIFO or the tailed binary file (not used for stdin)
+	size_t streamRingCapacity;                 // The y vectors buffered between the source and the online loop
+	// CUSUM reset of Eq10
+	bool useHomomorphicReset;                  // s[k + 1] = s̄[k + 1] ⊙ (1 − alarm[k]) under encryption (false: the alarm is decrypted and rounded)
+	// Uplink (the sensor measurements encrypted by the client)
+	bool useLevelTargetedSensing;              // Encrypt y at the level of its first use instead of the top of the chain
+	// Downlink (the ciphertexts decrypted by the key holder)
+	bool useDownlinkModSwitch;                 // Mod-switch the outbound ciphertexts to the lowest level holding their values
+	int downlinkMagnitudeBits;                 // Bit size bound of the unmasked outbound values (i.e., |value| < 2^bits)
+	bool useRotationLevelPlanning;             // Mod-switch the sums of Eq2-3-4_5 down to the lowest levels serving their consumers before the rotate-and-sum
+	// Execution
+	int numThreads;                            // Worker threads (0: the hardware concurrency)
+	int exampleSelection;                      // The example run without the console menu (0: the console menu)
+	int logLevel;                              // The console verbosity (see logLevelPLCP)
+	// Result reporting (the decryptions of y, u, alarm and s which are only reported)
+	bool useResultReporting;
+	bool useAsyncReporting;                    // Hand the reporting decryptions to a background worker
+	// Results writer
+	bool useResultsWriter;
+	char resultsDir[runConfigValueLength];
+	int resultsFormat;                         // See resultsFormatPLCP
+	// Checkpoints
+	bool useCheckpointing;
+	bool resumeFromCheckpoint;
+	char checkpointDir[runConfigValueLength];
+	char keyStoreDir[runConfigValueLength];    // The separate store of the secret key (empty: the secret key is not stored and a checkpoint cannot be resumed)
+	int checkpointInterval;
+	// Parameter sweep
+	char sweepPath[runConfigValueLength];      // The grid file of the parameter sweep (key = value, value, ... lines)
+	char sweepOutput[runConfigValueLength];    // The CSV file of the measured sweep points
+};
+
+/* The run configuration set by main (NULL: the defaults are used) */
+extern struct runConfigPLCP *activeRunConfigPLCP;
+
+/* The function for assigning the default run configuration */
+void defaultRunConfigPLCP(struct runConfigPLCP *cfg);
+
+/* The function for obtaining the active run configuration (the defaults if main did not set one) */
+struct runConfigPLCP * currentRunConfigPLCP();
+
+/* The function for assigning a single key (false if the key is unknown or the value is malformed) */
+bool setRunConfigValuePLCP(struct runConfigPLCP *cfg, const char *key, const char *value);
+
+/* The function for reading a configuration file of key = value lines (# starts a comment) */
+bool loadRunConfigFilePLCP(struct runConfigPLCP *cfg, const char *path);
+
+/* The function for building the run configuration from the defaults, the --config file and the --key=value overrides (false on an error or --help) */
+bool parseRunConfigPLCP(struct runConfigPLCP *cfg, int argc, char *argv[]);
+
+/* The function for checking the consistency of the run configuration (false if a value is out of its range) */
+bool validateRunConfigPLCP(struct runConfigPLCP *cfg);
+
+/* The function for printing the run configuration as a configuration file */
+void printRunConfigPLCP(struct runConfigPLCP *cfg, FILE *fp);
+
+/* The function for printing the usage and the keys */
+void printRunConfigUsagePLCP(const char *programName);
+
+#endif
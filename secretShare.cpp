@@ -15,6 +15,7 @@
 #include "plcpOperations.h"       // The class containing the functions which does Ciphertext-Ciphertext and Plaintext-Ciphertext arithmetic and algebraic operations  	    
 #include "encryptedAppx.h"        // The class containing the functions which does the Chebyshev approximation with different assumptions     
 #include "secretShare.h" 		  // The class containing the functions which does the secret sharing  
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
 
 /* Import the important selected C libraries*/
 #include <array>
@@ -31,9 +32,6 @@
 #include <time.h>
 #include <unistd.h>
 
-/* Define the constant */
-#define numRandBits 20
-
 /* Call main namespaces */
 using namespace std;
 using namespace seal;
@@ -61,7 +59,7 @@ void secretShare(
 		for (size_t  i = 0; i < x_vector_repeat * calculated_x_row_sizeVal; i++){				
 			if(i < calculated_x_row_sizeVal){
 				if(i < x_vector_col_size) {
-					int randomNumSamplingInterval = pow(2, numRandBits);   // 4194304; // 134217728; // 4194304; // 500; // 4294967296;
+					int randomNumSamplingInterval = pow(2, currentRunConfigPLCP()->numRandBits);   // 4194304; // 134217728; // 4194304; // 500; // 4294967296;
 					double ran 	 	= rand() % randomNumSamplingInterval;		
 					rand_double_sub[i] 	= ran;				 
 				}else{
@@ -102,6 +100,8 @@ void secretShare(
 		/* 
 		**	Decrpyt, obtain index sums, and add trailing zeros to each row segment 
 		*/
+		// Send the noise added vector at the lowest level holding the masked values
+		modSwitchDownlinkPLCP(x_Random_Noise_AddedPtr, x_Random_Noise_AddedPtr, true, scale, contextPtr, evaluatorPtr);
 		// Decrypt the noise added vector 							 			
 		Plaintext plain_SecretShare_Decrypt_Result;	
 		vector<double> decryptedVec;
@@ -162,7 +162,7 @@ void secretSharev2(
 		// Create cleartext random vector for the initial addition
 		vector<double> rand_double_add(x_vector_repeat * calculated_x_row_sizeVal);		
 		for (size_t  i = 0; i < x_vector_repeat * calculated_x_row_sizeVal; i++){	
-			int randomNumSamplingInterval = pow(2, numRandBits);   // 4194304; // 134217728; // 4194304; // 500; // 4294967296;
+			int randomNumSamplingInterval = pow(2, currentRunConfigPLCP()->numRandBits);   // 4194304; // 134217728; // 4194304; // 500; // 4294967296;
 			double ran 	 	= rand() % randomNumSamplingInterval;
 			rand_double_add[i] = ran;					
 		}
@@ -193,6 +193,8 @@ void secretSharev2(
 		/* 
 		**	Decrpyt, and add trailing zeros to each row segment 
 		*/
+		// Send the noise added vector at the lowest level holding the masked values
+		modSwitchDownlinkPLCP(x_Random_Noise_AddedPtr, x_Random_Noise_AddedPtr, true, scale, contextPtr, evaluatorPtr);
 		// Decrypt the noise added vector 							 			
 		Plaintext plain_SecretShare_Decrypt_Result;	
 		vector<double> decryptedVec;
@@ -238,7 +240,7 @@ void secretShareCUSUMParamSum(
 		// Create cleartext random Noise vector for the initial addition
 		vector<double> rand_double_add(x_vector_repeat * calculated_x_row_sizeVal);		
 		for (size_t  i = 0; i < x_vector_repeat * calculated_x_row_sizeVal; i++){				
-			int randomNumSamplingInterval = pow(2, numRandBits);   // 4194304; // 134217728; // 4194304; // 500; // 4294967296;
+			int randomNumSamplingInterval = pow(2, currentRunConfigPLCP()->numRandBits);   // 4194304; // 134217728; // 4194304; // 500; // 4294967296;
 			double ran = rand() % randomNumSamplingInterval;		
 			rand_double_add[i] = ran;					
 		}
@@ -269,6 +271,8 @@ void secretShareCUSUMParamSum(
 		/* 
 		**	Decrpyt, do the eventual subtraction, and assign the fresh (or recrypted) vector 
 		*/	
+		// Send the noise added vector at the lowest level holding the masked values
+		modSwitchDownlinkPLCP(x_Random_Noise_AddedPtr, x_Random_Noise_AddedPtr, true, scale, contextPtr, evaluatorPtr);
 		// Decrypt the noise added vector 							 			
 		Plaintext plain_SecretShare_Decrypt_Result;	
 		vector<double> decryptedVec;
@@ -311,7 +315,7 @@ void secretShareEstimation(
 		for (size_t  i = 0; i < x_vector_repeat * calculated_x_row_sizeVal; i++){				
 			if(i < calculated_x_row_sizeVal){
 				if(i < x_vector_col_size) {
-					int randomNumSamplingInterval = pow(2, numRandBits);   // 4194304; // 134217728; // 4194304; // 500; // 4294967296;
+					int randomNumSamplingInterval = pow(2, currentRunConfigPLCP()->numRandBits);   // 4194304; // 134217728; // 4194304; // 500; // 4294967296;
 					double ran = rand() % randomNumSamplingInterval;		
 					rand_double_sub[i] 	= ran;				 
 				}else{
@@ -352,6 +356,8 @@ void secretShareEstimation(
 		/* 
 		**	Decrpyt, re-arrange the estimation vector, add trailing zeros to each row segment, and encrypt the already-index-summed vector 
 		*/	
+		// Send the noise added vector at the lowest level holding the masked values
+		modSwitchDownlinkPLCP(x_Random_Noise_AddedPtr, x_Random_Noise_AddedPtr, true, scale, contextPtr, evaluatorPtr);
 		// Decrypt the noise added vector 							 			
 		Plaintext plain_SecretShare_Decrypt_Result;	
 		vector<double> decryptedVec;
@@ -0,0 +1,246 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the reusable cleartext buffers of the online loop
+						  sense_Encrypt_y, applyXVecNoiseAddition and applyEquation_10_PLCP take their buffers from the active session, thus,
+						  no cleartext buffer is allocated in the steady-state iterations. Without an active session, a local session is created
+						  and released on return (i.e., the functions never leak their buffers).
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "generateplaintextMRP.h" // The functions used to prepare plain matrices in MRP format
+#include "prepareVecMatMRP.h"     // The class which prepares the read matrices in MRP format
+#include "initializationPLCP.h"   // The class containing the functions which convert the prepared matrices to Plaintext and Ciphertext objects.
+#include "applyPLCPSimulation.h"  // The class containing the crypto application functions for each targeted equation
+#include "tiledMRP.h"             // The class containing the multi-ciphertext tiled MRP layout
+#include "sessionPLCP.h"          // The class containing the reusable cleartext buffers of the online loop
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* The active session used by the per-iteration functions */
+struct sessionPLCP *activeSessionPLCP = NULL;
+
+/*
+	The function for allocating a column vector (i.e., [numRows][1]) in the double pointer format of rawplain.cpp
+*/
+double ** allocColumnVectorSession(int numRows){
+	double ** vec = (double **) calloc(numRows, sizeof(double *));
+	for(int i = 0; i < numRows; i++)
+		vec[i] = (double *) calloc(1, sizeof(double));
+	return vec;
+}
+
+/*
+	The function for creating a session with the given row and entry capacities
+*/
+void create_SessionPLCP(struct sessionPLCP *session, int maxRows, int maxInputs, size_t maxEntries){
+
+	// Assign the capacities
+	session->maxRows 	= maxRows;
+	session->maxInputs  = maxInputs;
+	session->maxEntries = maxEntries;
+
+	// Sensor measurement buffers
+	session->ySensorData 	= allocColumnVectorSession(maxRows);
+	session->ySensorDataRep = new vector<double>();
+	session->ySensorDataZer = new vector<double>();
+	session->ySensorDataRep->reserve(maxEntries);
+	session->ySensorDataZer->reserve(maxEntries);
+	session->yTilesRep 		= new vector<vector<double>>();
+	session->yTilesZer 		= new vector<vector<double>>();
+
+	// Process noise addition buffers
+	session->Axk 			  = allocColumnVectorSession(maxRows);
+	session->u 				  = allocColumnVectorSession(maxInputs);
+	session->Bu 			  = allocColumnVectorSession(maxRows);
+	session->xSpecNoise 	  = allocColumnVectorSession(maxRows);
+	session->AxkBuNoise 	  = allocColumnVectorSession(maxRows);
+	session->controlAction_PL = new Plaintext();
+	session->controlRes 	  = new vector<double>();
+
+	// CUSUM reset buffer
+	session->CUSUMParamSumMultiplicator = (int *) calloc(maxRows, sizeof(int));
+}
+
+/*
+	The function for freeing the buffers of a session
+*/
+void free_SessionPLCP(struct sessionPLCP *session){
+
+	// Free the column vectors
+	freeMatrix(session->ySensorData, session->maxRows);
+	freeMatrix(session->Axk, session->maxRows);
+	freeMatrix(session->u, session->maxInputs);
+	freeMatrix(session->Bu, session->maxRows);
+	freeMatrix(session->xSpecNoise, session->maxRows);
+	freeMatrix(session->AxkBuNoise, session->maxRows);
+	// Free the MRP vectors, the plaintext and the multiplicator
+	delete session->ySensorDataRep;
+	delete session->ySensorDataZer;
+	delete session->yTilesRep;
+	delete session->yTilesZer;
+	delete session->controlAction_PL;
+	delete session->controlRes;
+	free(session->CUSUMParamSumMultiplicator);
+}
+
+/*
+	The function for handing out the active session if it covers the requested capacities (otherwise the local fallback is created and returned)
+*/
+struct sessionPLCP * acquireSessionPLCP(struct sessionPLCP *localFallback, int numRows, int numInputs, size_t numEntries){
+
+	// Use the active session if it is large enough
+	if(activeSessionPLCP != NULL && activeSessionPLCP->maxRows >= numRows && activeSessionPLCP->maxInputs >= numInputs && activeSessionPLCP->maxEntries >= numEntries)
+		return activeSessionPLCP;
+
+	// Create the local session otherwise
+	create_SessionPLCP(localFallback, numRows, numInputs, numEntries);
+	return localFallback;
+}
+
+/*
+	The function for releasing a handed out session (only the local fallback is freed)
+*/
+void releaseSessionPLCP(struct sessionPLCP *session, struct sessionPLCP *localFallback){
+	if(session == localFallback)
+		free_SessionPLCP(localFallback);
+}
+
+/*
+	The function for reading the resident set size of the process in KB (-1 if /proc/self/statm is not readable)
+*/
+long readResidentSetSizeKB(){
+
+	// The 2nd field of /proc/self/statm is the number of the resident pages
+	long totalPages = 0, residentPages = 0;
+	FILE * fp = fopen("/proc/self/statm", "r");
+	if(fp == NULL)
+		return -1;
+	if(fscanf(fp, "%ld %ld", &totalPages, &residentPages) != 2)
+		residentPages = -1;
+	fclose(fp);
+	if(residentPages < 0)
+		return -1;
+	return residentPages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+/*
+	The function for running the per-iteration cleartext and encryption functions of the online loop many times and tracking the resident set size
+	Note: Each cycle reads the plant model, runs the sensor measurement, the process noise addition and the CUSUM reset (10th equation) with an active
+		  session and releases everything, so both the per-iteration and the per-run buffers are covered. A smaller context (N = 8192) is used since
+		  the homomorphic equations are not the subject of the benchmark. The RSS after the warm-up cycle is expected to stay flat.
+*/
+void example_soak_benchmark(){
+
+	// Print the introduction banner
+	print_example_banner("Example: Online Loop Soak Benchmark (Resident Set Size)");
+
+	// Create the CKKS context and the keys
+	EncryptionParameters parms(scheme_type::ckks);
+	size_t poly_modulus_degree = 8192;
+	int bitsizesparam 		   = 40;
+	parms.set_poly_modulus_degree(poly_modulus_degree);
+	parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, {60, bitsizesparam, bitsizesparam, 60}));
+	SEALContext context(parms);
+	KeyGenerator keygen(context);
+	SecretKey secret_key = keygen.secret_key();
+	PublicKey public_key;
+	keygen.create_public_key(public_key);
+	RelinKeys relin_keys;
+	keygen.create_relin_keys(relin_keys);
+	GaloisKeys gal_keys;
+	Encryptor encryptor(context, public_key);
+	Evaluator evaluator(context);
+	Decryptor decryptor(context, secret_key);
+	CKKSEncoder encoder(context);
+	double scale = pow(2.0, bitsizesparam);
+
+	// Run the soak cycles
+	char * folderPath_y50_u10 = currentRunConfigPLCP()->dataPath; // The configured plant (default: ./all_data/y50_u10)
+	int numCycles 		= 4;
+	int numIterPerCycle = 500;
+	int printInterval 	= 100;
+	long rssWarmUp 		= -1;
+	printf("Start RSS: %ld KB\n", readResidentSetSizeKB());
+	printf("Cycle,Iteration,RSS (KB)\n");
+	for(int c = 0; c < numCycles; c++){
+
+		// Read the plant model and prepare the MRP format
+		struct simulationMatrixData * smd = (struct simulationMatrixData *) calloc(1, sizeof(struct simulationMatrixData));
+		create_SimulationMatrixData(smd);
+		assignValMatrixDatabyFileRead(smd, folderPath_y50_u10);
+		initRemainVec(smd);
+		assignCUSUMChebyshevAppxParams(smd);
+		struct simulationMatrixMRP *smrp = (struct simulationMatrixMRP *) calloc(1, sizeof(struct simulationMatrixMRP));
+		create_SimulationMatrixDataMRP(smd, smrp);
+		assignValMatrixDataMRP(smd, smrp);
+		if(isMRPLayoutOverflowed(smrp, encoder.slot_count())){
+			printf("MRP Layout Overflow: n * N = %d > %zu slots, the soak benchmark needs a single ciphertext MRP layout\n", smrp->n * smrp->N, encoder.slot_count());
+			exit(0);
+		}
+
+		// Create the session of the cycle
+		struct sessionPLCP * session = (struct sessionPLCP *) calloc(1, sizeof(struct sessionPLCP));
+		create_SessionPLCP(session, smrp->n, smrp->m, (size_t) smrp->n * smrp->N);
+		activeSessionPLCP = session;
+
+		// Keep the initial state (the state is restored after each noise addition since the decrypted y stands in for the control action)
+		double * x0 = (double *) calloc(smd->n, sizeof(double));
+		for(int i = 0; i < smd->n; i++)
+			x0[i] = smd->xx[i][0];
+
+		// The CUSUM inputs of the 10th equation (s̄ = s[0], alarm = 0)
+		vector<double> zeroAlarm((size_t) smrp->n * smrp->N, 0);
+		Ciphertext yy_CP, yyAS_CP, ss_CP, alarm_CP, vecOne_CP, tenthEqRes_CP;
+		encryptXVectorMatRowPacking(smrp->ss_MRP, scale, &ss_CP, &encryptor, &encoder);
+		encryptXVectorMatRowPacking(&zeroAlarm, scale, &alarm_CP, &encryptor, &encoder);
+		encryptXVectorMatRowPacking(smrp->One_MRP, scale, &vecOne_CP, &encryptor, &encoder);
+
+		// Per-iteration functions of the online loop
+		for(int it = 0; it < numIterPerCycle; it++){
+			int k = it % smd->tMax;
+			sense_Encrypt_y(smd, smrp, k, &yy_CP, &yyAS_CP, parms_id_zero, parms_id_zero, scale, &context, &encryptor, &encoder);
+			applyXVecNoiseAddition(&yyAS_CP, k, smrp, smd, scale, &context, &encryptor, &evaluator, &decryptor, &encoder);
+			for(int i = 0; i < smd->n; i++)
+				smd->xx[i][0] = x0[i];
+			applyEquation_10_PLCP(&tenthEqRes_CP, smrp, &ss_CP, &alarm_CP, &vecOne_CP, scale, &context, &encryptor, &evaluator, &decryptor, &encoder, &relin_keys, &gal_keys);
+			if((it + 1) % printInterval == 0)
+				printf("%d,%d,%ld\n", c, it + 1, readResidentSetSizeKB());
+		}
+
+		// Release the session and the plant model of the cycle
+		activeSessionPLCP = NULL;
+		free_SessionPLCP(session);
+		free(session);
+		free(x0);
+		free_SimulationMatrixDataMRP(smrp);
+		free(smrp);
+		free_SimulationMatrixData(smd);
+		free(smd);
+		long rssCycle = readResidentSetSizeKB();
+		printf("Cycle %d released: RSS = %ld KB\n", c, rssCycle);
+		if(c == 0)
+			rssWarmUp = rssCycle;
+	}
+
+	// Print the growth after the warm-up cycle (expected to be around zero)
+	long rssEnd = readResidentSetSizeKB();
+	int numMeasuredIter = (numCycles - 1) * numIterPerCycle;
+	printf("Soak Benchmark: RSS growth after the warm-up cycle = %ld KB over %d iterations (%f KB per 1000 iterations)\n",
+		rssEnd - rssWarmUp, numMeasuredIter, (double) (rssEnd - rssWarmUp) * 1000 / numMeasuredIter);
+}
@@ -0,0 +1,70 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the reusable cleartext buffers of the online loop (i.e., sessionPLCP.cpp)
+						  The per-iteration cleartext buffers of the sensor measurement, the process noise addition and the 10th equation are
+						  allocated once per session (i.e., per simulation run) and released together, so that the resident memory stays flat.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+#ifndef SESSIONPLCP_H
+#define SESSIONPLCP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <vector>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Main struct for holding the reusable cleartext buffers of an online loop session */
+struct sessionPLCP {
+	int maxRows;                        // Row capacity of the column vectors (i.e., the number of states n)
+	int maxInputs;                      // Row capacity of the control action vector (i.e., the number of inputs m)
+	size_t maxEntries;                  // Entry capacity of the MRP vectors (i.e., n * N)
+	// Sensor measurement (sense_Encrypt_y)
+	double ** ySensorData;              // Noisy sensor measurement [maxRows][1]
+	vector<double> * ySensorDataRep;    // Repeated y in MRP (i.e., Ly)
+	vector<double> * ySensorDataZer;    // y at the first index of the row segments in MRP (i.e., the residues)
+	vector<vector<double>> * yTilesRep; // Replicated y column tiles in the tiled MRP (sense_Encrypt_y_Tiled)
+	vector<vector<double>> * yTilesZer; // y row tiles at the first index of the row segments in the tiled MRP
+	// Process noise addition (applyXVecNoiseAddition)
+	double ** Axk;                      // A * x[k] [maxRows][1]
+	double ** u;                        // Decrypted control action [maxInputs][1]
+	double ** Bu;                       // B * u[k] [maxRows][1]
+	double ** xSpecNoise;               // Process noise of the iteration [maxRows][1]
+	double ** AxkBuNoise;               // x[k + 1] [maxRows][1]
+	Plaintext * controlAction_PL;       // Decrypted control action plaintext
+	vector<double> * controlRes;        // Decoded control action
+	// CUSUM reset (applyEquation_10_PLCP)
+	int * CUSUMParamSumMultiplicator;   // Zero where alarm = 1 [maxRows]
+};
+
+/* The active session used by the per-iteration functions (NULL: the functions use a local session released on return) */
+extern struct sessionPLCP *activeSessionPLCP;
+
+/* The function for creating a session with the given row and entry capacities */
+void create_SessionPLCP(struct sessionPLCP *session, int maxRows, int maxInputs, size_t maxEntries);
+
+/* The function for freeing the buffers of a session */
+void free_SessionPLCP(struct sessionPLCP *session);
+
+/* The function for handing out the active session if it covers the requested capacities (otherwise the local fallback is created and returned) */
+struct sessionPLCP * acquireSessionPLCP(struct sessionPLCP *localFallback, int numRows, int numInputs, size_t numEntries);
+
+/* The function for releasing a handed out session (only the local fallback is freed) */
+void releaseSessionPLCP(struct sessionPLCP *session, struct sessionPLCP *localFallback);
+
+/* The function for reading the resident set size of the process in KB (-1 if /proc/self/statm is not readable) */
+long readResidentSetSizeKB();
+
+/* The function for running the per-iteration cleartext and encryption functions of the online loop many times and tracking the resident set size */
+void example_soak_benchmark();
+
+#endif
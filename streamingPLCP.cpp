@@ -0,0 +1,285 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the streaming ingestion of the sensor measurements
+						  The producer publishes a y vector by advancing the head (release) after copying it, and the consumer frees the slot by
+						  advancing the tail (release) after copying it out, so no lock is needed between the two threads.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+						  # SPSC: Single-producer single-consumer
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "streamingPLCP.h"        // The class containing the streaming ingestion of the sensor measurements
+
+/* Import the important selected C libraries*/
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Define the constants */
+#define streamWaitMicroSec 100   // Sleep of a waiting push or pop
+#define streamTailPollMilliSec 10 // Poll interval of the tailed binary file
+#define streamTextPollMilliSec 50 // Poll timeout of stdin and the FIFO (i.e., the bound on the stop latency of an idle source)
+#define streamTextChunkBytes 4096 // Bytes read from stdin or the FIFO at once
+
+/*
+	The function for creating a ring of at least the given number of the y vectors (rounded up to a binary power)
+*/
+void create_StreamRingPLCP(struct streamRingPLCP *ring, int n, size_t capacity){
+
+	// Round the capacity up to a binary power
+	size_t roundedCapacity = 2;
+	while(roundedCapacity < capacity)
+		roundedCapacity *= 2;
+
+	// Allocate the slots and the shared counters
+	ring->n 			= n;
+	ring->capacity 		= roundedCapacity;
+	ring->slots 		= (double *) calloc(roundedCapacity * n, sizeof(double));
+	ring->head 			= new atomic<size_t>(0);
+	ring->tail 			= new atomic<size_t>(0);
+	ring->isClosed 		= new atomic<bool>(false);
+	ring->numFullStalls = new atomic<size_t>(0);
+	ring->highWaterMark = new atomic<size_t>(0);
+	ring->numMalformed 	= new atomic<size_t>(0);
+	ring->numEmptyWaits = 0;
+}
+
+/*
+	The function for freeing the buffers of a ring
+*/
+void free_StreamRingPLCP(struct streamRingPLCP *ring){
+	free(ring->slots);
+	delete ring->head;
+	delete ring->tail;
+	delete ring->isClosed;
+	delete ring->numFullStalls;
+	delete ring->highWaterMark;
+	delete ring->numMalformed;
+}
+
+/*
+	The function for pushing a y vector (waits while the ring is full, false if the stop is requested while waiting)
+*/
+bool pushStreamRingPLCP(struct streamRingPLCP *ring, double *y, atomic<bool> *stopRequested){
+
+	// Wait for a free slot (backpressure: the stall is counted once per push)
+	size_t head 	= ring->head->load(memory_order_relaxed);
+	bool isStalled 	= false;
+	while(head - ring->tail->load(memory_order_acquire) == ring->capacity){
+		if(!isStalled){
+			ring->numFullStalls->fetch_add(1, memory_order_relaxed);
+			isStalled = true;
+		}
+		if(stopRequested->load(memory_order_relaxed))
+			return false;
+		this_thread::sleep_for(chrono::microseconds(streamWaitMicroSec));
+	}
+
+	// Copy the y vector and publish it
+	memcpy(&ring->slots[(head & (ring->capacity - 1)) * ring->n], y, ring->n * sizeof(double));
+	ring->head->store(head + 1, memory_order_release);
+
+	// Update the high water mark (only written by the producer)
+	size_t occupancy = head + 1 - ring->tail->load(memory_order_acquire);
+	if(occupancy > ring->highWaterMark->load(memory_order_relaxed))
+		ring->highWaterMark->store(occupancy, memory_order_relaxed);
+	return true;
+}
+
+/*
+	The function for popping a y vector (waits while the ring is empty, false at the end of the stream)
+*/
+bool popStreamRingPLCP(struct streamRingPLCP *ring, double *y){
+
+	// Wait for a y vector (the stream ends when the producer is closed and the ring is drained)
+	size_t tail   = ring->tail->load(memory_order_relaxed);
+	bool isWaited = false;
+	while(ring->head->load(memory_order_acquire) == tail){
+		if(ring->isClosed->load(memory_order_acquire) && ring->head->load(memory_order_acquire) == tail)
+			return false;
+		if(!isWaited){
+			ring->numEmptyWaits++;
+			isWaited = true;
+		}
+		this_thread::sleep_for(chrono::microseconds(streamWaitMicroSec));
+	}
+
+	// Copy the y vector out and free its slot
+	memcpy(y, &ring->slots[(tail & (ring->capacity - 1)) * ring->n], ring->n * sizeof(double));
+	ring->tail->store(tail + 1, memory_order_release);
+	return true;
+}
+
+/*
+	The function for printing the occupancy and the backpressure statistics of a ring
+*/
+void printStreamRingPLCP(struct streamRingPLCP *ring){
+	size_t head = ring->head->load(memory_order_acquire);
+	size_t tail = ring->tail->load(memory_order_acquire);
+	printf("Stream Ring: Occupancy %zu/%zu, High Water Mark %zu, Pushed %zu, Popped %zu, Full Stalls %zu, Empty Waits %zu, Malformed %zu\n",
+		head - tail, ring->capacity, ring->highWaterMark->load(memory_order_relaxed), head, tail,
+		ring->numFullStalls->load(memory_order_relaxed), ring->numEmptyWaits, ring->numMalformed->load(memory_order_relaxed));
+}
+
+/*
+	The function for parsing a text record into a y vector and pushing it (false if the stop is requested while waiting)
+*/
+bool pushTextRecordPLCP(struct streamIngestionPLCP *si, char *line, double *y){
+	int numEntries = 0;
+	char * rest    = line;
+	char * token;
+	while((token = strtok_r(rest, " ,\t\r\n", &rest)) && numEntries < si->ring->n)
+		y[numEntries++] = atof(token);
+	// Skip the empty and the malformed lines
+	if(numEntries == 0)
+		return true;
+	if(numEntries != si->ring->n || token != NULL){
+		si->ring->numMalformed->fetch_add(1, memory_order_relaxed);
+		return true;
+	}
+	return pushStreamRingPLCP(si->ring, y, si->stopRequested);
+}
+
+/*
+	The function for reading the text records (a y vector per line) of stdin or a FIFO until the end of file
+	Note: The descriptor is polled with a timeout instead of a blocking read, so the stop request is seen while the source is idle
+*/
+void readTextStreamPLCP(struct streamIngestionPLCP *si, int fd, double *y){
+
+	// The partial line is carried over the chunks
+	char chunk[streamTextChunkBytes];
+	size_t lineCapacity = streamTextChunkBytes;
+	size_t lineLength 	= 0;
+	char * line 		= (char *) malloc(lineCapacity);
+	bool isPushed 		= true;
+	while(isPushed && !si->stopRequested->load(memory_order_relaxed)){
+		// Wait for the data (or the end of file) at most a poll interval
+		struct pollfd pfd = {fd, POLLIN, 0};
+		int numReady = poll(&pfd, 1, streamTextPollMilliSec);
+		if(numReady == 0 || (numReady < 0 && errno == EINTR))
+			continue;
+		if(numReady < 0)
+			break;
+		ssize_t numRead = read(fd, chunk, streamTextChunkBytes);
+		if(numRead < 0 && (errno == EAGAIN || errno == EINTR))
+			continue;
+		if(numRead <= 0)
+			break;
+		// Split the chunk into the lines
+		for(ssize_t i = 0; i < numRead && isPushed; i++){
+			if(lineLength + 1 == lineCapacity){
+				lineCapacity *= 2;
+				line = (char *) realloc(line, lineCapacity);
+			}
+			if(chunk[i] != '\n'){
+				line[lineLength++] = chunk[i];
+				continue;
+			}
+			line[lineLength] = '\0';
+			isPushed   = pushTextRecordPLCP(si, line, y);
+			lineLength = 0;
+		}
+	}
+
+	// The last line may not be terminated
+	if(isPushed && lineLength > 0 && !si->stopRequested->load(memory_order_relaxed)){
+		line[lineLength] = '\0';
+		pushTextRecordPLCP(si, line, y);
+	}
+	free(line);
+}
+
+/*
+	The function for following a binary file (n doubles per y vector) until the ingestion is stopped
+	Note: A partially written record is read again after the poll interval, so the writer may append the records in pieces
+*/
+void readTailBinaryStreamPLCP(struct streamIngestionPLCP *si, double *y){
+
+	// Wait for the file to be created
+	FILE * fp = NULL;
+	while(!si->stopRequested->load(memory_order_relaxed) && (fp = fopen(si->path, "rb")) == NULL)
+		this_thread::sleep_for(chrono::milliseconds(streamTailPollMilliSec));
+	if(fp == NULL)
+		return;
+
+	// Follow the file record by record
+	long recordStart = 0;
+	long recordBytes = (long) (si->ring->n * sizeof(double));
+	while(!si->stopRequested->load(memory_order_relaxed)){
+		size_t numRead = fread(y, sizeof(double), si->ring->n, fp);
+		if(numRead == (size_t) si->ring->n){
+			if(!pushStreamRingPLCP(si->ring, y, si->stopRequested))
+				break;
+			recordStart += recordBytes;
+			continue;
+		}
+		// No complete record yet: go back to the start of the record and wait for the writer
+		clearerr(fp);
+		fseek(fp, recordStart, SEEK_SET);
+		this_thread::sleep_for(chrono::milliseconds(streamTailPollMilliSec));
+	}
+	fclose(fp);
+}
+
+/*
+	The function for running the producer (i.e., reading the source into the ring and closing the ring at the end)
+*/
+void runStreamProducerPLCP(struct streamIngestionPLCP *si){
+
+	// Read the selected source
+	double * y = (double *) calloc(si->ring->n, sizeof(double));
+	if(si->source == STREAM_SOURCE_STDIN){
+		readTextStreamPLCP(si, STDIN_FILENO, y);
+	}else if(si->source == STREAM_SOURCE_FIFO){
+		int fd = open(si->path, O_RDONLY | O_NONBLOCK); // Does not wait for a writer (the poll waits until a writer connects)
+		if(fd < 0)
+			printf("Stream Ingestion: the FIFO %s could not be opened\n", si->path);
+		else{
+			readTextStreamPLCP(si, fd, y);
+			close(fd);
+		}
+	}else{
+		readTailBinaryStreamPLCP(si, y);
+	}
+	free(y);
+
+	// Close the ring (the consumer drains the remaining y vectors)
+	si->ring->isClosed->store(true, memory_order_release);
+}
+
+/*
+	The function for starting the producer thread reading the given source into the ring
+*/
+void startStreamIngestionPLCP(struct streamIngestionPLCP *si, struct streamRingPLCP *ring, enum streamSourcePLCP source, const char *path){
+	si->ring 		  = ring;
+	si->source 		  = source;
+	si->path 		  = path;
+	si->stopRequested = new atomic<bool>(false);
+	si->producer 	  = new thread(runStreamProducerPLCP, si);
+}
+
+/*
+	The function for stopping and joining the producer thread (an idle stdin or FIFO producer returns within a poll interval)
+*/
+void stopStreamIngestionPLCP(struct streamIngestionPLCP *si){
+	si->stopRequested->store(true, memory_order_relaxed);
+	si->producer->join();
+	delete si->producer;
+	delete si->stopRequested;
+}
@@ -0,0 +1,91 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the streaming ingestion of the sensor measurements (i.e., streamingPLCP.cpp)
+						  A producer thread reads the y vectors from stdin, a FIFO or a tailed binary file into a lock-free single-producer
+						  single-consumer ring, and the online loop consumes them one per iteration. The ring has a fixed capacity, thus, a slow
+						  online loop stalls the producer (and the writer of the pipe) instead of growing the memory.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+						  # SPSC: Single-producer single-consumer
+*/
+
+#ifndef STREAMINGPLCP_H
+#define STREAMINGPLCP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+
+/* Import the important selected C libraries*/
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* The sources of the sensor measurements
+   STDIN and FIFO: a text line per y vector (the n entries separated by spaces or commas), the stream ends at the end of file
+   TAIL_BINARY   : n doubles (native byte order) per y vector appended to a file, the file is followed until the ingestion is stopped */
+enum streamSourcePLCP {
+	STREAM_SOURCE_STDIN,
+	STREAM_SOURCE_FIFO,
+	STREAM_SOURCE_TAIL_BINARY
+};
+
+/* Main struct for holding the SPSC ring of the y vectors (the head is only written by the producer, the tail only by the consumer) */
+struct streamRingPLCP {
+	int n;                          // Entries of a y vector (i.e., the number of states)
+	size_t capacity;                // Number of the y vectors (a binary power, so the ring index is masked)
+	double * slots;                 // The y vectors [capacity][n]
+	atomic<size_t> * head;          // Number of the pushed y vectors
+	atomic<size_t> * tail;          // Number of the popped y vectors
+	atomic<bool> * isClosed;        // The producer reached the end of the stream
+	// Backpressure statistics
+	atomic<size_t> * numFullStalls; // Number of the pushes which waited for a free slot (i.e., the online loop is slower than the source)
+	atomic<size_t> * highWaterMark; // Maximum observed occupancy
+	atomic<size_t> * numMalformed;  // Number of the skipped malformed records
+	size_t numEmptyWaits;           // Number of the pops which waited for a y vector (consumer only)
+};
+
+/* Main struct for holding the producer thread of the streaming ingestion */
+struct streamIngestionPLCP {
+	struct streamRingPLCP * ring;   // The ring filled by the producer
+	enum streamSourcePLCP source;   // The source type
+	const char * path;              // The FIFO or the binary file path (not used for stdin)
+	atomic<bool> * stopRequested;   // Stop flag (checked between the records and while waiting, including an idle source)
+	thread * producer;              // The producer thread
+};
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the SPSC Ring ======================
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+/* The function for creating a ring of at least the given number of the y vectors (rounded up to a binary power) */
+void create_StreamRingPLCP(struct streamRingPLCP *ring, int n, size_t capacity);
+
+/* The function for freeing the buffers of a ring */
+void free_StreamRingPLCP(struct streamRingPLCP *ring);
+
+/* The function for pushing a y vector (waits while the ring is full, false if the stop is requested while waiting) */
+bool pushStreamRingPLCP(struct streamRingPLCP *ring, double *y, atomic<bool> *stopRequested);
+
+/* The function for popping a y vector (waits while the ring is empty, false at the end of the stream) */
+bool popStreamRingPLCP(struct streamRingPLCP *ring, double *y);
+
+/* The function for printing the occupancy and the backpressure statistics of a ring */
+void printStreamRingPLCP(struct streamRingPLCP *ring);
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Producer =======================
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+/* The function for starting the producer thread reading the given source into the ring */
+void startStreamIngestionPLCP(struct streamIngestionPLCP *si, struct streamRingPLCP *ring, enum streamSourcePLCP source, const char *path);
+
+/* The function for stopping and joining the producer thread (an idle stdin or FIFO producer returns within a poll interval) */
+void stopStreamIngestionPLCP(struct streamIngestionPLCP *si);
+
+#endif
@@ -0,0 +1,404 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the parameter sweep of the crypto application
+						  Each sweep point runs ckks_encoder_modify_matrix_row_packing_functional with its own run configuration, the online loop
+						  reports the iteration latencies and its results through activeSweepPointPLCP, and the results are compared with the
+						  cleartext CUSUM engine (i.e., the exact max/indicator functions) replayed on the same plant and the same noise rows.
+	Note				: The grid is searched exhaustively, the points with an invalid configuration or a failed run (e.g., a Chebyshev degree
+						  deeper than the modulus chain) are kept in the output with their reason and are not on the Pareto front
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "cleartextCUSUM.h"       // The class containing the vectorized cleartext CUSUM detector engine
+#include "encodersplain.h"        // The main application class of the crypto application
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
+#include "sweepPLCP.h"            // The class containing the parameter sweep of the crypto application
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <exception>
+#include <ctype.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Call main namespaces */
+using namespace std;
+
+/* Define the constants */
+#define sweepLineLength 4096
+#define numSweepObjectives 4 // Mean iteration latency, peak RSS, alarm disagreement and s RMS error
+
+/* The sweep point measured by the online loop */
+struct sweepPointPLCP *activeSweepPointPLCP = NULL;
+
+/*
+	The function for removing the leading and the trailing white spaces in place
+*/
+static char * trimSweepToken(char *token){
+	while(isspace((unsigned char) *token))
+		token++;
+	char *end = token + strlen(token);
+	while(end > token && isspace((unsigned char) end[-1]))
+		end--;
+	*end = '\0';
+	return token;
+}
+
+/*
+	The function for obtaining the value index of a swept key at a point (the points enumerate the grid with the last key changing fastest)
+*/
+static int sweepValueIndex(struct parameterSweepPLCP *sw, int pointInd, int keyInd){
+	int stride = 1;
+	for(int j = sw->numKeys - 1; j > keyInd; j--)
+		stride *= sw->numValues[j];
+	return (pointInd / stride) % sw->numValues[keyInd];
+}
+
+/*
+	The function for creating an empty parameter sweep on top of the base run configuration
+	Note: The points run quietly (unless the grid sets log_level) and without the checkpoints, since each point starts with new keys
+*/
+void create_ParameterSweepPLCP(struct parameterSweepPLCP *sw, struct runConfigPLCP *base){
+	memset(sw, 0, sizeof(struct parameterSweepPLCP));
+	sw->base 					  = *base;
+	sw->base.logLevel 			  = LOG_LEVEL_QUIET;
+	sw->base.useCheckpointing 	  = false;
+	sw->base.resumeFromCheckpoint = false;
+	sw->base.exampleSelection 	  = 0;
+	sw->points 					  = NULL;
+}
+
+/*
+	The function for reading the grid file (key = value, value, ... lines, # starts a comment) and building the sweep points
+*/
+bool loadParameterSweepPLCP(struct parameterSweepPLCP *sw, const char *path){
+
+	// Open the grid file
+	FILE *fp = fopen(path, "r");
+	if(fp == NULL){
+		fprintf(stderr, "Parameter Sweep: %s could not be opened\n", path);
+		return false;
+	}
+
+	// Read the keys and their candidate values (each value is checked on a scratch configuration)
+	char line[sweepLineLength];
+	int lineNum = 0;
+	bool isValid = true;
+	struct runConfigPLCP scratch = sw->base;
+	while(fgets(line, sweepLineLength, fp) != NULL){
+		lineNum++;
+		char *comment = strchr(line, '#');
+		if(comment != NULL)
+			*comment = '\0';
+		char *content = trimSweepToken(line);
+		if(*content == '\0')
+			continue;
+		char *separator = strchr(content, '=');
+		if(separator == NULL || sw->numKeys == maxSweepKeys){
+			fprintf(stderr, "Parameter Sweep: %s:%d is not a key = value, ... line or there are more than %d keys\n", path, lineNum, maxSweepKeys);
+			isValid = false;
+			continue;
+		}
+		*separator = '\0';
+		int keyInd = sw->numKeys;
+		snprintf(sw->keys[keyInd], sweepValueLength, "%s", trimSweepToken(content));
+		sw->numValues[keyInd] = 0;
+		for(char *value = strtok(separator + 1, ","); value != NULL; value = strtok(NULL, ",")){
+			value = trimSweepToken(value);
+			if(sw->numValues[keyInd] == maxSweepValues || strlen(value) >= sweepValueLength || !setRunConfigValuePLCP(&scratch, sw->keys[keyInd], value)){
+				fprintf(stderr, "Parameter Sweep: invalid or too many values at %s:%d\n", path, lineNum);
+				isValid = false;
+				break;
+			}
+			snprintf(sw->values[keyInd][sw->numValues[keyInd]++], sweepValueLength, "%s", value);
+		}
+		if(sw->numValues[keyInd] > 0)
+			sw->numKeys++;
+	}
+	fclose(fp);
+	if(!isValid)
+		return false;
+
+	// Count the combinations
+	long numPoints = 1;
+	for(int j = 0; j < sw->numKeys; j++){
+		numPoints *= sw->numValues[j];
+		if(numPoints > maxSweepPoints){
+			fprintf(stderr, "Parameter Sweep: the grid has more than %d points\n", maxSweepPoints);
+			return false;
+		}
+	}
+
+	// Build the run configuration of each point (the invalid combinations, e.g., bit_size above special_bit_size, are not run)
+	sw->numPoints = (int) numPoints;
+	sw->points 	  = (struct sweepPointPLCP *) calloc(sw->numPoints, sizeof(struct sweepPointPLCP));
+	for(int p = 0; p < sw->numPoints; p++){
+		struct sweepPointPLCP *point = &sw->points[p];
+		point->cfg = sw->base;
+		for(int j = 0; j < sw->numKeys; j++)
+			setRunConfigValuePLCP(&point->cfg, sw->keys[j], sw->values[j][sweepValueIndex(sw, p, j)]);
+		if(!validateRunConfigPLCP(&point->cfg))
+			snprintf(point->failReason, sweepValueLength, "%s", "invalid configuration");
+	}
+	printf("Parameter Sweep: %d keys, %d points\n", sw->numKeys, sw->numPoints);
+	return true;
+}
+
+/*
+	The function for recording the latency of an iteration of the online loop and sampling the resident memory
+*/
+void recordSweepIterationPLCP(struct sweepPointPLCP *point, double iterTime){
+	point->numIter++;
+	point->totalIterTime += iterTime;
+	if(iterTime > point->maxIterTime)
+		point->maxIterTime = iterTime;
+	long rss = readResidentSetSizeKB();
+	if(rss > point->peakRSSKB)
+		point->peakRSSKB = rss;
+}
+
+/*
+	The function for comparing the results of the online loop with the cleartext reference of the point
+	Note: The decrypted alarm approximations are rounded at 0.5, s[k + 1] is compared for each measured iteration k
+*/
+void evaluateSweepPointPLCP(struct sweepPointPLCP *point, struct simulationMatrixData *smd){
+
+	struct simulationMatrixData *ref = point->reference;
+	if(ref == NULL || ref->n != smd->n)
+		return;
+	int numIter = point->numIter;
+	if(numIter > smd->tMax)
+		numIter = smd->tMax;
+	if(numIter > ref->tMax)
+		numIter = ref->tMax;
+
+	long numCompared = 0;
+	double sqErrSum  = 0;
+	point->numAlarmMismatches = 0;
+	point->sMaxError 		  = 0;
+	for(int k = 0; k < numIter; k++){
+		for(int i = 0; i < smd->n; i++){
+			double alarm = smd->alarm_Res[k][i] > 0.5 ? 1 : 0;
+			if(alarm != ref->alarm_Res[k][i])
+				point->numAlarmMismatches++;
+			double sErr = fabs(smd->s_Res[k + 1][i] - ref->s_Res[k + 1][i]);
+			sqErrSum += sErr * sErr;
+			if(sErr > point->sMaxError)
+				point->sMaxError = sErr;
+			numCompared++;
+		}
+	}
+	if(numCompared == 0)
+		return;
+	point->alarmAgreement = 1 - (double) point->numAlarmMismatches / numCompared;
+	point->sRMSError 	  = sqrt(sqErrSum / numCompared);
+	point->isCompleted 	  = true;
+}
+
+/*
+	The function for replaying the cleartext reference of the active run configuration (the plant and the iteration count of the point)
+*/
+static struct simulationMatrixData * createSweepReferencePLCP(struct runConfigPLCP *cfg){
+	struct simulationMatrixData *ref = (struct simulationMatrixData *) calloc(1, sizeof(struct simulationMatrixData));
+	create_SimulationMatrixData(ref);
+	assignValMatrixDatabyFileRead(ref, cfg->dataPath);
+	initRemainVec(ref);
+	struct cleartextCUSUMEngine *cce = (struct cleartextCUSUMEngine *) calloc(1, sizeof(struct cleartextCUSUMEngine));
+	create_CleartextCUSUMEngine(cce, ref, 1);
+	replayCleartextCUSUMEngine(cce, ref, ref->tMax, NULL, true);
+	free_CleartextCUSUMEngine(cce);
+	free(cce);
+	return ref;
+}
+
+/*
+	The function for printing the swept values of a point
+*/
+static void printSweepPointLabel(struct parameterSweepPLCP *sw, int pointInd, FILE *fp){
+	for(int j = 0; j < sw->numKeys; j++)
+		fprintf(fp, "%s%s=%s", j == 0 ? "" : " ", sw->keys[j], sw->values[j][sweepValueIndex(sw, pointInd, j)]);
+}
+
+/*
+	The function for running the online loop of each sweep point
+	Note: A failed run leaves the buffers of its online loop behind (i.e., the run is abandoned by the exception), thus, the active
+		  pointers of the online loop are reset so that the next point does not use them
+*/
+void runParameterSweepPLCP(struct parameterSweepPLCP *sw){
+
+	struct runConfigPLCP *prevConfig = activeRunConfigPLCP;
+	for(int p = 0; p < sw->numPoints; p++){
+		struct sweepPointPLCP *point = &sw->points[p];
+		printf("Sweep Point %d/%d: ", p + 1, sw->numPoints);
+		printSweepPointLabel(sw, p, stdout);
+		printf("\n");
+		if(point->failReason[0] != '\0'){
+			printf("Sweep Point %d skipped: %s\n", p + 1, point->failReason);
+			continue;
+		}
+
+		// Replay the cleartext reference and run the online loop with the configuration of the point
+		activeRunConfigPLCP = &point->cfg;
+		point->reference 	= createSweepReferencePLCP(&point->cfg);
+		activeSweepPointPLCP = point;
+		try{
+			ckks_encoder_modify_matrix_row_packing_functional();
+		}
+		catch(const exception &e){
+			snprintf(point->failReason, sweepValueLength, "%s", e.what());
+			activeArenaPLCP 	 = NULL;
+			activeSessionPLCP 	 = NULL;
+			activeConstantsPLCP  = NULL;
+			activeExtractorPLCP  = NULL;
+		}
+		activeSweepPointPLCP = NULL;
+		activeRunConfigPLCP  = prevConfig;
+		free_SimulationMatrixData(point->reference);
+		free(point->reference);
+		point->reference = NULL;
+
+		// The online loop returns without the evaluation for the invalid encryption parameters and the tiled/diagonal backends
+		if(!point->isCompleted && point->failReason[0] == '\0')
+			snprintf(point->failReason, sweepValueLength, "%s", "the MRP online loop did not run");
+		if(point->isCompleted)
+			printf("Sweep Point %d: %f s per iteration, %ld KB RSS, alarm agreement %f, s RMS error %e\n",
+				p + 1, point->totalIterTime / point->numIter, point->peakRSSKB, point->alarmAgreement, point->sRMSError);
+		else
+			printf("Sweep Point %d failed: %s\n", p + 1, point->failReason);
+	}
+}
+
+/*
+	The function for assigning the minimized objectives of a completed point
+*/
+static void assignSweepObjectives(struct sweepPointPLCP *point, double *objectives){
+	objectives[0] = point->totalIterTime / point->numIter;
+	objectives[1] = (double) point->peakRSSKB;
+	objectives[2] = 1 - point->alarmAgreement;
+	objectives[3] = point->sRMSError;
+}
+
+/*
+	The function for marking the Pareto-optimal points (minimum latency, memory, alarm disagreement and s error)
+*/
+void markParetoFrontPLCP(struct parameterSweepPLCP *sw){
+	double objP[numSweepObjectives], objQ[numSweepObjectives];
+	for(int p = 0; p < sw->numPoints; p++){
+		struct sweepPointPLCP *point = &sw->points[p];
+		point->isPareto = point->isCompleted;
+		if(!point->isCompleted)
+			continue;
+		assignSweepObjectives(point, objP);
+		// The point is dominated if another point is not worse in any objective and better in at least one
+		for(int q = 0; q < sw->numPoints && point->isPareto; q++){
+			if(q == p || !sw->points[q].isCompleted)
+				continue;
+			assignSweepObjectives(&sw->points[q], objQ);
+			bool isNotWorse = true, isBetter = false;
+			for(int o = 0; o < numSweepObjectives; o++){
+				if(objQ[o] > objP[o])
+					isNotWorse = false;
+				if(objQ[o] < objP[o])
+					isBetter = true;
+			}
+			if(isNotWorse && isBetter)
+				point->isPareto = false;
+		}
+	}
+}
+
+/*
+	The function for writing the sweep points into a CSV file
+*/
+bool writeParameterSweepPLCP(struct parameterSweepPLCP *sw, const char *path){
+
+	FILE *fp = fopen(path, "w");
+	if(fp == NULL){
+		fprintf(stderr, "Parameter Sweep: %s could not be opened\n", path);
+		return false;
+	}
+	// Header line (the swept keys, then the measurements)
+	fprintf(fp, "point");
+	for(int j = 0; j < sw->numKeys; j++)
+		fprintf(fp, ",%s", sw->keys[j]);
+	fprintf(fp, ",completed,num_iter,mean_iter_time,max_iter_time,peak_rss_kb,alarm_agreement,alarm_mismatches,s_rms_error,s_max_error,pareto,fail_reason\n");
+	// A line per point
+	for(int p = 0; p < sw->numPoints; p++){
+		struct sweepPointPLCP *point = &sw->points[p];
+		fprintf(fp, "%d", p + 1);
+		for(int j = 0; j < sw->numKeys; j++)
+			fprintf(fp, ",%s", sw->values[j][sweepValueIndex(sw, p, j)]);
+		fprintf(fp, ",%d,%d,%.9g,%.9g,%ld,%.9g,%ld,%.9g,%.9g,%d,\"%s\"\n",
+			point->isCompleted, point->numIter, point->numIter > 0 ? point->totalIterTime / point->numIter : 0, point->maxIterTime, point->peakRSSKB,
+			point->alarmAgreement, point->numAlarmMismatches, point->sRMSError, point->sMaxError, point->isPareto, point->failReason);
+	}
+	fclose(fp);
+	return true;
+}
+
+/*
+	The function for printing the Pareto front
+*/
+void printParetoFrontPLCP(struct parameterSweepPLCP *sw){
+	int numCompleted = 0, numPareto = 0;
+	for(int p = 0; p < sw->numPoints; p++){
+		numCompleted += sw->points[p].isCompleted;
+		numPareto 	 += sw->points[p].isPareto;
+	}
+	printf("Pareto Front: %d of %d completed points (%d points in the grid)\n", numPareto, numCompleted, sw->numPoints);
+	for(int p = 0; p < sw->numPoints; p++){
+		struct sweepPointPLCP *point = &sw->points[p];
+		if(!point->isPareto)
+			continue;
+		printf("  [%d] %f s per iteration, %ld KB RSS, alarm agreement %f, s RMS error %e: ",
+			p + 1, point->totalIterTime / point->numIter, point->peakRSSKB, point->alarmAgreement, point->sRMSError);
+		printSweepPointLabel(sw, p, stdout);
+		printf("\n");
+	}
+}
+
+/*
+	The function for freeing the sweep points
+*/
+void free_ParameterSweepPLCP(struct parameterSweepPLCP *sw){
+	free(sw->points);
+	sw->points 	  = NULL;
+	sw->numPoints = 0;
+}
+
+/*
+	The function for running the parameter sweep of the grid file of the run configuration (i.e., sweep_file) and writing the points into sweep_output
+*/
+void example_parameter_sweep(){
+
+	// Print the introduction banner
+	print_example_banner("Example: Parameter Sweep / Latency-Accuracy Pareto Front");
+
+	// Build the points of the grid on top of the run configuration
+	struct runConfigPLCP *cfg = currentRunConfigPLCP();
+	struct parameterSweepPLCP *sw = (struct parameterSweepPLCP *) calloc(1, sizeof(struct parameterSweepPLCP));
+	create_ParameterSweepPLCP(sw, cfg);
+	if(!loadParameterSweepPLCP(sw, cfg->sweepPath)){
+		free_ParameterSweepPLCP(sw);
+		free(sw);
+		return;
+	}
+
+	// Run the points, then report the Pareto front
+	runParameterSweepPLCP(sw);
+	markParetoFrontPLCP(sw);
+	if(writeParameterSweepPLCP(sw, cfg->sweepOutput))
+		printf("Parameter Sweep: the points are written into %s\n", cfg->sweepOutput);
+	printParetoFrontPLCP(sw);
+
+	// Release the sweep
+	free_ParameterSweepPLCP(sw);
+	free(sw);
+}
@@ -0,0 +1,95 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the parameter sweep of the crypto application (i.e., sweepPLCP.cpp)
+						  The grid file lists the run configuration keys with their candidate values (key = value, value, ... lines), and each
+						  combination (i.e., a sweep point) runs the full online loop. The iteration latency, the resident memory and the detection
+						  accuracy against the cleartext reference (the alarm agreement and the s error) are measured per point, and the
+						  Pareto-optimal points are reported.
+   Abbreviation/Acronym	: # _PLCP: Plaintext&Ciphertext
+*/
+
+#ifndef SWEEPPLCP_H
+#define SWEEPPLCP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
+
+/* Import the important selected C libraries*/
+#include <iostream>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Call main namespaces */
+using namespace std;
+
+/* Define the constants */
+#define maxSweepKeys 16     // Keys of a grid file
+#define maxSweepValues 16   // Candidate values of a key
+#define maxSweepPoints 1024 // Combinations of a grid (i.e., the product of the value counts)
+#define sweepValueLength 128
+
+/* Main struct for holding the measurements of a sweep point (i.e., a run of the online loop with a run configuration) */
+struct sweepPointPLCP {
+	struct runConfigPLCP cfg;               // The run configuration of the point
+	bool isCompleted;                       // The online loop finished (false: an invalid configuration or a failed run, e.g., the end of the modulus chain)
+	char failReason[sweepValueLength];
+	// Latency and memory
+	int numIter;                            // Number of the measured iterations
+	double totalIterTime;                   // Sum of the iteration latencies (s)
+	double maxIterTime;                     // The slowest iteration (s)
+	long peakRSSKB;                         // The largest resident set size sampled at the end of the iterations
+	// Accuracy against the cleartext reference
+	double alarmAgreement;                  // Fraction of the (iteration, state) alarms equal to the reference alarms
+	long numAlarmMismatches;
+	double sRMSError;                       // RMS error of the CUSUM parametric sum s
+	double sMaxError;                       // Largest absolute error of s
+	struct simulationMatrixData * reference; // The cleartext reference results (only during the run)
+	bool isPareto;                          // Not dominated by another completed point
+};
+
+/* Main struct for holding the grid and the points of a parameter sweep */
+struct parameterSweepPLCP {
+	struct runConfigPLCP base;                                          // The configuration shared by the points
+	int numKeys;
+	char keys[maxSweepKeys][sweepValueLength];                          // The swept keys
+	int numValues[maxSweepKeys];
+	char values[maxSweepKeys][maxSweepValues][sweepValueLength];        // The candidate values of each swept key
+	int numPoints;
+	struct sweepPointPLCP * points;                                     // [numPoints]
+};
+
+/* The sweep point measured by the online loop (NULL: no sweep is running) */
+extern struct sweepPointPLCP *activeSweepPointPLCP;
+
+/* The function for creating an empty parameter sweep on top of the base run configuration */
+void create_ParameterSweepPLCP(struct parameterSweepPLCP *sw, struct runConfigPLCP *base);
+
+/* The function for reading the grid file (key = value, value, ... lines, # starts a comment) and building the sweep points */
+bool loadParameterSweepPLCP(struct parameterSweepPLCP *sw, const char *path);
+
+/* The function for recording the latency of an iteration of the online loop and sampling the resident memory */
+void recordSweepIterationPLCP(struct sweepPointPLCP *point, double iterTime);
+
+/* The function for comparing the results of the online loop with the cleartext reference of the point */
+void evaluateSweepPointPLCP(struct sweepPointPLCP *point, struct simulationMatrixData *smd);
+
+/* The function for running the online loop of each sweep point */
+void runParameterSweepPLCP(struct parameterSweepPLCP *sw);
+
+/* The function for marking the Pareto-optimal points (minimum latency, memory, alarm disagreement and s error) */
+void markParetoFrontPLCP(struct parameterSweepPLCP *sw);
+
+/* The function for writing the sweep points into a CSV file */
+bool writeParameterSweepPLCP(struct parameterSweepPLCP *sw, const char *path);
+
+/* The function for printing the Pareto front */
+void printParetoFrontPLCP(struct parameterSweepPLCP *sw);
+
+/* The function for freeing the sweep points */
+void free_ParameterSweepPLCP(struct parameterSweepPLCP *sw);
+
+#endif
@@ -0,0 +1,668 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: C++ class which is used for the multi-ciphertext (tiled) matrix-row-packing format
+						  The single ciphertext MRP format holds n row segments of size N, thus, it is limited by n * N <= slot_count.
+						  In the tiled format, a (numRows x numCols) matrix is split into the row tiles of R = slot_count / N rows and
+						  the column tiles of N columns, so that the plants whose state vector does not fit into one ciphertext could be handled.
+						  The tile (r, c) holds the rows [r * R, r * R + R) and the columns [c * N, c * N + N) in the usual MRP order.
+   Abbreviation/Acronym	: # _TMRP: Tiled matrix row packing format
+*/
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "prepareVecMatMRP.h"     // The class which prepares the read matrices in MRP format
+#include "initializationPLCP.h"   // The class containing the functions which convert the prepared matrices to Plaintext and Ciphertext objects.
+#include "plcpOperations.h"       // The class containing the functions which does Ciphertext-Ciphertext and Plaintext-Ciphertext arithmetic and algebraic operations
+#include "generateplaintextMRP.h" // The functions used to prepare plain matrices in MRP format
+#include "applyPLCPSimulation.h"  // The class containing the crypto application functions for each targeted equation
+#include "tiledMRP.h"             // The class containing the multi-ciphertext tiled MRP layout
+#include "runConfigPLCP.h"        // The class containing the run configuration of the application
+
+/* Import the important selected C libraries*/
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/*
+	The function for running the given task indices on the worker threads (each worker takes the next unprocessed index)
+*/
+static void runTiledTasks(int numTasks, int numThreads, function<void(int)> task){
+
+	// Do not create more workers than the tasks
+	if(numThreads < 1)
+		numThreads = 1;
+	if(numThreads > numTasks)
+		numThreads = numTasks;
+
+	// Run sequentially for a single worker
+	if(numThreads <= 1){
+		for(int t = 0; t < numTasks; t++)
+			task(t);
+		return;
+	}
+
+	// Distribute the tasks over the workers
+	atomic<int> nextTask(0);
+	vector<thread> workers;
+	for(int w = 0; w < numThreads; w++){
+		workers.emplace_back([&](){
+			int t;
+			while((t = nextTask++) < numTasks)
+				task(t);
+		});
+	}
+	for(size_t w = 0; w < workers.size(); w++)
+		workers[w].join();
+}
+
+/*
+	The function for obtaining the number of rows of the given row tile (the last row tile might be partially filled)
+*/
+static int getRowTileSize(struct tiledLayoutMRP *tl, int rowTileInd){
+	int rowsInTile = tl->numRows - rowTileInd * tl->rowsPerTile;
+	return (rowsInTile < tl->rowsPerTile) ? rowsInTile : tl->rowsPerTile;
+}
+
+/*
+	The function for obtaining the number of the replicas of a column tile (i.e., the largest row tile size)
+*/
+static int getColTileRepeat(struct tiledLayoutMRP *tl){
+	return (tl->numRows < tl->rowsPerTile) ? tl->numRows : tl->rowsPerTile;
+}
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Tiled Layout Creation ==========
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+
+/*
+	The function for calculating the row segment size of the tiled layout (the MRP row size capped by the maximum column tile width)
+*/
+int calculateTiledSegmentSize(size_t numStates, size_t slotCount, size_t maxColTileWidth){
+
+	// Obtain the usual MRP row size
+	size_t calculatedRowSize;
+	calculateVectorSize(numStates, &calculatedRowSize);
+
+	// Cap the row size with the column tile width and the number of slots (both are the powers of two)
+	if(maxColTileWidth > 0 && calculatedRowSize > maxColTileWidth)
+		calculatedRowSize = maxColTileWidth;
+	if(calculatedRowSize > slotCount)
+		calculatedRowSize = slotCount;
+
+	return (int) calculatedRowSize;
+}
+
+/*
+	The function for calculating the row and column tiles of a (numRows x numCols) matrix for the given row segment size
+*/
+void calculateTiledLayoutMRP(struct tiledLayoutMRP *tl, int numRows, int numCols, int N, size_t slotCount){
+
+	// Check the row segment size
+	if(N <= 0 || (N & (N - 1)) != 0 || (size_t) N > slotCount){
+		printf("Tiled MRP Error: The row segment size %d is not a power of two within the %zu slots\n", N, slotCount);
+		exit(0);
+	}
+
+	// Assign the layout dimensions
+	tl->numRows 	= numRows;
+	tl->numCols 	= numCols;
+	tl->N 			= N;
+	tl->slotCount 	= slotCount;
+	tl->rowsPerTile = (int) (slotCount / N);
+	tl->numRowTiles = (numRows + tl->rowsPerTile - 1) / tl->rowsPerTile;
+	tl->numColTiles = (numCols + N - 1) / N;
+	tl->rotLen 		= N;
+}
+
+/*
+	The function for calculating the width of the non-zero part of the row segments of a matrix in the tiled MRP (rounded up to a binary power)
+*/
+int calculateTiledNonZeroSegmentWidth(double ** mat, struct tiledLayoutMRP *tl){
+
+	// Find the last non-zero entry of the row segments over all tiles
+	int lastNonZeroCol = 0;
+	for(int i = 0; i < tl->numRows; i++)
+		for(int j = 0; j < tl->numCols; j++)
+			if(mat[i][j] != 0 && j % tl->N > lastNonZeroCol)
+				lastNonZeroCol = j % tl->N;
+
+	// Round the width up to a binary power
+	int nonZeroWidth = 1;
+	while(nonZeroWidth < lastNonZeroCol + 1)
+		nonZeroWidth = nonZeroWidth * 2;
+	return nonZeroWidth;
+}
+
+/*
+	The function for checking whether the (single ciphertext) MRP layout overflows the ciphertext slots
+*/
+bool isMRPLayoutOverflowed(struct simulationMatrixMRP *smrp, size_t slotCount){
+	return (size_t) smrp->n * (size_t) smrp->N > slotCount;
+}
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Tiled Cleartext Packing ========
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+
+/*
+	The function for generating the matrix tiles in the tiled MRP (the tile (r, c) is stored at [r * numColTiles + c])
+*/
+void genTiledMatMRP_RPL(vector<vector<double>> *matTiles, double ** mat, struct tiledLayoutMRP *tl){
+
+	matTiles->resize(tl->numRowTiles * tl->numColTiles);
+	for(int r = 0; r < tl->numRowTiles; r++){
+		int rowsInTile = getRowTileSize(tl, r);
+		for(int c = 0; c < tl->numColTiles; c++){
+			// Read and fill the entries of the tile (ending with trailing zeros)
+			vector<double> &tile = matTiles->at(r * tl->numColTiles + c);
+			tile.assign((size_t) rowsInTile * tl->N, 0);
+			for(int i = 0; i < rowsInTile; i++){
+				for(int j = 0; j < tl->N; j++){
+					int col = c * tl->N + j;
+					if(col < tl->numCols)
+						tile[i * tl->N + j] = mat[r * tl->rowsPerTile + i][col];
+				}
+			}
+		}
+	}
+}
+
+/*
+	The function for generating the replicated x vector tiles of the generic Ax multiplication (one ciphertext per column tile)
+*/
+void genTiledRepXVecMRP_RPL(vector<vector<double>> *xTiles, double ** vec, struct tiledLayoutMRP *tl){
+
+	int colTileRepeat = getColTileRepeat(tl);
+	xTiles->resize(tl->numColTiles);
+	for(int c = 0; c < tl->numColTiles; c++){
+		// Fill the first row segment and repeat it as many as the rows of a row tile
+		vector<double> &tile = xTiles->at(c);
+		tile.assign((size_t) colTileRepeat * tl->N, 0);
+		for(int j = 0; j < tl->N; j++){
+			int col = c * tl->N + j;
+			if(col < tl->numCols)
+				tile[j] = vec[col][0];
+		}
+		for(size_t i = tl->N; i < tile.size(); i++)
+			tile[i] = tile[i % tl->N];
+	}
+}
+
+/*
+	The function for generating the vector tiles for the homomorphic addition (one ciphertext per row tile, entries at i * N)
+*/
+void genTiledAddVecMRP_RPL(vector<vector<double>> *addTiles, double ** vec, struct tiledLayoutMRP *tl){
+
+	addTiles->resize(tl->numRowTiles);
+	for(int r = 0; r < tl->numRowTiles; r++){
+		int rowsInTile = getRowTileSize(tl, r);
+		vector<double> &tile = addTiles->at(r);
+		tile.assign((size_t) rowsInTile * tl->N, 0);
+		for(int i = 0; i < rowsInTile; i++)
+			tile[i * tl->N] = vec[r * tl->rowsPerTile + i][0];
+	}
+}
+
+/*
+	The function for generating the constant vector tiles for the homomorphic addition (e.g., one, alpha, beta, first Chebyshev term)
+*/
+void genTiledConstVecMRP_RPL(vector<vector<double>> *addTiles, double value, struct tiledLayoutMRP *tl){
+
+	addTiles->resize(tl->numRowTiles);
+	for(int r = 0; r < tl->numRowTiles; r++){
+		int rowsInTile = getRowTileSize(tl, r);
+		vector<double> &tile = addTiles->at(r);
+		tile.assign((size_t) rowsInTile * tl->N, 0);
+		for(int i = 0; i < rowsInTile; i++)
+			tile[i * tl->N] = value;
+	}
+}
+
+/*
+	The function for encoding the tiles into Plaintexts (the all-zero matrix tiles are not encoded and left empty if skipZeroTiles is set)
+*/
+void makeTiledPlaintextMatRowPacking(vector<vector<double>> *tiles, double scale, vector<Plaintext> *tiles_PL, CKKSEncoder *encoderPtr, bool skipZeroTiles){
+
+	tiles_PL->assign(tiles->size(), Plaintext());
+	for(size_t t = 0; t < tiles->size(); t++){
+		// Detect the all-zero tiles
+		bool isZeroTile = true;
+		for(size_t i = 0; isZeroTile && i < tiles->at(t).size(); i++)
+			if(tiles->at(t)[i] != 0)
+				isZeroTile = false;
+		if(skipZeroTiles && isZeroTile)
+			continue;
+		makePlaintextMatRowPacking(&tiles->at(t), scale, &tiles_PL->at(t), encoderPtr);
+	}
+}
+
+/*
+	The function for counting the non-zero (i.e., encoded) matrix tiles
+*/
+int countNonZeroTiles(vector<Plaintext> *tiles_PL){
+	int numNonZeroTiles = 0;
+	for(size_t t = 0; t < tiles_PL->size(); t++)
+		if(!tiles_PL->at(t).is_zero())
+			numNonZeroTiles++;
+	return numNonZeroTiles;
+}
+
+/*
+	The function for encrypting the tiles into Ciphertexts
+*/
+void encryptTiledVectorMatRowPacking(vector<vector<double>> *tiles, double scale, vector<Ciphertext> *tiles_CP, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr){
+
+	tiles_CP->resize(tiles->size());
+	for(size_t t = 0; t < tiles->size(); t++)
+		encryptXVectorMatRowPacking(&tiles->at(t), scale, &tiles_CP->at(t), encryptorPtr, encoderPtr);
+}
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Tiled Homomorphic Operations ===
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+
+/*
+	The function for performing the tiled Plaintext-Ciphertext matrix-vector multiplication M1*x1 (+ M2*x2)
+	Note: The plaintext tiles are modified in place (i.e., mod-switched to the level of x), thus, each tile is processed by a single worker,
+		  whereas the shared column tiles of x are copied by each worker. The zero (i.e., empty) tiles are skipped entirely.
+*/
+void tiledMatrixVectorMultMRP(vector<Ciphertext> *resRowTiles_CP, struct tiledLayoutMRP *tl, vector<Plaintext> *matTiles_PL, vector<Ciphertext> *xColTiles_CP,
+							  struct tiledLayoutMRP *tl2, vector<Plaintext> *mat2Tiles_PL, vector<Ciphertext> *x2ColTiles_CP,
+							  double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, GaloisKeys *gal_keysPtr, RelinKeys *relin_keysPtr, int numThreads){
+
+	// Check the layout of the 2nd term (it has to share the row tiles of the 1st term)
+	bool hasSecondTerm = (tl2 != NULL && mat2Tiles_PL != NULL && x2ColTiles_CP != NULL);
+	if(hasSecondTerm && (tl2->N != tl->N || tl2->numRows != tl->numRows)){
+		printf("Tiled MRP Error: The terms of the tiled matrix-vector multiplication do not share the row tiles\n");
+		exit(0);
+	}
+	int numTiles_1 = tl->numRowTiles * tl->numColTiles;
+	int numTiles_2 = hasSecondTerm ? tl2->numRowTiles * tl2->numColTiles : 0;
+
+	// 1st part: Multiply each non-zero tile with its column tile of x (in parallel, the products are not rescaled)
+	vector<int> nonZeroTiles;
+	for(int t = 0; t < numTiles_1 + numTiles_2; t++){
+		Plaintext *matTilePtr = (t < numTiles_1) ? &matTiles_PL->at(t) : &mat2Tiles_PL->at(t - numTiles_1);
+		if(!matTilePtr->is_zero())
+			nonZeroTiles.push_back(t);
+	}
+	vector<Ciphertext> tileProducts(numTiles_1 + numTiles_2);
+	runTiledTasks((int) nonZeroTiles.size(), numThreads, [&](int taskInd){
+		int t = nonZeroTiles[taskInd];
+		Ciphertext xLocal;
+		Plaintext *matTilePtr;
+		if(t < numTiles_1){
+			xLocal 	   = xColTiles_CP->at(t % tl->numColTiles);
+			matTilePtr = &matTiles_PL->at(t);
+		}else{
+			xLocal 	   = x2ColTiles_CP->at((t - numTiles_1) % tl2->numColTiles);
+			matTilePtr = &mat2Tiles_PL->at(t - numTiles_1);
+		}
+		plnCprAxMultLazy_mrp(&tileProducts[t], &xLocal, matTilePtr, scale, contextPtr, evaluatorPtr);
+	});
+
+	// 2nd part: Sum the non-zero column partials of each row tile, rescale the sum and do the rotation and addition once per row tile (in parallel)
+	// Note: The rotation length of the 1st layout has to cover the non-zero row segment entries of both terms
+	int rotLen = tl->rotLen;
+	resRowTiles_CP->resize(tl->numRowTiles);
+	runTiledTasks(tl->numRowTiles, numThreads, [&](int r){
+		Ciphertext rowTileSum, lazySum;
+		bool isRowTileSumEmpty = true;
+		for(int term = 0; term < (hasSecondTerm ? 2 : 1); term++){
+			int numColTiles = (term == 0) ? tl->numColTiles : tl2->numColTiles;
+			int tileOffset  = (term == 0) ? 0 : numTiles_1;
+			vector<Plaintext> *termTiles_PL = (term == 0) ? matTiles_PL : mat2Tiles_PL;
+			for(int c = 0; c < numColTiles; c++){
+				int tileInd = r * numColTiles + c;
+				if(termTiles_PL->at(tileInd).is_zero())
+					continue;
+				accumulateLazySumPLCP(&lazySum, &tileProducts[tileOffset + tileInd], &isRowTileSumEmpty, scale, contextPtr, evaluatorPtr);
+			}
+		}
+		// Assign an encrypted zero to the row tiles without any non-zero tile
+		if(isRowTileSumEmpty){
+			vector<double> zeroVec((size_t) tl->rowsPerTile * tl->N, 0);
+			encryptXVectorMatRowPacking(&zeroVec, scale, &resRowTiles_CP->at(r), encryptorPtr, encoderPtr);
+			return;
+		}
+		finalizeLazySumPLCP(&rowTileSum, &lazySum, evaluatorPtr, relin_keysPtr);
+		rotateVector(&resRowTiles_CP->at(r), &rowTileSum, scale, rotLen, contextPtr, evaluatorPtr, decryptorPtr, encoderPtr, gal_keysPtr, relin_keysPtr);
+	});
+}
+
+/*
+	The function for performing the tiled homomorphic addition or subtraction with Ciphertext&Ciphertext
+*/
+void addSubtractTiledVectors(vector<Ciphertext> *res_CP, vector<Ciphertext> *v_1_CP, vector<Ciphertext> *v_2_CP, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, bool isAddition){
+
+	vector<Ciphertext> tileRes(v_1_CP->size());
+	for(size_t t = 0; t < v_1_CP->size(); t++)
+		addSubtractTwoVector(&tileRes[t], &v_1_CP->at(t), &v_2_CP->at(t), scale, contextPtr, evaluatorPtr, isAddition);
+	*res_CP = tileRes;
+}
+
+/*
+	The function for performing the tiled homomorphic addition or subtraction with Plaintext&Ciphertext
+*/
+void addSubtractTiledPLCPVectors(vector<Ciphertext> *res_CP, vector<Ciphertext> *v_1_CP, vector<Plaintext> *v_2_PL, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, bool isAddition){
+
+	vector<Ciphertext> tileRes(v_1_CP->size());
+	for(size_t t = 0; t < v_1_CP->size(); t++)
+		addSubtractPLCPVector(&tileRes[t], &v_1_CP->at(t), &v_2_PL->at(t), scale, contextPtr, evaluatorPtr, isAddition);
+	*res_CP = tileRes;
+}
+
+/*
+	The function for decrypting the row tiles and reading the result vector entries (i.e., the entries at i * N)
+*/
+void decryptTiledResult(double * result, vector<Ciphertext> *rowTiles_CP, struct tiledLayoutMRP *tl, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr){
+
+	Plaintext Res_PL;
+	vector<double> Res_Vec;
+	for(int r = 0; r < tl->numRowTiles; r++){
+		decryptorPtr->decrypt(rowTiles_CP->at(r), Res_PL);
+		encoderPtr->decode(Res_PL, Res_Vec);
+		int rowsInTile = getRowTileSize(tl, r);
+		for(int i = 0; i < rowsInTile; i++)
+			result[r * tl->rowsPerTile + i] = Res_Vec[i * tl->N];
+	}
+}
+
+/*
+	The function for performing the secret share of the tiled estimation (the row tiles are re-arranged into the replicated column tiles)
+	Note: Same protocol with secretShareEstimation, i.e., the estimation is masked with the random numbers before the decryption and
+		  the (re-arranged) masks are subtracted after the encryption.
+*/
+void secretShareTiledEstimation(vector<Ciphertext> *xColTiles_CP, vector<Ciphertext> *xRowTiles_CP, struct tiledLayoutMRP *tl, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr){
+
+	/*
+	**	Create the random masks and do the initial random addition on each row tile, then decrypt the masked estimation
+	*/
+	int randomNumSamplingInterval = pow(2, currentRunConfigPLCP()->numRandBits);
+	double ** maskVals   = (double **) calloc(tl->numRows, sizeof(double *));
+	double ** maskedVals = (double **) calloc(tl->numRows, sizeof(double *));
+	for(int i = 0; i < tl->numRows; i++){
+		maskVals[i]   	= (double *) calloc(1, sizeof(double));
+		maskedVals[i] 	= (double *) calloc(1, sizeof(double));
+		maskVals[i][0] 	= rand() % randomNumSamplingInterval;
+	}
+	vector<vector<double>> randAddTiles;
+	vector<Ciphertext> randAddTiles_CP, maskedRowTiles_CP;
+	genTiledAddVecMRP_RPL(&randAddTiles, maskVals, tl);
+	encryptTiledVectorMatRowPacking(&randAddTiles, scale, &randAddTiles_CP, encryptorPtr, encoderPtr);
+	addSubtractTiledVectors(&maskedRowTiles_CP, xRowTiles_CP, &randAddTiles_CP, scale, contextPtr, evaluatorPtr, true);
+	double * maskedRes = (double *) calloc(tl->numRows, sizeof(double));
+	decryptTiledResult(maskedRes, &maskedRowTiles_CP, tl, decryptorPtr, encoderPtr);
+	for(int i = 0; i < tl->numRows; i++)
+		maskedVals[i][0] = maskedRes[i];
+
+	/*
+	**	Re-arrange the masked estimation and the masks into the replicated column tiles, encrypt them and do the eventual subtraction
+	*/
+	struct tiledLayoutMRP tlCol = *tl;
+	tlCol.numCols 	  = tl->numRows;
+	tlCol.numColTiles = (tl->numRows + tl->N - 1) / tl->N;
+	vector<vector<double>> maskedColTiles, randSubTiles;
+	vector<Ciphertext> maskedColTiles_CP, randSubTiles_CP;
+	genTiledRepXVecMRP_RPL(&maskedColTiles, maskedVals, &tlCol);
+	genTiledRepXVecMRP_RPL(&randSubTiles, maskVals, &tlCol);
+	encryptTiledVectorMatRowPacking(&maskedColTiles, scale, &maskedColTiles_CP, encryptorPtr, encoderPtr);
+	encryptTiledVectorMatRowPacking(&randSubTiles, scale, &randSubTiles_CP, encryptorPtr, encoderPtr);
+	addSubtractTiledVectors(xColTiles_CP, &maskedColTiles_CP, &randSubTiles_CP, scale, contextPtr, evaluatorPtr, false);
+
+	// Release the cleartext buffers
+	for(int i = 0; i < tl->numRows; i++){
+		free(maskVals[i]);
+		free(maskedVals[i]);
+	}
+	free(maskVals);
+	free(maskedVals);
+	free(maskedRes);
+}
+
+/*
+	The function for creating the MRP view of a single row tile, so that the element-wise CUSUM functions of applyPLCPSimulation.cpp could be applied per row tile
+	Note: The element-wise functions only read the dimensions, the Chebyshev degrees and the one vector of the MRP struct.
+	The view keeps the unfolded range transformations, the Chebyshev backend and the decryption-based reset, thus, the tiled layout is not run with folded_range_transform, 
+	the composite backend or homomorphic_reset.
+*/
+void create_RowTileMRPView(struct simulationMatrixMRP *smrpTile, struct simulationMatrixMRP *smrp, struct tiledLayoutMRP *tl, int rowTileInd){
+
+	// Assign the dimensions of the row tile
+	smrpTile->m = smrp->m;
+	smrpTile->n = getRowTileSize(tl, rowTileInd);
+	smrpTile->N = tl->N;
+	// Assign the Chebyshev Approximation parameters
+	smrpTile->chebDegEq8 	  = smrp->chebDegEq8;
+	smrpTile->chebDegEq9 	  = smrp->chebDegEq9;
+	smrpTile->alpbetLowBouEq8 = smrp->alpbetLowBouEq8;
+	smrpTile->alpbetUpBouEq8  = smrp->alpbetUpBouEq8;
+	smrpTile->alpbetLowBouEq9 = smrp->alpbetLowBouEq9;
+	smrpTile->alpbetUpBouEq9  = smrp->alpbetUpBouEq9;
+	smrpTile->alpEq8 		  = smrp->alpEq8;
+	smrpTile->betEq8 		  = smrp->betEq8;
+	smrpTile->alpEq9 		  = smrp->alpEq9;
+	smrpTile->betEq9 		  = smrp->betEq9;
+	// Generate the one vector of the row tile
+	smrpTile->One_MRP = new std::vector<double>((size_t) smrpTile->n * smrpTile->N);
+	for(int i = 0; i < smrpTile->n; i++)
+		smrpTile->One_MRP->at(i * smrpTile->N) = 1;
+}
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Tiled Layout Check =============
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+
+/*
+	The function for finding the largest difference between two result vectors
+*/
+static double maxDifferenceTMRP(double *res, double *ref, int numRows){
+	double maxDiff = 0;
+	for(int i = 0; i < numRows; i++)
+		maxDiff = max(maxDiff, fabs(res[i] - ref[i]));
+	return maxDiff;
+}
+
+/*
+	The function for running the linear stages (Eq2, Eq3, Eq4-5) of n = 10, 20, 50 in the single ciphertext MRP format and in the tiled MRP format with the column
+	tile widths 4 and 8, and comparing the tiled results with the MRP results and the cleartext references
+	Note: The column tile widths are below the MRP row sizes of the plants, thus, the tiled runs have several column tiles (i.e., as with tiled_col_tile_width = 4 or 8)
+*/
+void example_tiled_layout_check(){
+
+	// Print the introduction banner
+	print_example_banner("Example: Tiled vs. MRP Layout Check");
+
+	// Create the CKKS context and the keys with the parameters of the crypto application (i.e., ckks_encoder_modify_matrix_row_packing_functional)
+	EncryptionParameters parms(scheme_type::ckks);
+	size_t poly_modulus_degree = 32768;
+	int bitsizesparam 		   = 50;
+	parms.set_poly_modulus_degree(poly_modulus_degree);
+	parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, {60, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, bitsizesparam, 60}));
+	SEALContext context(parms);
+	KeyGenerator keygen(context);
+	SecretKey secret_key = keygen.secret_key();
+	PublicKey public_key;
+	keygen.create_public_key(public_key);
+	RelinKeys relin_keys;
+	keygen.create_relin_keys(relin_keys);
+	GaloisKeys gal_keys;
+	keygen.create_galois_keys(gal_keys);
+	Encryptor encryptor(context, public_key);
+	Evaluator evaluator(context);
+	Decryptor decryptor(context, secret_key);
+	CKKSEncoder encoder(context);
+	double scale 	 = pow(2.0, bitsizesparam);
+	size_t slotCount = encoder.slot_count();
+	int numThreads 	 = (currentRunConfigPLCP()->numThreads > 0) ? currentRunConfigPLCP()->numThreads : (int) thread::hardware_concurrency();
+	double tolerance = 1e-3; // The largest accepted difference between the tiled and the MRP results
+	bool isPassed 	 = true;
+
+	// Run the check for each recorded plant and column tile width
+	const char * folderPaths[3]   = {"./all_data/y10_u2", "./all_data/y20_u4", "./all_data/y50_u10"};
+	const char * equationNames[3] = {"Eq2", "Eq3", "Eq4_5"};
+	size_t colTileWidths[2] 	  = {4, 8};
+	printf("n,m,Column Tile Width,Row Tiles,Column Tiles,Equation,Max Error MRP,Max Error Tiled,Max Diff Tiled-MRP,Result\n");
+	for(int f = 0; f < 3; f++){
+
+		// Read the plant model and prepare the MRP format
+		struct simulationMatrixData * smd = (struct simulationMatrixData *) calloc(1, sizeof(struct simulationMatrixData));
+		create_SimulationMatrixData(smd);
+		assignValMatrixDatabyFileRead(smd, folderPaths[f]);
+		initRemainVec(smd);
+		assignCUSUMChebyshevAppxParams(smd);
+		struct simulationMatrixMRP *smrp = (struct simulationMatrixMRP *) calloc(1, sizeof(struct simulationMatrixMRP));
+		create_SimulationMatrixDataMRP(smd, smrp);
+		assignValMatrixDataMRP(smd, smrp);
+		int n = smd->n, m = smd->m;
+
+		// The inputs (i.e., the recorded x̂e and the first noisy measurement)
+		double ** yVec = (double **) calloc(n, sizeof(double *));
+		for(int i = 0; i < n; i++){
+			yVec[i] 	= (double *) calloc(1, sizeof(double));
+			yVec[i][0] 	= smd->xx[i][0] + smd->yNoise[0][i];
+		}
+
+		// Cleartext references: x̂e = Γx̂e + Ly + xΓ, u = KΓx̂e + KLy + KxuΓ, x̂p = Acl x̂e + BuΓ
+		int numRows[3] = {n, m, n};
+		double * ref[3], * mrpRes[3], * tiledRes[3];
+		for(int e = 0; e < 3; e++){
+			ref[e] 		= (double *) calloc(n, sizeof(double));
+			mrpRes[e] 	= (double *) calloc(n, sizeof(double));
+			tiledRes[e] = (double *) calloc(n, sizeof(double));
+		}
+		for(int i = 0; i < n; i++){
+			ref[0][i] = smd->xGxG[i][0];
+			for(int j = 0; j < n; j++)
+				ref[0][i] += smd->GAMMA[i][j] * smd->xexe[j][0] + smd->LL[i][j] * yVec[j][0];
+		}
+		for(int i = 0; i < m; i++){
+			ref[1][i] = smd->KxuGKxuG[i][0];
+			for(int j = 0; j < n; j++)
+				ref[1][i] += smd->KGKG[i][j] * smd->xexe[j][0] + smd->KLKL[i][j] * yVec[j][0];
+		}
+		for(int i = 0; i < n; i++){
+			for(int j = 0; j < n; j++)
+				ref[2][i] += smd->ACL[i][j] * smd->xexe[j][0];
+			for(int j = 0; j < m; j++)
+				ref[2][i] += smd->BB[i][j] * smd->uGuG[j][0];
+		}
+
+		// ================ ================ ================ ================
+		// ===== Single ciphertext MRP format =================================
+		// ================ ================ ================ ================
+		Plaintext GAMMA_PL, LL_PL, KGKG_PL, KLKL_PL, ACL_PL, BB_PL;
+		makePlaintextMatRowPacking(smrp->GAMMA_MRP, scale, &GAMMA_PL, &encoder);
+		makePlaintextMatRowPacking(smrp->LL_MRP, scale, &LL_PL, &encoder);
+		makePlaintextMatRowPacking(smrp->KGKG_MRP, scale, &KGKG_PL, &encoder);
+		makePlaintextMatRowPacking(smrp->KLKL_MRP, scale, &KLKL_PL, &encoder);
+		makePlaintextMatRowPacking(smrp->ACL_MRP, scale, &ACL_PL, &encoder);
+		makePlaintextMatRowPacking(smrp->BB_MRP, scale, &BB_PL, &encoder);
+		vector<double> xeRep_MRP(smrp->N * smrp->n), yRep_MRP(smrp->N * smrp->n);
+		genRepXVecMRP_RPL_v0(&xeRep_MRP, smd->xexe, smrp->n, smrp->n, smrp->N, "xe", false);
+		genRepXVecMRP_RPL_v0(&yRep_MRP, yVec, smrp->n, smrp->n, smrp->N, "Sensor-Measurement-Y-Rep", false);
+		Ciphertext xexe_CP, yy_CP, xGxG_CP, KxuGKxuG_CP, uGuG_CP, BuGLazy_CP;
+		encryptXVectorMatRowPacking(&xeRep_MRP, scale, &xexe_CP, &encryptor, &encoder);
+		encryptXVectorMatRowPacking(&yRep_MRP, scale, &yy_CP, &encryptor, &encoder);
+		encryptXVectorMatRowPacking(smrp->xGxG_MRP, scale, &xGxG_CP, &encryptor, &encoder);
+		encryptXVectorMatRowPacking(smrp->KxuGKxuG_MRP, scale, &KxuGKxuG_CP, &encryptor, &encoder);
+		encryptXVectorMatRowPacking(smrp->uGuG_MRP, scale, &uGuG_CP, &encryptor, &encoder);
+		precomputeEquation_4_5_PLCP(&BuGLazy_CP, smrp, &BB_PL, NULL, &uGuG_CP, scale, &context, &evaluator, &gal_keys);
+		// The helpers adjust the levels and the scales of their inputs in place, thus, each equation runs on the copies
+		for(int e = 0; e < 3; e++){
+			Ciphertext res_CP, xe_CP = xexe_CP, y_CP = yy_CP, add_CP = (e == 0) ? xGxG_CP : ((e == 1) ? KxuGKxuG_CP : BuGLazy_CP);
+			if(e == 0)
+				applyEquation_2_PLCP(&res_CP, smrp, &GAMMA_PL, &LL_PL, &add_CP, &y_CP, &xe_CP, scale, &context, &encryptor, &evaluator, &decryptor, &encoder, &relin_keys, &gal_keys);
+			else if(e == 1)
+				applyEquation_3_PLCP(&res_CP, smrp, &KGKG_PL, &KLKL_PL, &add_CP, &y_CP, &xe_CP, scale, &context, &encryptor, &evaluator, &decryptor, &encoder, &relin_keys, &gal_keys);
+			else
+				applyEquation_4_5_PLCP(&res_CP, smrp, &ACL_PL, &add_CP, &xe_CP, scale, &context, &encryptor, &evaluator, &decryptor, &encoder, &relin_keys, &gal_keys);
+			Plaintext res_PL;
+			vector<double> res_Vec;
+			decryptor.decrypt(res_CP, res_PL);
+			encoder.decode(res_PL, res_Vec);
+			for(int i = 0; i < numRows[e]; i++)
+				mrpRes[e][i] = res_Vec[(size_t) i * smrp->N];
+		}
+
+		for(int w = 0; w < 2; w++){
+
+			// ================ ================ ================ ================
+			// ===== Tiled MRP format (as in performTiledMatrixVectorMultiplicationsPlain) 
+			// ================ ================ ================ ================
+			int N = calculateTiledSegmentSize(n, slotCount, colTileWidths[w]);
+			struct tiledLayoutMRP tlNN, tlMN, tlNM;
+			calculateTiledLayoutMRP(&tlNN, n, n, N, slotCount);
+			calculateTiledLayoutMRP(&tlMN, m, n, N, slotCount);
+			calculateTiledLayoutMRP(&tlNM, n, m, N, slotCount);
+			vector<vector<double>> cleartextTiles;
+			vector<Plaintext> GAMMA_T_PL, LL_T_PL, KGKG_T_PL, KLKL_T_PL, ACL_T_PL, BB_T_PL, xGxG_T_PL, KxuGKxuG_T_PL;
+			genTiledMatMRP_RPL(&cleartextTiles, smd->GAMMA, &tlNN); makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &GAMMA_T_PL, &encoder, true);
+			genTiledMatMRP_RPL(&cleartextTiles, smd->LL, &tlNN);    makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &LL_T_PL, &encoder, true);
+			genTiledMatMRP_RPL(&cleartextTiles, smd->KGKG, &tlMN);  makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &KGKG_T_PL, &encoder, true);
+			genTiledMatMRP_RPL(&cleartextTiles, smd->KLKL, &tlMN);  makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &KLKL_T_PL, &encoder, true);
+			genTiledMatMRP_RPL(&cleartextTiles, smd->ACL, &tlNN);   makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &ACL_T_PL, &encoder, true);
+			genTiledMatMRP_RPL(&cleartextTiles, smd->BB, &tlNM);    makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &BB_T_PL, &encoder, true);
+			genTiledAddVecMRP_RPL(&cleartextTiles, smd->xGxG, &tlNN);     makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &xGxG_T_PL, &encoder, false);
+			genTiledAddVecMRP_RPL(&cleartextTiles, smd->KxuGKxuG, &tlMN); makeTiledPlaintextMatRowPacking(&cleartextTiles, scale, &KxuGKxuG_T_PL, &encoder, false);
+			vector<Ciphertext> xexe_T_CP, yy_T_CP, uGuG_T_CP;
+			genTiledRepXVecMRP_RPL(&cleartextTiles, smd->xexe, &tlNN); encryptTiledVectorMatRowPacking(&cleartextTiles, scale, &xexe_T_CP, &encryptor, &encoder);
+			genTiledRepXVecMRP_RPL(&cleartextTiles, yVec, &tlNN);      encryptTiledVectorMatRowPacking(&cleartextTiles, scale, &yy_T_CP, &encryptor, &encoder);
+			genTiledRepXVecMRP_RPL(&cleartextTiles, smd->uGuG, &tlNM); encryptTiledVectorMatRowPacking(&cleartextTiles, scale, &uGuG_T_CP, &encryptor, &encoder);
+			// The rotate-and-sums only cover the non-zero part of the row segments
+			struct tiledLayoutMRP tlEq2 = tlNN, tlEq3 = tlMN, tlEq4_5 = tlNN;
+			tlEq2.rotLen   = max(calculateTiledNonZeroSegmentWidth(smd->GAMMA, &tlNN), calculateTiledNonZeroSegmentWidth(smd->LL, &tlNN));
+			tlEq3.rotLen   = max(calculateTiledNonZeroSegmentWidth(smd->KGKG, &tlMN), calculateTiledNonZeroSegmentWidth(smd->KLKL, &tlMN));
+			tlEq4_5.rotLen = max(calculateTiledNonZeroSegmentWidth(smd->ACL, &tlNN), calculateTiledNonZeroSegmentWidth(smd->BB, &tlNM));
+			vector<Ciphertext> res_T_CP[3];
+			tiledMatrixVectorMultMRP(&res_T_CP[0], &tlEq2, &GAMMA_T_PL, &xexe_T_CP, &tlEq2, &LL_T_PL, &yy_T_CP, scale, &context, &encryptor, &evaluator, &decryptor, &encoder, &gal_keys, &relin_keys, numThreads);
+			addSubtractTiledPLCPVectors(&res_T_CP[0], &res_T_CP[0], &xGxG_T_PL, scale, &context, &evaluator, true);
+			tiledMatrixVectorMultMRP(&res_T_CP[1], &tlEq3, &KGKG_T_PL, &xexe_T_CP, &tlEq3, &KLKL_T_PL, &yy_T_CP, scale, &context, &encryptor, &evaluator, &decryptor, &encoder, &gal_keys, &relin_keys, numThreads);
+			addSubtractTiledPLCPVectors(&res_T_CP[1], &res_T_CP[1], &KxuGKxuG_T_PL, scale, &context, &evaluator, true);
+			tiledMatrixVectorMultMRP(&res_T_CP[2], &tlEq4_5, &ACL_T_PL, &xexe_T_CP, &tlNM, &BB_T_PL, &uGuG_T_CP, scale, &context, &encryptor, &evaluator, &decryptor, &encoder, &gal_keys, &relin_keys, numThreads);
+			struct tiledLayoutMRP * resLayouts[3] = {&tlNN, &tlMN, &tlNN};
+
+			// Compare the tiled results with the MRP results and the cleartext references
+			for(int e = 0; e < 3; e++){
+				decryptTiledResult(tiledRes[e], &res_T_CP[e], resLayouts[e], &decryptor, &encoder);
+				double maxErr_MRP 	= maxDifferenceTMRP(mrpRes[e], ref[e], numRows[e]);
+				double maxErr_Tiled = maxDifferenceTMRP(tiledRes[e], ref[e], numRows[e]);
+				double maxDiff 		= maxDifferenceTMRP(tiledRes[e], mrpRes[e], numRows[e]);
+				bool isEqPassed 	= (maxDiff < tolerance && maxErr_Tiled < tolerance);
+				isPassed 		   &= isEqPassed;
+				printf("%d,%d,%zu,%d,%d,%s,%.3e,%.3e,%.3e,%s\n", n, m, colTileWidths[w], resLayouts[e]->numRowTiles, tlNN.numColTiles, equationNames[e],
+					   maxErr_MRP, maxErr_Tiled, maxDiff, isEqPassed ? "PASS" : "FAIL");
+			}
+		}
+
+		// Release the cleartext buffers
+		for(int i = 0; i < n; i++)
+			free(yVec[i]);
+		free(yVec);
+		for(int e = 0; e < 3; e++){
+			free(ref[e]);
+			free(mrpRes[e]);
+			free(tiledRes[e]);
+		}
+		free_SimulationMatrixDataMRP(smrp);
+		free(smrp);
+		free_SimulationMatrixData(smd);
+		free(smd);
+	}
+	printf("Tiled vs. MRP Layout Check: %s (tolerance %.0e)\n", isPassed ? "PASS" : "FAIL", tolerance);
+}
@@ -0,0 +1,113 @@
+/*
+   Author				: PAD_HE contributors
+   Date	 				: 19.10.2026
+   Description			: Header file of the class used for the multi-ciphertext (tiled) matrix-row-packing format (i.e., tiledMRP.cpp)
+						  A matrix whose rows do not fit into a single ciphertext (i.e., n * N > slot_count) is split into the row tiles
+						  (R = slot_count / N rows each) and the column tiles (N columns each); each tile is a separate plaintext.
+   Abbreviation/Acronym	: # _TMRP: Tiled matrix row packing format
+*/
+
+#ifndef TILEDMRP_H
+#define TILEDMRP_H
+
+/* Import the other classes' header files*/
+#include "examples.h" 			  // The class for the console menu and guiding the user to the preferred application
+#include "rawplain.h"  			  // The class which reads and stores the plain matrices
+#include "prepareVecMatMRP.h"     // The class which prepares the read matrices in MRP format
+#include "initializationPLCP.h"   // The class containing the functions which convert the prepared matrices to Plaintext and Ciphertext objects.
+#include "plcpOperations.h"       // The class containing the functions which does Ciphertext-Ciphertext and Plaintext-Ciphertext arithmetic and algebraic operations
+
+/* Import the important selected C libraries*/
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Call main namespaces */
+using namespace std;
+using namespace seal;
+
+/* Main struct for holding the tiled MRP layout of a (numRows x numCols) matrix */
+struct tiledLayoutMRP {
+	int numRows;      // Number of matrix rows (i.e., the length of the result vector)
+	int numCols;      // Number of matrix columns (i.e., the length of the multiplied vector)
+	int N;            // Encrypted row segment size (i.e., the column tile width, a power of two)
+	int rowsPerTile;  // Number of row segments in a single ciphertext (i.e., slot_count / N)
+	int numRowTiles;  // Number of the row tiles (i.e., the result ciphertexts)
+	int numColTiles;  // Number of the column tiles (i.e., the multiplied vector ciphertexts)
+	int rotLen;       // Rotation length of the rotate-and-sum (i.e., the binary-power width of the non-zero row segment entries, N for dense matrices)
+	size_t slotCount; // Number of the slots of a single ciphertext
+};
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Tiled Layout Creation ==========
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+/* The function for calculating the row segment size of the tiled layout (the MRP row size capped by the maximum column tile width) */
+int calculateTiledSegmentSize(size_t numStates, size_t slotCount, size_t maxColTileWidth);
+
+/* The function for calculating the row and column tiles of a (numRows x numCols) matrix for the given row segment size */
+void calculateTiledLayoutMRP(struct tiledLayoutMRP *tl, int numRows, int numCols, int N, size_t slotCount);
+
+/* The function for calculating the width of the non-zero part of the row segments of a matrix in the tiled MRP (rounded up to a binary power) */
+int calculateTiledNonZeroSegmentWidth(double ** mat, struct tiledLayoutMRP *tl);
+
+/* The function for checking whether the (single ciphertext) MRP layout overflows the ciphertext slots */
+bool isMRPLayoutOverflowed(struct simulationMatrixMRP *smrp, size_t slotCount);
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Tiled Cleartext Packing ========
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+/* The function for generating the matrix tiles in the tiled MRP (the tile (r, c) is stored at [r * numColTiles + c]) */
+void genTiledMatMRP_RPL(vector<vector<double>> *matTiles, double ** mat, struct tiledLayoutMRP *tl);
+
+/* The function for generating the replicated x vector tiles of the generic Ax multiplication (one ciphertext per column tile) */
+void genTiledRepXVecMRP_RPL(vector<vector<double>> *xTiles, double ** vec, struct tiledLayoutMRP *tl);
+
+/* The function for generating the vector tiles for the homomorphic addition (one ciphertext per row tile, entries at i * N) */
+void genTiledAddVecMRP_RPL(vector<vector<double>> *addTiles, double ** vec, struct tiledLayoutMRP *tl);
+
+/* The function for generating the constant vector tiles for the homomorphic addition (e.g., one, alpha, beta, first Chebyshev term) */
+void genTiledConstVecMRP_RPL(vector<vector<double>> *addTiles, double value, struct tiledLayoutMRP *tl);
+
+/* The function for encoding the tiles into Plaintexts (the all-zero matrix tiles are not encoded and left empty if skipZeroTiles is set) */
+void makeTiledPlaintextMatRowPacking(vector<vector<double>> *tiles, double scale, vector<Plaintext> *tiles_PL, CKKSEncoder *encoderPtr, bool skipZeroTiles);
+
+/* The function for counting the non-zero (i.e., encoded) matrix tiles */
+int countNonZeroTiles(vector<Plaintext> *tiles_PL);
+
+/* The function for encrypting the tiles into Ciphertexts */
+void encryptTiledVectorMatRowPacking(vector<vector<double>> *tiles, double scale, vector<Ciphertext> *tiles_CP, Encryptor *encryptorPtr, CKKSEncoder *encoderPtr);
+
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+// ==== Functions for the Tiled Homomorphic Operations ===
+// ==== ==== ==== ==== ==== ==== ==== ==== ==== ==== ====
+/* The function for performing the tiled Plaintext-Ciphertext matrix-vector multiplication M1*x1 (+ M2*x2), in which the tile products are computed in parallel and 
+   summed per row tile before a single rotation (the optional 2nd term shares the row tiles of the 1st one, e.g., Gamma*xe + L*y, ACL*xe + B*uG)
+   The zero tiles are skipped, and the row tiles without any non-zero tile are assigned to an encrypted zero without any rotation */
+void tiledMatrixVectorMultMRP(vector<Ciphertext> *resRowTiles_CP, struct tiledLayoutMRP *tl, vector<Plaintext> *matTiles_PL, vector<Ciphertext> *xColTiles_CP, 
+							  struct tiledLayoutMRP *tl2, vector<Plaintext> *mat2Tiles_PL, vector<Ciphertext> *x2ColTiles_CP, 
+							  double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr, GaloisKeys *gal_keysPtr, RelinKeys *relin_keysPtr, int numThreads);
+
+/* The function for performing the tiled homomorphic addition or subtraction with Ciphertext&Ciphertext */
+void addSubtractTiledVectors(vector<Ciphertext> *res_CP, vector<Ciphertext> *v_1_CP, vector<Ciphertext> *v_2_CP, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, bool isAddition);
+
+/* The function for performing the tiled homomorphic addition or subtraction with Plaintext&Ciphertext */
+void addSubtractTiledPLCPVectors(vector<Ciphertext> *res_CP, vector<Ciphertext> *v_1_CP, vector<Plaintext> *v_2_PL, double scale, SEALContext *contextPtr, Evaluator *evaluatorPtr, bool isAddition);
+
+/* The function for decrypting the row tiles and reading the result vector entries (i.e., the entries at i * N) */
+void decryptTiledResult(double * result, vector<Ciphertext> *rowTiles_CP, struct tiledLayoutMRP *tl, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr);
+
+/* The function for performing the secret share of the tiled estimation (the row tiles are re-arranged into the replicated column tiles) */
+void secretShareTiledEstimation(vector<Ciphertext> *xColTiles_CP, vector<Ciphertext> *xRowTiles_CP, struct tiledLayoutMRP *tl, double scale, SEALContext *contextPtr, Encryptor *encryptorPtr, Evaluator *evaluatorPtr, Decryptor *decryptorPtr, CKKSEncoder *encoderPtr);
+
+/* The function for creating the MRP view of a single row tile, so that the element-wise CUSUM functions of applyPLCPSimulation.cpp could be applied per row tile */
+void create_RowTileMRPView(struct simulationMatrixMRP *smrpTile, struct simulationMatrixMRP *smrp, struct tiledLayoutMRP *tl, int rowTileInd);
+
+#endif